@@ -143,7 +143,7 @@ inline void from_json(const nlohmann::json& j, AddAddressBookMessage& c) {
 
 inline std::string AddAddressBookMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace addressBook
@@ -68,7 +68,7 @@ inline void from_json(const nlohmann::json& j, AddressBook& c) {
 
 inline std::string AddressBook::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace addressBook
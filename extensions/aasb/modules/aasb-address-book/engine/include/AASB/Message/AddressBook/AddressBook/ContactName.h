@@ -74,7 +74,7 @@ inline void from_json(const nlohmann::json& j, ContactName& c) {
 
 inline std::string ContactName::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace addressBook
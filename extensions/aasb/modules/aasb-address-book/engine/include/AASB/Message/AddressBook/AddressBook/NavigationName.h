@@ -63,7 +63,7 @@ inline void from_json(const nlohmann::json& j, NavigationName& c) {
 
 inline std::string NavigationName::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace addressBook
@@ -61,7 +61,7 @@ inline void from_json(const nlohmann::json& j, PhoneData& c) {
 
 inline std::string PhoneData::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace addressBook
@@ -91,7 +91,7 @@ inline void from_json(const nlohmann::json& j, PostalAddress& c) {
 
 inline std::string PostalAddress::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace addressBook
@@ -67,7 +67,7 @@ bool AASBAddressBook::initialize(std::shared_ptr<aace::engine::aasb::MessageBrok
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::addressBook::addressBook::AddAddressBookMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->m_addressBookCache[payload.addressBookSourceId] = payload.addressBookData;
                     bool success = sp->addAddressBook(
                         payload.addressBookSourceId, payload.name, static_cast<AddressBookType>(payload.type));
@@ -92,7 +92,7 @@ bool AASBAddressBook::initialize(std::shared_ptr<aace::engine::aasb::MessageBrok
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::addressBook::addressBook::RemoveAddressBookMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->m_addressBookCache.erase(payload.addressBookSourceId);
                     bool success = sp->removeAddressBook(payload.addressBookSourceId);
 
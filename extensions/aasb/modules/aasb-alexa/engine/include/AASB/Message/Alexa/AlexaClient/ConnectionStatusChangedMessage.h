@@ -138,7 +138,7 @@ inline void from_json(const nlohmann::json& j, ConnectionStatusChangedMessage& c
 
 inline std::string ConnectionStatusChangedMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace alexaClient
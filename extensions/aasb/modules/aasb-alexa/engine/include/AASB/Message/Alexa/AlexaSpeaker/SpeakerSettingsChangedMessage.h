@@ -142,7 +142,7 @@ inline void from_json(const nlohmann::json& j, SpeakerSettingsChangedMessage& c)
 
 inline std::string SpeakerSettingsChangedMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace alexaSpeaker
@@ -133,7 +133,7 @@ inline void from_json(const nlohmann::json& j, GetPlayerDurationMessageReply& c)
 
 inline std::string GetPlayerDurationMessageReply::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace audioPlayer
@@ -138,7 +138,7 @@ inline void from_json(const nlohmann::json& j, AuthStateChangedMessage& c) {
 
 inline std::string AuthStateChangedMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace authProvider
@@ -136,7 +136,7 @@ inline void from_json(const nlohmann::json& j, GetAuthStateMessageReply& c) {
 
 inline std::string GetAuthStateMessageReply::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace authProvider
@@ -133,7 +133,7 @@ inline void from_json(const nlohmann::json& j, GetAuthTokenMessageReply& c) {
 
 inline std::string GetAuthTokenMessageReply::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace authProvider
@@ -133,7 +133,7 @@ inline void from_json(const nlohmann::json& j, SetupCompletedResponseMessage& c)
 
 inline std::string SetupCompletedResponseMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace deviceSetup
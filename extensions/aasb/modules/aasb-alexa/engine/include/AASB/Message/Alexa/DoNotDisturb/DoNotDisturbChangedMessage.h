@@ -130,7 +130,7 @@ inline void from_json(const nlohmann::json& j, DoNotDisturbChangedMessage& c) {
 
 inline std::string DoNotDisturbChangedMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace doNotDisturb
@@ -135,7 +135,7 @@ inline void from_json(const nlohmann::json& j, LocalResetBandsMessage& c) {
 
 inline std::string LocalResetBandsMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace equalizerController
@@ -57,7 +57,7 @@ inline void from_json(const nlohmann::json& j, AuthorizedPlayerInfo& c) {
 
 inline std::string AuthorizedPlayerInfo::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace alexa
@@ -67,7 +67,7 @@ inline void from_json(const nlohmann::json& j, DiscoveredPlayerInfo& c) {
 
 inline std::string DiscoveredPlayerInfo::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace alexa
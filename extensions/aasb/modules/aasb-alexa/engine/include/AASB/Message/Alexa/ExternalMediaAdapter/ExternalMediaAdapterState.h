@@ -59,7 +59,7 @@ inline void from_json(const nlohmann::json& j, ExternalMediaAdapterState& c) {
 
 inline std::string ExternalMediaAdapterState::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace alexa
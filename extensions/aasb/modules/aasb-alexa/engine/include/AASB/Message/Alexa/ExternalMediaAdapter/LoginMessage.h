@@ -142,7 +142,7 @@ inline void from_json(const nlohmann::json& j, LoginMessage& c) {
 
 inline std::string LoginMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace externalMediaAdapter
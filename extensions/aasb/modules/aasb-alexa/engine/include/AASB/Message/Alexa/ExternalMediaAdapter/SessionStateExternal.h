@@ -81,7 +81,7 @@ inline void from_json(const nlohmann::json& j, SessionStateExternal& c) {
 
 inline std::string SessionStateExternal::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace alexa
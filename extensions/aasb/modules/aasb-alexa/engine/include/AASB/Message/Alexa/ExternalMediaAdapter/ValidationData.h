@@ -54,7 +54,7 @@ inline void from_json(const nlohmann::json& j, ValidationData& c) {
 
 inline std::string ValidationData::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace alexa
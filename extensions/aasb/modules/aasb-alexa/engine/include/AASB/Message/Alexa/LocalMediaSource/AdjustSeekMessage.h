@@ -136,7 +136,7 @@ inline void from_json(const nlohmann::json& j, AdjustSeekMessage& c) {
 
 inline std::string AdjustSeekMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace localMediaSource
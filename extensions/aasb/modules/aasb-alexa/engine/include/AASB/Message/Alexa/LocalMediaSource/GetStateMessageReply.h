@@ -134,7 +134,7 @@ inline void from_json(const nlohmann::json& j, GetStateMessageReply& c) {
 
 inline std::string GetStateMessageReply::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace localMediaSource
@@ -60,7 +60,7 @@ inline void from_json(const nlohmann::json& j, LocalMediaSourceState& c) {
 
 inline std::string LocalMediaSourceState::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace localMediaSource
@@ -141,7 +141,7 @@ inline void from_json(const nlohmann::json& j, PlayMessage& c) {
 
 inline std::string PlayMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace localMediaSource
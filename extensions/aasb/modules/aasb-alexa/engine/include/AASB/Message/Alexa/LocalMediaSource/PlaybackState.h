@@ -131,7 +131,7 @@ inline void from_json(const nlohmann::json& j, PlaybackState& c) {
 
 inline std::string PlaybackState::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace localMediaSource
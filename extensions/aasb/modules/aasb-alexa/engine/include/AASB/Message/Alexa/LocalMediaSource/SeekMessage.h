@@ -136,7 +136,7 @@ inline void from_json(const nlohmann::json& j, SeekMessage& c) {
 
 inline std::string SeekMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace localMediaSource
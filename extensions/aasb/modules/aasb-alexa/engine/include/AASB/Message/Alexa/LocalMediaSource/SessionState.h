@@ -85,7 +85,7 @@ inline void from_json(const nlohmann::json& j, SessionState& c) {
 
 inline std::string SessionState::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace localMediaSource
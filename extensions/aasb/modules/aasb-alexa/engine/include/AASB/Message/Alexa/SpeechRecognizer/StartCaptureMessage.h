@@ -148,7 +148,7 @@ inline void from_json(const nlohmann::json& j, StartCaptureMessage& c) {
 
 inline std::string StartCaptureMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace speechRecognizer
@@ -125,7 +125,7 @@ inline void from_json(const nlohmann::json& j, DisplayCardClearedMessage& c) {
 
 inline std::string DisplayCardClearedMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace templateRuntime
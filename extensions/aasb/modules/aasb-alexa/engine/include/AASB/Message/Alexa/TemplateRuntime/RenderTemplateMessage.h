@@ -136,7 +136,7 @@ inline void from_json(const nlohmann::json& j, RenderTemplateMessage& c) {
 
 inline std::string RenderTemplateMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace templateRuntime
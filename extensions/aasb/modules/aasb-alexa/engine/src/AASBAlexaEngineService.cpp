@@ -262,8 +262,7 @@ bool AASBAlexaEngineService::registerLocalMediaSourceMessageHandlers(
             aasb::message::alexa::localMediaSource::PlayerEventMessage::action(),
             [this](const aace::engine::aasb::Message& message) {
                 try {
-                    aasb::message::alexa::localMediaSource::PlayerEventMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::alexa::localMediaSource::PlayerEventMessage::Payload payload = message.payloadJson();
 
                     auto source = static_cast<aace::alexa::LocalMediaSource::Source>(payload.source);
                     auto localMediaSource = m_localMediaSourceMap[source];
@@ -282,8 +281,7 @@ bool AASBAlexaEngineService::registerLocalMediaSourceMessageHandlers(
             aasb::message::alexa::localMediaSource::PlayerErrorMessage::action(),
             [this](const aace::engine::aasb::Message& message) {
                 try {
-                    aasb::message::alexa::localMediaSource::PlayerErrorMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::alexa::localMediaSource::PlayerErrorMessage::Payload payload = message.payloadJson();
 
                     auto source = static_cast<aace::alexa::LocalMediaSource::Source>(payload.source);
                     auto localMediaSource = m_localMediaSourceMap[source];
@@ -302,8 +300,7 @@ bool AASBAlexaEngineService::registerLocalMediaSourceMessageHandlers(
             aasb::message::alexa::localMediaSource::SetFocusMessage::action(),
             [this](const aace::engine::aasb::Message& message) {
                 try {
-                    aasb::message::alexa::localMediaSource::SetFocusMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::alexa::localMediaSource::SetFocusMessage::Payload payload = message.payloadJson();
 
                     auto source = static_cast<aace::alexa::LocalMediaSource::Source>(payload.source);
                     auto localMediaSource = m_localMediaSourceMap[source];
@@ -64,8 +64,7 @@ bool AASBAlexaSpeaker::initialize(std::shared_ptr<aace::engine::aasb::MessageBro
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::alexa::alexaSpeaker::LocalSetVolumeMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::alexa::alexaSpeaker::LocalSetVolumeMessage::Payload payload = message.payloadJson();
                     sp->localSetVolume(static_cast<SpeakerType>(payload.type), payload.volume);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG, "LocalSetVolumeMessage").d("reason", ex.what()));
@@ -80,7 +79,7 @@ bool AASBAlexaSpeaker::initialize(std::shared_ptr<aace::engine::aasb::MessageBro
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::alexa::alexaSpeaker::LocalAdjustVolumeMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->localAdjustVolume(static_cast<SpeakerType>(payload.type), payload.delta);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG, "LocalAdjustVolumeMessage").d("reason", ex.what()));
@@ -94,8 +93,7 @@ bool AASBAlexaSpeaker::initialize(std::shared_ptr<aace::engine::aasb::MessageBro
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::alexa::alexaSpeaker::LocalSetMuteMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::alexa::alexaSpeaker::LocalSetMuteMessage::Payload payload = message.payloadJson();
                     sp->localSetMute(static_cast<SpeakerType>(payload.type), payload.mute);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG, "LocalSetMuteMessage").d("reason", ex.what()));
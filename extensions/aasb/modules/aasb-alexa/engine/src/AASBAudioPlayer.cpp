@@ -61,7 +61,7 @@ bool AASBAudioPlayer::initialize(std::shared_ptr<aace::engine::aasb::MessageBrok
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::alexa::audioPlayer::GetPlayerPositionMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     AACE_INFO(LX(TAG, "GetPlayerPositionMessage").m("MessageRouted"));
 
@@ -85,7 +85,7 @@ bool AASBAudioPlayer::initialize(std::shared_ptr<aace::engine::aasb::MessageBrok
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::alexa::audioPlayer::GetPlayerDurationMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     AACE_INFO(LX(TAG, "GetPlayerDurationMessage").m("MessageRouted"));
 
@@ -63,8 +63,7 @@ bool AASBAuthProvider::initialize(std::shared_ptr<aace::engine::aasb::MessageBro
                 auto sp = wp.lock();
                 ThrowIfNull(sp, "invalidWeakPtrReference");
 
-                aasb::message::alexa::authProvider::AuthStateChangedMessage::Payload payload =
-                    nlohmann::json::parse(message.payload());
+                aasb::message::alexa::authProvider::AuthStateChangedMessage::Payload payload = message.payloadJson();
 
                 sp->authStateChanged(
                     static_cast<AuthState>(payload.authState), static_cast<AuthError>(payload.authError));
@@ -94,8 +93,7 @@ std::string AASBAuthProvider::getAuthToken() {
 
             ThrowIfNot(result.valid(), "waitForAuthTokenTimeout");
 
-            aasb::message::alexa::authProvider::GetAuthTokenMessageReply::Payload payload =
-                nlohmann::json::parse(result.payload());
+            aasb::message::alexa::authProvider::GetAuthTokenMessageReply::Payload payload = result.payloadJson();
 
             m_cachedAuthToken = payload.authToken;
         }
@@ -120,8 +118,7 @@ aace::alexa::AuthProvider::AuthState AASBAuthProvider::getAuthState() {
 
         ThrowIfNot(result.valid(), "waitForAuthStateTimeout");
 
-        aasb::message::alexa::authProvider::GetAuthStateMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
+        aasb::message::alexa::authProvider::GetAuthStateMessageReply::Payload payload = result.payloadJson();
 
         m_authState = static_cast<AuthState>(payload.state);
 
@@ -60,8 +60,7 @@ bool AASBDoNotDisturb::initialize(std::shared_ptr<aace::engine::aasb::MessageBro
                 auto sp = wp.lock();
                 ThrowIfNull(sp, "invalidWeakPtrReference");
 
-                aasb::message::alexa::doNotDisturb::DoNotDisturbChangedMessage::Payload payload =
-                    nlohmann::json::parse(message.payload());
+                aasb::message::alexa::doNotDisturb::DoNotDisturbChangedMessage::Payload payload = message.payloadJson();
 
                 sp->doNotDisturbChanged(payload.doNotDisturb);
             } catch (std::exception& ex) {
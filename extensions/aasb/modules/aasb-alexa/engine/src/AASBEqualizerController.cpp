@@ -67,7 +67,7 @@ bool AASBEqualizerController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::equalizerController::LocalSetBandLevelsMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     // convert the band levels from aasb to aace types
                     std::vector<aace::alexa::EqualizerController::EqualizerBandLevel> bandLevels;
@@ -91,7 +91,7 @@ bool AASBEqualizerController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::equalizerController::LocalAdjustBandLevelsMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     // convert the band levels from aasb to aace types
                     std::vector<aace::alexa::EqualizerController::EqualizerBandLevel> bandLevels;
@@ -115,7 +115,7 @@ bool AASBEqualizerController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::equalizerController::LocalResetBandsMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     // convert the bands from aasb to aace types
                     std::vector<aace::alexa::EqualizerController::EqualizerBand> bands;
@@ -175,8 +175,7 @@ std::vector<aace::alexa::EqualizerController::EqualizerBandLevel> AASBEqualizerC
 
         ThrowIfNot(result.valid(), "waitForBandLevelTimeout");
 
-        aasb::message::alexa::equalizerController::GetBandLevelsMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
+        aasb::message::alexa::equalizerController::GetBandLevelsMessageReply::Payload payload = result.payloadJson();
         std::vector<aace::alexa::EqualizerController::EqualizerBandLevel> bandLevels;
 
         // Need to check name of variable in GetBandLevelsMessageReply.h
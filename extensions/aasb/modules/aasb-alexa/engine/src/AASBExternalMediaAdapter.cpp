@@ -171,7 +171,7 @@ bool AASBExternalMediaAdapter::initialize(std::shared_ptr<aace::engine::aasb::Me
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::externalMediaAdapter::ReportDiscoveredPlayersMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     std::vector<aace::alexa::ExternalMediaAdapter::DiscoveredPlayerInfo> discoveredPlayers;
                     for (auto player : payload.discoveredPlayers) {
@@ -204,7 +204,7 @@ bool AASBExternalMediaAdapter::initialize(std::shared_ptr<aace::engine::aasb::Me
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::externalMediaAdapter::RequestTokenMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->requestToken(payload.localPlayerId);
                 } catch (std::exception& ex) {
@@ -221,7 +221,7 @@ bool AASBExternalMediaAdapter::initialize(std::shared_ptr<aace::engine::aasb::Me
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::externalMediaAdapter::LoginCompleteMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->loginComplete(payload.localPlayerId);
                 } catch (std::exception& ex) {
@@ -238,7 +238,7 @@ bool AASBExternalMediaAdapter::initialize(std::shared_ptr<aace::engine::aasb::Me
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::externalMediaAdapter::LogoutCompleteMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->logoutComplete(payload.localPlayerId);
                 } catch (std::exception& ex) {
@@ -255,7 +255,7 @@ bool AASBExternalMediaAdapter::initialize(std::shared_ptr<aace::engine::aasb::Me
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::externalMediaAdapter::PlayerEventMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->playerEvent(payload.localPlayerId, payload.eventName);
                 } catch (std::exception& ex) {
@@ -272,7 +272,7 @@ bool AASBExternalMediaAdapter::initialize(std::shared_ptr<aace::engine::aasb::Me
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::externalMediaAdapter::PlayerErrorMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->playerError(
                         payload.localPlayerId, payload.errorName, payload.code, payload.description, payload.fatal);
@@ -290,7 +290,7 @@ bool AASBExternalMediaAdapter::initialize(std::shared_ptr<aace::engine::aasb::Me
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::externalMediaAdapter::SetFocusMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->setFocus(payload.localPlayerId);
                 } catch (std::exception& ex) {
@@ -307,7 +307,7 @@ bool AASBExternalMediaAdapter::initialize(std::shared_ptr<aace::engine::aasb::Me
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::externalMediaAdapter::RemoveDiscoveredPlayerMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->removeDiscoveredPlayer(payload.localPlayerId);
                 } catch (std::exception& ex) {
@@ -176,8 +176,7 @@ aace::alexa::LocalMediaSource::LocalMediaSourceState AASBLocalMediaSource::getSt
 
         ThrowIfNot(result.valid(), "waitForRefreshTokenTimeout");
 
-        aasb::message::alexa::localMediaSource::GetStateMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
+        aasb::message::alexa::localMediaSource::GetStateMessageReply::Payload payload = result.payloadJson();
 
         state.playbackState.state = payload.state.playbackState.state;
         state.playbackState.trackOffset = std::chrono::milliseconds(payload.state.playbackState.trackOffset);
@@ -61,7 +61,7 @@ bool AASBPlaybackController::initialize(std::shared_ptr<aace::engine::aasb::Mess
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::playbackController::ButtonPressedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->buttonPressed(static_cast<PlaybackController::PlaybackButton>(payload.button));
                 } catch (std::exception& ex) {
@@ -78,7 +78,7 @@ bool AASBPlaybackController::initialize(std::shared_ptr<aace::engine::aasb::Mess
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::playbackController::TogglePressedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->togglePressed(static_cast<PlaybackController::PlaybackToggle>(payload.toggle), payload.action);
 
@@ -67,7 +67,7 @@ bool AASBSpeechRecognizer::initialize(std::shared_ptr<aace::engine::aasb::Messag
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::alexa::speechRecognizer::StartCaptureMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->startCapture(
                         static_cast<Initiator>(payload.initiator),
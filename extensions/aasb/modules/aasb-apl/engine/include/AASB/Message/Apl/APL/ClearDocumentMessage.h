@@ -130,7 +130,7 @@ inline void from_json(const nlohmann::json& j, ClearDocumentMessage& c) {
 
 inline std::string ClearDocumentMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace apl
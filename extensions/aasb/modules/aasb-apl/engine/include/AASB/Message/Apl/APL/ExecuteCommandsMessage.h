@@ -133,7 +133,7 @@ inline void from_json(const nlohmann::json& j, ExecuteCommandsMessage& c) {
 
 inline std::string ExecuteCommandsMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace apl
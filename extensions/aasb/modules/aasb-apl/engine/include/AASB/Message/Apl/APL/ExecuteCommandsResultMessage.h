@@ -136,7 +136,7 @@ inline void from_json(const nlohmann::json& j, ExecuteCommandsResultMessage& c)
 
 inline std::string ExecuteCommandsResultMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace apl
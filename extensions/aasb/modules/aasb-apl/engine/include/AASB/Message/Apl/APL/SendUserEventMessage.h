@@ -130,7 +130,7 @@ inline void from_json(const nlohmann::json& j, SendUserEventMessage& c) {
 
 inline std::string SendUserEventMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace apl
@@ -108,8 +108,7 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterf
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::apl::apl::SendUserEventMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::apl::apl::SendUserEventMessage::Payload payload = message.payloadJson();
 
                     sp->sendUserEvent(payload.payload);
                 } catch (std::exception& ex) {
@@ -124,8 +123,7 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterf
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::apl::apl::SetAPLMaxVersionMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::apl::apl::SetAPLMaxVersionMessage::Payload payload = message.payloadJson();
 
                     sp->setAPLMaxVersion(payload.version);
                 } catch (std::exception& ex) {
@@ -140,8 +138,7 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterf
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::apl::apl::SetDocumentIdleTimeoutMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::apl::apl::SetDocumentIdleTimeoutMessage::Payload payload = message.payloadJson();
                     std::chrono::milliseconds millis(payload.timeout);
 
                     sp->setDocumentIdleTimeout(millis);
@@ -157,8 +154,7 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterf
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::apl::apl::RenderDocumentResultMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::apl::apl::RenderDocumentResultMessage::Payload payload = message.payloadJson();
 
                     sp->renderDocumentResult(payload.token, payload.result, payload.error);
                 } catch (std::exception& ex) {
@@ -173,8 +169,7 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterf
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::apl::apl::ExecuteCommandsResultMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::apl::apl::ExecuteCommandsResultMessage::Payload payload = message.payloadJson();
 
                     sp->executeCommandsResult(payload.token, payload.result, payload.error);
                 } catch (std::exception& ex) {
@@ -189,8 +184,7 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterf
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::apl::apl::ProcessActivityEventMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::apl::apl::ProcessActivityEventMessage::Payload payload = message.payloadJson();
 
                     sp->processActivityEvent(payload.source, static_cast<ActivityEvent>(payload.event));
                 } catch (std::exception& ex) {
@@ -206,7 +200,7 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterf
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::apl::apl::SendDataSourceFetchRequestEventMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->sendDataSourceFetchRequestEvent(payload.type, payload.payload);
                 } catch (std::exception& ex) {
@@ -221,8 +215,7 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterf
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::apl::apl::SendRuntimeErrorEventMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::apl::apl::SendRuntimeErrorEventMessage::Payload payload = message.payloadJson();
 
                     sp->sendRuntimeErrorEvent(payload.payload);
                 } catch (std::exception& ex) {
@@ -237,8 +230,7 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterf
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::apl::apl::SendDeviceWindowStateMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::apl::apl::SendDeviceWindowStateMessage::Payload payload = message.payloadJson();
 
                     sp->sendDeviceWindowState(payload.state);
                 } catch (std::exception& ex) {
@@ -253,8 +245,7 @@ bool AASBAPL::initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterf
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::apl::apl::SendDocumentStateMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::apl::apl::SendDocumentStateMessage::Payload payload = message.payloadJson();
 
                     sp->sendDocumentState(payload.state);
                 } catch (std::exception& ex) {
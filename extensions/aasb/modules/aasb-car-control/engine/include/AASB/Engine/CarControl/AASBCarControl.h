@@ -18,10 +18,12 @@
 
 #include <AACE/CarControl/CarControl.h>
 #include <AACE/Engine/AASB/MessageBrokerInterface.h>
+#include <chrono>
 #include <future>
 #include <utility>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 namespace aasb {
 namespace engine {
@@ -32,18 +34,46 @@ class AASBCarControl
         , public std::enable_shared_from_this<AASBCarControl> {
 private:
     using CarControlPromise = std::promise<bool>;
-    AASBCarControl(uint32_t asyncReplyTimeout);
+    using CarControlBatchPromise = std::promise<std::vector<bool>>;
+    AASBCarControl(uint32_t asyncReplyTimeout, bool batchControllerValues);
 
     bool initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterface> messageBroker);
-    void addReplyMessagePromise(const std::string& messageId, std::shared_ptr<CarControlPromise> promise);
+    std::shared_future<bool> addReplyMessagePromise(const std::string& messageId);
     void removeReplyMessagePromise(const std::string& messageId);
-    bool waitForAsyncReply(const std::string& messageId);
+    bool waitForAsyncReply(
+        const std::string& messageId,
+        std::shared_future<bool> future,
+        std::chrono::steady_clock::time_point deadline);
     std::shared_ptr<CarControlPromise> getReplyMessagePromise(const std::string& messageId);
+    std::shared_ptr<CarControlBatchPromise> getBatchReplyMessagePromise(const std::string& messageId);
+
+    /**
+     * Publishes the message for a single controller value. The reply promise is registered before the
+     * message is published, so a reply cannot arrive before it can be routed.
+     *
+     * @param [in] value The controller value to set.
+     * @param [out] messageId Set to the id of the published message.
+     * @return The future fulfilled by the reply message.
+     */
+    std::shared_future<bool> publishControllerValue(const ControllerValue& value, std::string& messageId);
+    bool setControllerValue(const ControllerValue& value);
+
+    /// Publishes all of the values in a single @c SetControllerValues message.
+    bool publishControllerValues(const std::vector<ControllerValue>& values, std::vector<bool>& results);
 
 public:
+    /**
+     * Creates the AASB car control handler.
+     *
+     * @param [in] messageBroker The AASB message broker.
+     * @param [in] asyncReplyTimeout The time to wait for a reply message, in milliseconds.
+     * @param [in] batchControllerValues Whether the client handles @c SetControllerValues messages. If not,
+     * a batch is published as one message per value, and the replies are awaited together.
+     */
     static std::shared_ptr<AASBCarControl> create(
         std::shared_ptr<aace::engine::aasb::MessageBrokerInterface> messageBroker,
-        uint32_t asyncReplyTimeout);
+        uint32_t asyncReplyTimeout,
+        bool batchControllerValues = false);
 
     // aace::carControl
     bool turnPowerControllerOn(const std::string& endpointId) override;
@@ -68,11 +98,16 @@ public:
     bool getModeControllerValue(const std::string& endpointId, const std::string& controllerId, std::string& value)
         override;
 
+    bool setControllerValues(const std::vector<ControllerValue>& values, std::vector<bool>& results) override;
+    bool supportsControllerValueBatches() override;
+
 private:
     std::weak_ptr<aace::engine::aasb::MessageBrokerInterface> m_messageBroker;
     uint32_t m_replyMessageTimeout;
+    bool m_batchControllerValues;
     std::mutex m_promise_map_access_mutex;
     std::unordered_map<std::string, std::shared_ptr<CarControlPromise>> m_promiseMap;
+    std::unordered_map<std::string, std::shared_ptr<CarControlBatchPromise>> m_batchPromiseMap;
 };
 
 }  // namespace carControl
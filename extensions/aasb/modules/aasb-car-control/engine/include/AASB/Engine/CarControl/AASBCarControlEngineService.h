@@ -43,6 +43,7 @@ public:
 
 private:
     uint32_t m_asyncReplyTimeout = 5000;
+    bool m_batchControllerValues = false;
 };
 
 }  // namespace carControl
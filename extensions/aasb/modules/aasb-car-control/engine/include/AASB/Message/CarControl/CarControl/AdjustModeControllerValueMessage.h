@@ -145,7 +145,7 @@ inline void from_json(const nlohmann::json& j, AdjustModeControllerValueMessage&
 
 inline std::string AdjustModeControllerValueMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace carControl
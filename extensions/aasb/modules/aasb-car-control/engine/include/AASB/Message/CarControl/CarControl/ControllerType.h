@@ -0,0 +1,91 @@
+/*
+ * Copyright 2017-2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*********************************************************
+**********************************************************
+**********************************************************
+
+THIS FILE IS AUTOGENERATED. DO NOT EDIT
+
+**********************************************************
+**********************************************************
+*********************************************************/
+
+#ifndef CARCONTROL_CONTROLLERTYPE_H
+#define CARCONTROL_CONTROLLERTYPE_H
+
+#include <string>
+#include <vector>
+
+#include <unordered_map>
+#include <AACE/Engine/Utils/UUID/UUID.h>
+#include <nlohmann/json.hpp>
+
+namespace aasb {
+namespace message {
+namespace carControl {
+namespace carControl {
+
+//Enum Definition
+enum class ControllerType {
+    POWER,
+    TOGGLE,
+    RANGE,
+    MODE,
+};
+
+inline std::string toString(ControllerType enumValue) {
+    switch (enumValue) {
+        case (ControllerType::POWER):
+            return "POWER";
+        case (ControllerType::TOGGLE):
+            return "TOGGLE";
+        case (ControllerType::RANGE):
+            return "RANGE";
+        case (ControllerType::MODE):
+            return "MODE";
+    }
+    throw std::runtime_error("invalidControllerTypeType");
+}
+
+inline ControllerType toControllerType(const std::string& stringValue) {
+    static std::unordered_map<std::string, ControllerType> map = {
+        {"POWER", ControllerType::POWER},
+        {"TOGGLE", ControllerType::TOGGLE},
+        {"RANGE", ControllerType::RANGE},
+        {"MODE", ControllerType::MODE},
+    };
+
+    auto search = map.find(stringValue);
+    if (search != map.end()) {
+        return search->second;
+    }
+    throw std::runtime_error("invalidControllerTypeType");
+}
+
+inline void to_json(nlohmann::json& j, const ControllerType& c) {
+    j = toString(c);
+}
+
+inline void from_json(const nlohmann::json& j, ControllerType& c) {
+    c = toControllerType(j);
+}
+
+}  // namespace carControl
+}  // namespace carControl
+}  // namespace message
+}  // namespace aasb
+
+#endif  // CARCONTROL_CONTROLLERTYPE_H
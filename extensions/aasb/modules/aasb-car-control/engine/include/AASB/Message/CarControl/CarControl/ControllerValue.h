@@ -0,0 +1,92 @@
+/*
+ * Copyright 2017-2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*********************************************************
+**********************************************************
+**********************************************************
+
+THIS FILE IS AUTOGENERATED. DO NOT EDIT
+
+**********************************************************
+**********************************************************
+*********************************************************/
+
+#ifndef CARCONTROL_CONTROLLERVALUE_H
+#define CARCONTROL_CONTROLLERVALUE_H
+
+#include <string>
+#include <vector>
+
+#include <AACE/Engine/Utils/UUID/UUID.h>
+#include <nlohmann/json.hpp>
+#include "AASB/Message/CarControl/CarControl/ControllerType.h"
+
+namespace aasb {
+namespace message {
+namespace carControl {
+namespace carControl {
+
+//Class Definition
+struct ControllerValue {
+    using ControllerType = ::aasb::message::carControl::carControl::ControllerType;
+
+    std::string toString() const;
+    ControllerType controllerType;
+    std::string endpointId;
+    std::string controllerId = "";
+    bool turnOn = false;
+    double rangeValue = 0;
+    std::string modeValue = "";
+};
+
+//JSON Serialization
+inline void to_json(nlohmann::json& j, const ControllerValue& c) {
+    j = nlohmann::json{
+        {"controllerType", c.controllerType},
+        {"endpointId", c.endpointId},
+        {"controllerId", c.controllerId},
+        {"turnOn", c.turnOn},
+        {"rangeValue", c.rangeValue},
+        {"modeValue", c.modeValue},
+    };
+}
+inline void from_json(const nlohmann::json& j, ControllerValue& c) {
+    j.at("controllerType").get_to(c.controllerType);
+    j.at("endpointId").get_to(c.endpointId);
+    if (j.contains("controllerId")) {
+        j.at("controllerId").get_to(c.controllerId);
+    }
+    if (j.contains("turnOn")) {
+        j.at("turnOn").get_to(c.turnOn);
+    }
+    if (j.contains("rangeValue")) {
+        j.at("rangeValue").get_to(c.rangeValue);
+    }
+    if (j.contains("modeValue")) {
+        j.at("modeValue").get_to(c.modeValue);
+    }
+}
+
+inline std::string ControllerValue::toString() const {
+    nlohmann::json j = *this;
+    return j.dump();
+}
+
+}  // namespace carControl
+}  // namespace carControl
+}  // namespace message
+}  // namespace aasb
+
+#endif  // CARCONTROL_CONTROLLERVALUE_H
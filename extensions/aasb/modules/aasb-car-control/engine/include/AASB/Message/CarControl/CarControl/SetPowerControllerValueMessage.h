@@ -142,7 +142,7 @@ inline void from_json(const nlohmann::json& j, SetPowerControllerValueMessage& c
 
 inline std::string SetPowerControllerValueMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace carControl
@@ -26,6 +26,11 @@
 #include <AASB/Message/CarControl/CarControl/SetToggleControllerValueMessage.h>
 #include <AASB/Message/CarControl/CarControl/SetControllerValueMessageReply.h>
 
+#include <AASB/Message/CarControl/CarControl/SetControllerValuesMessage.h>
+#include <AASB/Message/CarControl/CarControl/SetControllerValuesMessageReply.h>
+
+#include <algorithm>
+
 namespace aasb {
 namespace engine {
 namespace carControl {
@@ -35,20 +40,38 @@ static const std::string TAG("aasb.carControl.AASBCarControl");
 
 // aliases
 using Message = aace::engine::aasb::Message;
+using ControllerType = aace::carControl::CarControl::ControllerValue::ControllerType;
+
+static aasb::message::carControl::carControl::ControllerType toAASBControllerType(ControllerType type) {
+    switch (type) {
+        case ControllerType::POWER:
+            return aasb::message::carControl::carControl::ControllerType::POWER;
+        case ControllerType::TOGGLE:
+            return aasb::message::carControl::carControl::ControllerType::TOGGLE;
+        case ControllerType::RANGE:
+            return aasb::message::carControl::carControl::ControllerType::RANGE;
+        case ControllerType::MODE:
+            return aasb::message::carControl::carControl::ControllerType::MODE;
+    }
+    throw std::runtime_error("invalidControllerType");
+}
 
-AASBCarControl::AASBCarControl(uint32_t asyncReplyTimeout) {
-    AACE_VERBOSE(LX(TAG).d("asyncReplyTimeout", asyncReplyTimeout));
+AASBCarControl::AASBCarControl(uint32_t asyncReplyTimeout, bool batchControllerValues) {
+    AACE_VERBOSE(LX(TAG).d("asyncReplyTimeout", asyncReplyTimeout).d("batchControllerValues", batchControllerValues));
     m_replyMessageTimeout = asyncReplyTimeout;
+    m_batchControllerValues = batchControllerValues;
 }
 
 std::shared_ptr<AASBCarControl> AASBCarControl::create(
     std::shared_ptr<aace::engine::aasb::MessageBrokerInterface> messageBroker,
-    uint32_t asyncReplyTimeout) {
+    uint32_t asyncReplyTimeout,
+    bool batchControllerValues) {
     try {
         ThrowIfNull(messageBroker, "invalidMessageBrokerInterface");
 
         // create the car control platform handler
-        auto carControl = std::shared_ptr<AASBCarControl>(new AASBCarControl(asyncReplyTimeout));
+        auto carControl =
+            std::shared_ptr<AASBCarControl>(new AASBCarControl(asyncReplyTimeout, batchControllerValues));
 
         // initialize the platform handler
         ThrowIfNot(carControl->initialize(messageBroker), "initializeAASBCarControlFailed");
@@ -81,7 +104,7 @@ bool AASBCarControl::initialize(std::shared_ptr<aace::engine::aasb::MessageBroke
                     ThrowIfNull(promise, "invalidPromise");
 
                     aasb::message::carControl::carControl::SetControllerValueMessageReply::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     promise->set_value(payload.success);
                     AACE_VERBOSE(LX(TAG, "SetControllerValueMessageReply").m("setControllerValueReplyPromiseSet"));
                 } catch (std::exception& ex) {
@@ -89,6 +112,27 @@ bool AASBCarControl::initialize(std::shared_ptr<aace::engine::aasb::MessageBroke
                 }
             });
 
+        messageBroker->subscribe(
+            aasb::message::carControl::carControl::SetControllerValuesMessageReply::topic(),
+            aasb::message::carControl::carControl::SetControllerValuesMessageReply::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    auto promise = sp->getBatchReplyMessagePromise(message.replyTo());
+                    ThrowIfNull(promise, "invalidPromise");
+
+                    aasb::message::carControl::carControl::SetControllerValuesMessageReply::Payload payload =
+                        message.payloadJson();
+                    promise->set_value(payload.results);
+                    AACE_VERBOSE(
+                        LX(TAG, "SetControllerValuesMessageReply").m("setControllerValuesReplyPromiseSet"));
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "SetControllerValuesMessageReply").d("reason", ex.what()));
+                }
+            });
+
         messageBroker->subscribe(
             aasb::message::carControl::carControl::AdjustControllerValueMessageReply::topic(),
             aasb::message::carControl::carControl::AdjustControllerValueMessageReply::action(),
@@ -101,7 +145,7 @@ bool AASBCarControl::initialize(std::shared_ptr<aace::engine::aasb::MessageBroke
                     ThrowIfNull(promise, "invalidPromise");
 
                     aasb::message::carControl::carControl::AdjustControllerValueMessageReply::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     promise->set_value(payload.success);
                     AACE_VERBOSE(
                         LX(TAG, "AdjustControllerValueMessageReply").m("adjustControllerValueReplyPromiseSet"));
@@ -124,47 +168,25 @@ bool AASBCarControl::initialize(std::shared_ptr<aace::engine::aasb::MessageBroke
  * PowerController
  */
 bool AASBCarControl::turnPowerControllerOn(const std::string& endpointId) {
-    try {
-        AACE_VERBOSE(LX(TAG));
-
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
-
-        aasb::message::carControl::carControl::SetPowerControllerValueMessage message;
-
-        message.payload.endpointId = endpointId;
-        message.payload.turnOn = true;
+    AACE_VERBOSE(LX(TAG));
 
-        m_messageBroker_lock->publish(message.toString()).send();
+    ControllerValue value;
+    value.type = ControllerType::POWER;
+    value.endpointId = endpointId;
+    value.turnOn = true;
 
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    return setControllerValue(value);
 }
 
 bool AASBCarControl::turnPowerControllerOff(const std::string& endpointId) {
-    try {
-        AACE_VERBOSE(LX(TAG));
+    AACE_VERBOSE(LX(TAG));
 
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
-
-        aasb::message::carControl::carControl::SetPowerControllerValueMessage message;
-
-        message.payload.endpointId = endpointId;
-        message.payload.turnOn = false;
+    ControllerValue value;
+    value.type = ControllerType::POWER;
+    value.endpointId = endpointId;
+    value.turnOn = false;
 
-        m_messageBroker_lock->publish(message.toString()).send();
-
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    return setControllerValue(value);
 }
 
 bool AASBCarControl::isPowerControllerOn(const std::string& endpointId, bool& isOn) {
@@ -175,48 +197,27 @@ bool AASBCarControl::isPowerControllerOn(const std::string& endpointId, bool& is
  * ToggleController
  */
 bool AASBCarControl::turnToggleControllerOn(const std::string& endpointId, const std::string& controllerId) {
-    try {
-        AACE_VERBOSE(LX(TAG));
-
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
+    AACE_VERBOSE(LX(TAG));
 
-        aasb::message::carControl::carControl::SetToggleControllerValueMessage message;
-
-        message.payload.endpointId = endpointId;
-        message.payload.controllerId = controllerId;
-        message.payload.turnOn = true;
-
-        m_messageBroker_lock->publish(message.toString()).send();
+    ControllerValue value;
+    value.type = ControllerType::TOGGLE;
+    value.endpointId = endpointId;
+    value.controllerId = controllerId;
+    value.turnOn = true;
 
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    return setControllerValue(value);
 }
 
 bool AASBCarControl::turnToggleControllerOff(const std::string& endpointId, const std::string& controllerId) {
-    try {
-        AACE_VERBOSE(LX(TAG));
+    AACE_VERBOSE(LX(TAG));
 
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
+    ControllerValue value;
+    value.type = ControllerType::TOGGLE;
+    value.endpointId = endpointId;
+    value.controllerId = controllerId;
+    value.turnOn = false;
 
-        aasb::message::carControl::carControl::SetToggleControllerValueMessage message;
-        message.payload.turnOn = false;
-        message.payload.endpointId = endpointId;
-        message.payload.controllerId = controllerId;
-
-        m_messageBroker_lock->publish(message.toString()).send();
-
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    return setControllerValue(value);
 }
 
 bool AASBCarControl::isToggleControllerOn(const std::string& endpointId, const std::string& controllerId, bool& isOn) {
@@ -230,32 +231,22 @@ bool AASBCarControl::setRangeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
     double value) {
-    try {
-        AACE_VERBOSE(LX(TAG));
-
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
-
-        aasb::message::carControl::carControl::SetRangeControllerValueMessage message;
-
-        message.payload.endpointId = endpointId;
-        message.payload.controllerId = controllerId;
-        message.payload.value = value;
+    AACE_VERBOSE(LX(TAG));
 
-        m_messageBroker_lock->publish(message.toString()).send();
+    ControllerValue controllerValue;
+    controllerValue.type = ControllerType::RANGE;
+    controllerValue.endpointId = endpointId;
+    controllerValue.controllerId = controllerId;
+    controllerValue.rangeValue = value;
 
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    return setControllerValue(controllerValue);
 }
 
 bool AASBCarControl::adjustRangeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
     double delta) {
+    std::string messageId;
     try {
         AACE_VERBOSE(LX(TAG));
 
@@ -268,12 +259,18 @@ bool AASBCarControl::adjustRangeControllerValue(
         message.payload.controllerId = controllerId;
         message.payload.delta = delta;
 
+        messageId = message.header.id;
+        auto future = addReplyMessagePromise(messageId);
+
         m_messageBroker_lock->publish(message.toString()).send();
 
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
+        return waitForAsyncReply(
+            messageId, future, std::chrono::steady_clock::now() + std::chrono::milliseconds(m_replyMessageTimeout));
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        if (!messageId.empty()) {
+            removeReplyMessagePromise(messageId);
+        }
         return false;
     }
 }
@@ -292,32 +289,22 @@ bool AASBCarControl::setModeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
     const std::string& value) {
-    try {
-        AACE_VERBOSE(LX(TAG));
+    AACE_VERBOSE(LX(TAG));
 
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
+    ControllerValue controllerValue;
+    controllerValue.type = ControllerType::MODE;
+    controllerValue.endpointId = endpointId;
+    controllerValue.controllerId = controllerId;
+    controllerValue.modeValue = value;
 
-        aasb::message::carControl::carControl::SetModeControllerValueMessage message;
-
-        message.payload.endpointId = endpointId;
-        message.payload.controllerId = controllerId;
-        message.payload.value = value;
-
-        m_messageBroker_lock->publish(message.toString()).send();
-
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return false;
-    }
+    return setControllerValue(controllerValue);
 }
 
 bool AASBCarControl::adjustModeControllerValue(
     const std::string& endpointId,
     const std::string& controllerId,
     int delta) {
+    std::string messageId;
     try {
         AACE_VERBOSE(LX(TAG));
 
@@ -330,12 +317,18 @@ bool AASBCarControl::adjustModeControllerValue(
         message.payload.controllerId = controllerId;
         message.payload.delta = delta;
 
+        messageId = message.header.id;
+        auto future = addReplyMessagePromise(messageId);
+
         m_messageBroker_lock->publish(message.toString()).send();
 
-        std::string messageId = message.header.id;
-        return waitForAsyncReply(messageId);
+        return waitForAsyncReply(
+            messageId, future, std::chrono::steady_clock::now() + std::chrono::milliseconds(m_replyMessageTimeout));
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        if (!messageId.empty()) {
+            removeReplyMessagePromise(messageId);
+        }
         return false;
     }
 }
@@ -347,39 +340,201 @@ bool AASBCarControl::getModeControllerValue(
     return true;
 }
 
-bool AASBCarControl::waitForAsyncReply(const std::string& messageId) {
-    // create the promise for the car control reply message to fulfill
-    std::shared_ptr<CarControlPromise> promise = std::make_shared<CarControlPromise>();
+/**
+ * Batched controller values
+ */
+bool AASBCarControl::supportsControllerValueBatches() {
+    return m_batchControllerValues;
+}
 
-    // create a future to receive the promised car control reply message when it is received
-    std::shared_future<bool> future(promise->get_future());
+bool AASBCarControl::setControllerValues(const std::vector<ControllerValue>& values, std::vector<bool>& results) {
+    AACE_VERBOSE(LX(TAG).d("count", values.size()).d("batchControllerValues", m_batchControllerValues));
+
+    if (values.empty()) {
+        results.clear();
+        return true;
+    }
+
+    if (m_batchControllerValues) {
+        return publishControllerValues(values, results);
+    }
+
+    // publish every value before waiting, so the client can handle the values for independent
+    // endpoints concurrently and the replies arrive in a single round trip
+    std::vector<std::pair<std::string, std::shared_future<bool>>> replies;
+    replies.reserve(values.size());
+    for (const auto& value : values) {
+        std::string messageId;
+        auto future = publishControllerValue(value, messageId);
+        replies.emplace_back(messageId, future);
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_replyMessageTimeout);
+
+    bool success = true;
+    results.clear();
+    results.reserve(values.size());
+    for (auto& reply : replies) {
+        bool result = reply.first.empty() ? false : waitForAsyncReply(reply.first, reply.second, deadline);
+        results.push_back(result);
+        success = success && result;
+    }
+
+    return success;
+}
+
+bool AASBCarControl::setControllerValue(const ControllerValue& value) {
+    std::string messageId;
+    auto future = publishControllerValue(value, messageId);
+    if (messageId.empty()) {
+        return false;
+    }
+    return waitForAsyncReply(
+        messageId, future, std::chrono::steady_clock::now() + std::chrono::milliseconds(m_replyMessageTimeout));
+}
+
+std::shared_future<bool> AASBCarControl::publishControllerValue(const ControllerValue& value, std::string& messageId) {
+    try {
+        auto m_messageBroker_lock = m_messageBroker.lock();
+        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
+
+        std::string payload;
+        switch (value.type) {
+            case ControllerType::POWER: {
+                aasb::message::carControl::carControl::SetPowerControllerValueMessage message;
+                message.payload.endpointId = value.endpointId;
+                message.payload.turnOn = value.turnOn;
+                messageId = message.header.id;
+                payload = message.toString();
+                break;
+            }
+            case ControllerType::TOGGLE: {
+                aasb::message::carControl::carControl::SetToggleControllerValueMessage message;
+                message.payload.endpointId = value.endpointId;
+                message.payload.controllerId = value.controllerId;
+                message.payload.turnOn = value.turnOn;
+                messageId = message.header.id;
+                payload = message.toString();
+                break;
+            }
+            case ControllerType::RANGE: {
+                aasb::message::carControl::carControl::SetRangeControllerValueMessage message;
+                message.payload.endpointId = value.endpointId;
+                message.payload.controllerId = value.controllerId;
+                message.payload.value = value.rangeValue;
+                messageId = message.header.id;
+                payload = message.toString();
+                break;
+            }
+            case ControllerType::MODE: {
+                aasb::message::carControl::carControl::SetModeControllerValueMessage message;
+                message.payload.endpointId = value.endpointId;
+                message.payload.controllerId = value.controllerId;
+                message.payload.value = value.modeValue;
+                messageId = message.header.id;
+                payload = message.toString();
+                break;
+            }
+        }
+        ThrowIf(messageId.empty(), "invalidControllerType");
+
+        // register the reply promise before publishing, so the reply can always be routed
+        auto future = addReplyMessagePromise(messageId);
+
+        m_messageBroker_lock->publish(payload).send();
+
+        return future;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "publishControllerValue").d("reason", ex.what()));
+        if (!messageId.empty()) {
+            removeReplyMessagePromise(messageId);
+            messageId.clear();
+        }
+        return std::shared_future<bool>();
+    }
+}
+
+bool AASBCarControl::publishControllerValues(const std::vector<ControllerValue>& values, std::vector<bool>& results) {
+    aasb::message::carControl::carControl::SetControllerValuesMessage message;
+    const std::string messageId = message.header.id;
+
+    results.assign(values.size(), false);
+
+    auto promise = std::make_shared<CarControlBatchPromise>();
+    std::shared_future<std::vector<bool>> future(promise->get_future());
 
-    bool success = false;
     try {
-        addReplyMessagePromise(messageId, promise);
+        auto m_messageBroker_lock = m_messageBroker.lock();
+        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
+
+        message.payload.values.reserve(values.size());
+        for (const auto& value : values) {
+            aasb::message::carControl::carControl::ControllerValue messageValue;
+            messageValue.controllerType = toAASBControllerType(value.type);
+            messageValue.endpointId = value.endpointId;
+            messageValue.controllerId = value.controllerId;
+            messageValue.turnOn = value.turnOn;
+            messageValue.rangeValue = value.rangeValue;
+            messageValue.modeValue = value.modeValue;
+            message.payload.values.push_back(messageValue);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
+            m_batchPromiseMap[messageId] = promise;
+        }
+
+        m_messageBroker_lock->publish(message.toString()).send();
+
         ThrowIfNot(
             future.wait_for(std::chrono::milliseconds(m_replyMessageTimeout)) == std::future_status::ready,
             "replyMessageTimeout:id=" + messageId);
+
+        auto replyResults = future.get();
+        ThrowIfNot(replyResults.size() == values.size(), "invalidResultCount");
+
+        results = replyResults;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "publishControllerValues").d("reason", ex.what()));
+    }
+
+    removeReplyMessagePromise(messageId);
+
+    return std::find(results.begin(), results.end(), false) == results.end();
+}
+
+bool AASBCarControl::waitForAsyncReply(
+    const std::string& messageId,
+    std::shared_future<bool> future,
+    std::chrono::steady_clock::time_point deadline) {
+    bool success = false;
+    try {
         ThrowIfNot(future.valid(), "invalidMessageResponse");
+        ThrowIfNot(
+            future.wait_until(deadline) == std::future_status::ready, "replyMessageTimeout:id=" + messageId);
         success = future.get();
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        promise->set_exception(std::current_exception());
     }
     removeReplyMessagePromise(messageId);
     return success;
 }
 
-void AASBCarControl::addReplyMessagePromise(const std::string& messageId, std::shared_ptr<CarControlPromise> promise) {
+std::shared_future<bool> AASBCarControl::addReplyMessagePromise(const std::string& messageId) {
     try {
         std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
 
         ThrowIf(m_promiseMap.find(messageId) != m_promiseMap.end(), "messageIdAlreadyExists");
 
-        // add the promise to the promise map
+        // create the promise for the car control reply message to fulfill, and add it to the promise map
+        auto promise = std::make_shared<CarControlPromise>();
         m_promiseMap[messageId] = promise;
+
+        // create a future to receive the promised car control reply message when it is received
+        return std::shared_future<bool>(promise->get_future());
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "addReplyMessagePromise").d("reason", ex.what()));
+        return std::shared_future<bool>();
     }
 }
 
@@ -387,11 +542,9 @@ void AASBCarControl::removeReplyMessagePromise(const std::string& messageId) {
     try {
         std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
 
-        auto it = m_promiseMap.find(messageId);
-        ThrowIf(it == m_promiseMap.end(), "messageIdDoesNotExist");
-
         // remove the promise from the promise map
-        m_promiseMap.erase(messageId);
+        ThrowIf(
+            m_promiseMap.erase(messageId) == 0 && m_batchPromiseMap.erase(messageId) == 0, "messageIdDoesNotExist");
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "removeReplyMessagePromise").d("reason", ex.what()));
     }
@@ -412,6 +565,21 @@ std::shared_ptr<AASBCarControl::CarControlPromise> AASBCarControl::getReplyMessa
     }
 }
 
+std::shared_ptr<AASBCarControl::CarControlBatchPromise> AASBCarControl::getBatchReplyMessagePromise(
+    const std::string& messageId) {
+    try {
+        std::lock_guard<std::mutex> lock(m_promise_map_access_mutex);
+
+        auto it = m_batchPromiseMap.find(messageId);
+        ThrowIf(it == m_batchPromiseMap.end(), "messageIdDoesNotExist");
+
+        return it->second;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("keys", m_batchPromiseMap.size()).d("messageId", messageId));
+        return nullptr;
+    }
+}
+
 }  // namespace carControl
 }  // namespace engine
 }  // namespace aasb
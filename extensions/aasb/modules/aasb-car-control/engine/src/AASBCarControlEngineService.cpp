@@ -61,6 +61,9 @@ bool AASBCarControlEngineService::configureCarControl(std::istream& configuratio
     try {
         auto root = nlohmann::json::parse(configuration);
         m_asyncReplyTimeout = root["/asyncReplyTimeout"_json_pointer];
+
+        // the client must opt in to the SetControllerValues message
+        m_batchControllerValues = root.value("batchControllerValues", false);
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -76,7 +79,8 @@ bool AASBCarControlEngineService::postRegister() {
 
         // CarControl
         if (isInterfaceEnabled("CarControl")) {
-            auto carControl = AASBCarControl::create(aasbServiceInterface->getMessageBroker(), m_asyncReplyTimeout);
+            auto carControl = AASBCarControl::create(
+                aasbServiceInterface->getMessageBroker(), m_asyncReplyTimeout, m_batchControllerValues);
             ThrowIfNull(carControl, "invalidCarControlHandler");
             getContext()->registerPlatformInterface(carControl);
         }
@@ -144,7 +144,7 @@ inline void from_json(const nlohmann::json& j, CBLStateChangedMessage& c) {
 
 inline std::string CBLStateChangedMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace cbl
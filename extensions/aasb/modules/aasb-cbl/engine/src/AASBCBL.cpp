@@ -187,8 +187,7 @@ std::string AASBCBL::getRefreshToken() {
 
             ThrowIfNot(result.valid(), "waitForRefreshTokenTimeout");
 
-            aasb::message::cbl::cbl::GetRefreshTokenMessageReply::Payload reply =
-                nlohmann::json::parse(result.payload());
+            aasb::message::cbl::cbl::GetRefreshTokenMessageReply::Payload reply = result.payloadJson();
 
             m_cachedRefreshToken = reply.refreshToken;
         }
@@ -125,7 +125,7 @@ inline void from_json(const nlohmann::json& j, GetConnectivityStateMessage& c) {
 
 inline std::string GetConnectivityStateMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace alexaConnectivity
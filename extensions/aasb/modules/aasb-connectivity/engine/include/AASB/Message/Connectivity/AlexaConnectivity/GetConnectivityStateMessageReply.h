@@ -133,7 +133,7 @@ inline void from_json(const nlohmann::json& j, GetConnectivityStateMessageReply&
 
 inline std::string GetConnectivityStateMessageReply::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace alexaConnectivity
@@ -103,7 +103,7 @@ std::string AASBAlexaConnectivity::getConnectivityState() {
         ThrowIfNot(result.valid(), "waitForGetConnectivityStateTimeout");
 
         aasb::message::connectivity::alexaConnectivity::GetConnectivityStateMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
+            result.payloadJson();
 
         return payload.connectivityState;
     } catch (std::exception& ex) {
@@ -125,7 +125,7 @@ std::string AASBAlexaConnectivity::getIdentifier() {
         ThrowIfNot(result.valid(), "waitForGetIdentifierTimeout");
 
         aasb::message::connectivity::alexaConnectivity::GetIdentifierMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
+            result.payloadJson();
 
         return payload.identifier;
     } catch (std::exception& ex) {
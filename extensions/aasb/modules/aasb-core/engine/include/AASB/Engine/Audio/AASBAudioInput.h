@@ -16,6 +16,7 @@
 #ifndef AASB_ENGINE_AUDIO_AASB_AUDIO_INPUT_H
 #define AASB_ENGINE_AUDIO_AASB_AUDIO_INPUT_H
 
+#include <AACE/AASB/AASBRingBufferStream.h>
 #include <AACE/Audio/AudioInput.h>
 #include <AACE/Audio/AudioInputProvider.h>
 #include <AACE/Engine/AASB/MessageBrokerInterface.h>
@@ -23,6 +24,7 @@
 
 #include <memory>
 #include <fstream>
+#include <thread>
 
 namespace aasb {
 namespace engine {
@@ -41,8 +43,13 @@ private:
         std::shared_ptr<aace::engine::aasb::MessageBrokerInterface> messageBroker,
         std::shared_ptr<aace::engine::aasb::StreamManagerInterface> streamManager);
 
+    static void processStream(
+        std::weak_ptr<AASBAudioInput> weakSelf,
+        std::shared_ptr<aace::aasb::AASBRingBufferStream> stream);
+    void closeStream();
+
 public:
-    virtual ~AASBAudioInput() = default;
+    virtual ~AASBAudioInput();
 
     static std::shared_ptr<AASBAudioInput> create(
         const std::string& name,
@@ -65,26 +72,13 @@ private:
 
     std::string m_currentStreamId;
 
+    // the client writes audio into the current stream, and the stream thread forwards
+    // the audio to the engine directly from the stream buffer
+    std::shared_ptr<aace::aasb::AASBRingBufferStream> m_currentStream;
+    std::thread m_streamThread;
+
     std::weak_ptr<aace::engine::aasb::MessageBrokerInterface> m_messageBroker;
     std::weak_ptr<aace::engine::aasb::StreamManagerInterface> m_streamManager;
-
-    //
-    // AudioInputStreamHandler
-    //
-
-    class AudioInputStreamHandler : public aace::aasb::AASBStream {
-    public:
-        AudioInputStreamHandler(std::shared_ptr<AASBAudioInput> audioInput);
-
-        // aace::aasb::AASBStream
-        ssize_t read(char* data, const size_t size) override;
-        ssize_t write(const char* data, const size_t size) override;
-        bool isClosed() override;
-        AASBStream::Mode getMode() override;
-
-    private:
-        std::shared_ptr<AASBAudioInput> m_audioInput;
-    };
 };
 
 }  // namespace audio
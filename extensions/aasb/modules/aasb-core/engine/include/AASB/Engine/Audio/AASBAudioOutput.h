@@ -21,7 +21,9 @@
 #include <AACE/Engine/AASB/MessageBrokerInterface.h>
 #include <AACE/Engine/AASB/StreamManagerInterface.h>
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 
 namespace aasb {
 namespace engine {
@@ -60,6 +62,17 @@ public:
     bool mutedStateChanged(MutedState state) override;
     int64_t getNumBytesBuffered() override;
 
+private:
+    // playback position tracking
+    void resetPosition(const std::string& token);
+    void updatePosition(const std::string& token, int64_t position, int64_t duration);
+    void updateMediaState(const std::string& token, MediaState state);
+    bool getExtrapolatedPosition(int64_t& position);
+    int64_t getExtrapolatedPositionLocked(std::chrono::steady_clock::time_point now);
+
+    int64_t requestPosition();
+    int64_t requestDuration();
+
 private:
     const std::string m_name;
     const aace::audio::AudioOutputProvider::AudioOutputType m_type;
@@ -71,6 +84,16 @@ private:
     std::weak_ptr<aace::engine::aasb::MessageBrokerInterface> m_messageBroker;
     std::weak_ptr<aace::engine::aasb::StreamManagerInterface> m_streamManager;
 
+    // The playback position is extrapolated from the last position reported by the application, and the
+    // time at which it was reported, while the media state is PLAYING.
+    std::string m_positionToken;
+    bool m_positionValid = false;
+    bool m_playing = false;
+    int64_t m_anchorPosition = 0;
+    int64_t m_duration = TIME_UNKNOWN;
+    std::chrono::steady_clock::time_point m_anchorTime;
+    std::mutex m_positionMutex;
+
     //
     // AudioOutputStreamHandler
     //
@@ -16,6 +16,7 @@
 #ifndef AASB_ENGINE_LOCATION_AASB_LOCATION_ENGINE_SERVICE_H
 #define AASB_ENGINE_LOCATION_AASB_LOCATION_ENGINE_SERVICE_H
 
+#include <chrono>
 #include <unordered_map>
 #include <mutex>
 
@@ -35,9 +36,18 @@ private:
 
 protected:
     bool postRegister() override;
+    bool configureAASBInterface(const std::string& name, bool enabled, std::istream& configuration) override;
+
+private:
+    bool configureLocationProvider(std::istream& configuration);
 
 public:
     virtual ~AASBLocationEngineService() = default;
+
+private:
+    // location provider cache configuration
+    std::chrono::milliseconds m_maxLocationAge;
+    std::chrono::milliseconds m_prefetchInterval;
 };
 
 }  // namespace location
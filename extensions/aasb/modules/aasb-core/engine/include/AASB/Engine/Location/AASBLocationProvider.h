@@ -16,6 +16,11 @@
 #ifndef AASB_ENGINE_LOCATION_AASB_LOCATION_PROVIDER_H
 #define AASB_ENGINE_LOCATION_AASB_LOCATION_PROVIDER_H
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include <AACE/Location/LocationProvider.h>
 #include <AACE/Engine/AASB/MessageBrokerInterface.h>
 
@@ -27,23 +32,63 @@ class AASBLocationProvider
         : public aace::location::LocationProvider
         , public std::enable_shared_from_this<AASBLocationProvider> {
 private:
-    AASBLocationProvider() = default;
+    AASBLocationProvider(std::chrono::milliseconds maxLocationAge, std::chrono::milliseconds prefetchInterval);
 
     bool initialize(std::shared_ptr<aace::engine::aasb::MessageBrokerInterface> messageBroker);
 
 public:
+    /**
+     * Creates a location provider handler.
+     *
+     * @param [in] messageBroker The AASB message broker
+     * @param [in] maxLocationAge The maximum age of a cached location or country returned without
+     * requesting it from the application. A value of zero disables the cache.
+     * @param [in] prefetchInterval The interval at which the location is requested from the application
+     * in the background to keep the cache fresh. A value of zero disables prefetching.
+     */
     static std::shared_ptr<AASBLocationProvider> create(
-        std::shared_ptr<aace::engine::aasb::MessageBrokerInterface> messageBroker);
+        std::shared_ptr<aace::engine::aasb::MessageBrokerInterface> messageBroker,
+        std::chrono::milliseconds maxLocationAge,
+        std::chrono::milliseconds prefetchInterval);
+
+    virtual ~AASBLocationProvider();
 
     // aace::location::LocationProvider
     aace::location::Location getLocation() override;
     std::string getCountry() override;
 
+private:
+    bool requestLocation();
+    bool requestCountry();
+
+    void updateLocation(const aace::location::Location& location);
+    void updateCountry(const std::string& country);
+    void invalidateCache();
+
+    bool isFresh(std::chrono::steady_clock::time_point updateTime);
+
+    void prefetchLoop();
+
 private:
     std::weak_ptr<aace::engine::aasb::MessageBrokerInterface> m_messageBroker;
 
-    // the current location
+    // cache configuration
+    const std::chrono::milliseconds m_maxLocationAge;
+    const std::chrono::milliseconds m_prefetchInterval;
+
+    // the current location and country, and the time they were last updated
     aace::location::Location m_location;
+    std::string m_country;
+    bool m_locationValid = false;
+    bool m_countryValid = false;
+    std::chrono::steady_clock::time_point m_locationUpdateTime;
+    std::chrono::steady_clock::time_point m_countryUpdateTime;
+    std::mutex m_mutex;
+
+    // background prefetch
+    std::thread m_prefetchThread;
+    std::condition_variable m_prefetchTrigger;
+    bool m_shutdown = false;
 };
 
 }  // namespace location
@@ -57,7 +57,7 @@ inline void from_json(const nlohmann::json& j, AudioStreamProperty& c) {
 
 inline std::string AudioStreamProperty::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace audio
@@ -141,7 +141,7 @@ inline void from_json(const nlohmann::json& j, MediaErrorMessage& c) {
 
 inline std::string MediaErrorMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace audioOutput
@@ -136,7 +136,7 @@ inline void from_json(const nlohmann::json& j, MutedStateChangedMessage& c) {
 
 inline std::string MutedStateChangedMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace audioOutput
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2017-2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*********************************************************
+**********************************************************
+**********************************************************
+
+THIS FILE IS AUTOGENERATED. DO NOT EDIT
+
+**********************************************************
+**********************************************************
+*********************************************************/
+
+#ifndef AUDIOOUTPUT_POSITIONUPDATEDMESSAGE_H
+#define AUDIOOUTPUT_POSITIONUPDATEDMESSAGE_H
+
+#include <string>
+#include <vector>
+
+#include <AACE/Engine/Utils/UUID/UUID.h>
+#include <nlohmann/json.hpp>
+
+namespace aasb {
+namespace message {
+namespace audio {
+namespace audioOutput {
+
+//Class Definition
+struct PositionUpdatedMessage {
+    struct Header {
+        struct MessageDescription {
+            static const std::string& topic() {
+                static std::string topic = "AudioOutput";
+                return topic;
+            }
+            static const std::string& action() {
+                static std::string action = "PositionUpdated";
+                return action;
+            }
+        };
+        static const std::string& version() {
+            static std::string version = "3.2";
+            return version;
+        }
+        static const std::string& messageType() {
+            static std::string messageType = "Publish";
+            return messageType;
+        }
+        std::string id = aace::engine::utils::uuid::generateUUID();
+        MessageDescription messageDescription;
+    };
+    struct Payload {
+        std::string channel;
+        std::string token;
+        int position;
+        int duration = -1;
+    };
+    static const std::string& topic() {
+        static std::string topic = "AudioOutput";
+        return topic;
+    }
+    static const std::string& action() {
+        static std::string action = "PositionUpdated";
+        return action;
+    }
+    static const std::string& version() {
+        static std::string version = "3.2";
+        return version;
+    }
+    static const std::string& messageType() {
+        static std::string messageType = "Publish";
+        return messageType;
+    }
+    std::string toString() const;
+    Header header;
+    Payload payload;
+};
+
+//JSON Serialization
+inline void to_json(nlohmann::json& j, const PositionUpdatedMessage::Payload& c) {
+    j = nlohmann::json{
+        {"channel", c.channel},
+        {"token", c.token},
+        {"position", c.position},
+        {"duration", c.duration},
+    };
+}
+inline void from_json(const nlohmann::json& j, PositionUpdatedMessage::Payload& c) {
+    j.at("channel").get_to(c.channel);
+    j.at("token").get_to(c.token);
+    j.at("position").get_to(c.position);
+    if (j.contains("duration")) {
+        j.at("duration").get_to(c.duration);
+    }
+}
+
+inline void to_json(nlohmann::json& j, const PositionUpdatedMessage::Header::MessageDescription& c) {
+    j = nlohmann::json{
+        {"topic", c.topic()},
+        {"action", c.action()},
+    };
+}
+inline void from_json(const nlohmann::json& j, PositionUpdatedMessage::Header::MessageDescription& c) {
+}
+
+inline void to_json(nlohmann::json& j, const PositionUpdatedMessage::Header& c) {
+    j = nlohmann::json{
+        {"version", c.version()},
+        {"messageType", c.messageType()},
+        {"id", c.id},
+        {"messageDescription", c.messageDescription},
+    };
+}
+inline void from_json(const nlohmann::json& j, PositionUpdatedMessage::Header& c) {
+    j.at("id").get_to(c.id);
+    j.at("messageDescription").get_to(c.messageDescription);
+}
+
+inline void to_json(nlohmann::json& j, const PositionUpdatedMessage& c) {
+    j = nlohmann::json{
+        {"header", c.header},
+        {"payload", c.payload},
+    };
+}
+inline void from_json(const nlohmann::json& j, PositionUpdatedMessage& c) {
+    j.at("header").get_to(c.header);
+    j.at("payload").get_to(c.payload);
+}
+
+inline std::string PositionUpdatedMessage::toString() const {
+    nlohmann::json j = *this;
+    return j.dump();
+}
+
+}  // namespace audioOutput
+}  // namespace audio
+}  // namespace message
+}  // namespace aasb
+
+#endif  // AUDIOOUTPUT_POSITIONUPDATEDMESSAGE_H
@@ -162,7 +162,7 @@ inline void from_json(const nlohmann::json& j, PrepareStreamMessage& c) {
 
 inline std::string PrepareStreamMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace audioOutput
@@ -154,7 +154,7 @@ inline void from_json(const nlohmann::json& j, PrepareURLMessage& c) {
 
 inline std::string PrepareURLMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace audioOutput
@@ -67,7 +67,7 @@ inline void from_json(const nlohmann::json& j, Location& c) {
 
 inline std::string Location::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace location
@@ -133,7 +133,7 @@ inline void from_json(const nlohmann::json& j, GetWifiSignalStrengthMessageReply
 
 inline std::string GetWifiSignalStrengthMessageReply::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace networkInfoProvider
@@ -139,7 +139,7 @@ inline void from_json(const nlohmann::json& j, PropertyStateChangedMessage& c) {
 
 inline std::string PropertyStateChangedMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace propertyManager
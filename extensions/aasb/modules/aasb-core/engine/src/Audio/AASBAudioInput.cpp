@@ -20,6 +20,7 @@
 #include <AASB/Message/Audio/AudioInput/StartAudioInputMessage.h>
 #include <AASB/Message/Audio/AudioInput/StopAudioInputMessage.h>
 
+#include <algorithm>
 #include <functional>
 
 namespace aasb {
@@ -29,9 +30,22 @@ namespace audio {
 // String to identify log entries originating from this file.
 static const std::string TAG("aasb.audio.AASBAudioInput");
 
+// size of the audio input stream buffer (about 2 seconds of 16 kHz, 16-bit mono audio)
+static const size_t AUDIO_INPUT_STREAM_CAPACITY = 64 * 1024;
+
+// maximum time the stream thread waits for audio before checking if the stream was closed
+static const std::chrono::milliseconds AUDIO_INPUT_STREAM_WAIT_TIMEOUT = std::chrono::milliseconds(500);
+
+// number of samples copied at a time when a sample wraps around the end of the stream buffer
+static const size_t AUDIO_INPUT_WRAP_BUFFER_SAMPLES = 160;
+
 AASBAudioInput::AASBAudioInput(const std::string& name, AudioInputType type) : m_name(name), m_type(type) {
 }
 
+AASBAudioInput::~AASBAudioInput() {
+    closeStream();
+}
+
 std::shared_ptr<AASBAudioInput> AASBAudioInput::create(
     const std::string& name,
     AudioInputType type,
@@ -83,12 +97,16 @@ bool AASBAudioInput::startAudioInput() {
         // generate the stream uuid
         auto streamId = aace::engine::utils::uuid::generateUUID();
 
-        // create the stream handler
-        auto handler = std::make_shared<AudioInputStreamHandler>(shared_from_this());
-        m_streamManager_lock->registerStreamHandler(streamId, handler);
+        // create the stream the client writes audio into
+        auto stream =
+            aace::aasb::AASBRingBufferStream::create(AUDIO_INPUT_STREAM_CAPACITY, aace::aasb::AASBStream::Mode::WRITE);
+        ThrowIfNull(stream, "createStreamFailed");
+        ThrowIfNot(m_streamManager_lock->registerStreamHandler(streamId, stream), "registerStreamHandlerFailed");
 
         m_expectAudio = true;
         m_currentStreamId = streamId;
+        m_currentStream = stream;
+        m_streamThread = std::thread(&AASBAudioInput::processStream, shared_from_this(), stream);
 
         aasb::message::audio::audioInput::StartAudioInputMessage message;
         message.payload.streamId = streamId;
@@ -116,6 +134,8 @@ bool AASBAudioInput::stopAudioInput() {
         m_expectAudio = false;
         m_currentStreamId.clear();
 
+        closeStream();
+
         if (auto m_messageBroker_lock = m_messageBroker.lock()) {
             aasb::message::audio::audioInput::StopAudioInputMessage message;
             message.payload.streamId = streamId;
@@ -133,28 +153,61 @@ bool AASBAudioInput::stopAudioInput() {
 }
 
 //
-// AudioInputStreamHandler
+// audio input stream
 //
 
-AASBAudioInput::AudioInputStreamHandler::AudioInputStreamHandler(std::shared_ptr<AASBAudioInput> audioInput) :
-        m_audioInput(audioInput) {
-}
+void AASBAudioInput::processStream(
+    std::weak_ptr<AASBAudioInput> weakSelf,
+    std::shared_ptr<aace::aasb::AASBRingBufferStream> stream) {
+    int16_t samples[AUDIO_INPUT_WRAP_BUFFER_SAMPLES];
+
+    // the audio that was not forwarded when the stream is closed is dropped, so no audio from after
+    // the stop reaches the engine
+    while (stream->isClosed() == false) {
+        // wait for at least one complete sample to be written by the client
+        if (stream->waitForData(AUDIO_INPUT_STREAM_WAIT_TIMEOUT, sizeof(int16_t)) == false ||
+            stream->isClosed()) {
+            continue;
+        }
 
-ssize_t AASBAudioInput::AudioInputStreamHandler::read(char* data, const size_t size) {
-    AACE_ERROR(LX(TAG).d("reason", "invalidOperation"));
-    return -1;
-}
+        // the audio input keeps itself alive while the audio is written, since a callback can stop the
+        // audio input and release it from this thread
+        auto self = weakSelf.lock();
+        if (self == nullptr) {
+            break;
+        }
 
-ssize_t AASBAudioInput::AudioInputStreamHandler::write(const char* data, const size_t size) {
-    return m_audioInput->write((int16_t*)data, size / 2) * 2;
-}
+        const char* data = nullptr;
+        auto size = stream->acquireRead(&data);
 
-bool AASBAudioInput::AudioInputStreamHandler::isClosed() {
-    return m_audioInput->m_expectAudio == false;
+        if (size >= sizeof(int16_t) && reinterpret_cast<uintptr_t>(data) % alignof(int16_t) == 0) {
+            // forward the audio directly from the stream buffer
+            auto count = size / sizeof(int16_t);
+            self->write(reinterpret_cast<const int16_t*>(data), count);
+            stream->commitRead(count * sizeof(int16_t));
+        } else {
+            // copy the samples that wrap around the end of the stream buffer
+            auto count = std::min(stream->getReadableSize() / sizeof(int16_t), AUDIO_INPUT_WRAP_BUFFER_SAMPLES);
+            stream->read(reinterpret_cast<char*>(samples), count * sizeof(int16_t));
+            self->write(samples, count);
+        }
+    }
 }
 
-aace::aasb::AASBStream::Mode AASBAudioInput::AudioInputStreamHandler::getMode() {
-    return aace::aasb::AASBStream::Mode::WRITE;
+void AASBAudioInput::closeStream() {
+    if (m_currentStream != nullptr) {
+        m_currentStream->close();
+        m_currentStream.reset();
+    }
+    if (m_streamThread.joinable()) {
+        // a callback can stop the audio input from inside write() on the stream thread, which cannot join
+        // itself, so the thread is detached and exits when it returns to the closed stream
+        if (m_streamThread.get_id() == std::this_thread::get_id()) {
+            m_streamThread.detach();
+        } else {
+            m_streamThread.join();
+        }
+    }
 }
 
 }  // namespace audio
@@ -33,6 +33,7 @@
 #include <AASB/Message/Audio/AudioOutput/MutedStateChangedMessage.h>
 #include <AASB/Message/Audio/AudioOutput/PauseMessage.h>
 #include <AASB/Message/Audio/AudioOutput/PlayMessage.h>
+#include <AASB/Message/Audio/AudioOutput/PositionUpdatedMessage.h>
 #include <AASB/Message/Audio/AudioOutput/PrepareStreamMessage.h>
 #include <AASB/Message/Audio/AudioOutput/PrepareURLMessage.h>
 #include <AASB/Message/Audio/AudioOutput/ResumeMessage.h>
@@ -42,6 +43,8 @@
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+
 namespace aasb {
 namespace engine {
 namespace audio {
@@ -52,6 +55,10 @@ static const std::string TAG("aasb.audio.AASBAudioOutput");
 // aliases
 using Message = aace::engine::aasb::Message;
 
+// The maximum time the position is extrapolated from the last position reported by the application
+// before it is requested again.
+static const std::chrono::milliseconds MAX_POSITION_EXTRAPOLATION = std::chrono::milliseconds(5000);
+
 AASBAudioOutput::AASBAudioOutput(
     const std::string& name,
     const aace::audio::AudioOutputProvider::AudioOutputType& type) :
@@ -99,9 +106,10 @@ bool AASBAudioOutput::initialize(
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::audio::audioOutput::MediaStateChangedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     if (payload.channel == sp->m_name) {
+                        sp->updateMediaState(payload.token, static_cast<MediaState>(payload.state));
                         sp->mediaStateChanged(static_cast<MediaState>(payload.state));
                     }
                 } catch (std::exception& ex) {
@@ -109,6 +117,31 @@ bool AASBAudioOutput::initialize(
                 }
             });
 
+        //
+        // AudioOutput:PositionUpdated
+        //
+        messageBroker->subscribe(
+            aasb::message::audio::audioOutput::PositionUpdatedMessage::topic(),
+            aasb::message::audio::audioOutput::PositionUpdatedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    aasb::message::audio::audioOutput::PositionUpdatedMessage::Payload payload =
+                        message.payloadJson();
+
+                    if (payload.channel == sp->m_name) {
+                        sp->updatePosition(
+                            payload.token,
+                            payload.position,
+                            payload.duration < 0 ? TIME_UNKNOWN : payload.duration);
+                    }
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "PositionUpdatedMessage").d("reason", ex.what()));
+                }
+            });
+
         //
         // AudioOutput:MediaError
         //
@@ -120,8 +153,7 @@ bool AASBAudioOutput::initialize(
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
-                    aasb::message::audio::audioOutput::MediaErrorMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::audio::audioOutput::MediaErrorMessage::Payload payload = message.payloadJson();
 
                     if (payload.token == sp->m_currentToken) {
                         sp->mediaError(static_cast<MediaError>(payload.error), payload.description);
@@ -157,6 +189,7 @@ bool AASBAudioOutput::prepare(std::shared_ptr<aace::audio::AudioStream> stream,
 
         // generate a unique token id
         m_currentToken = aace::engine::utils::uuid::generateUUID();
+        resetPosition(m_currentToken);
 
         // create the stream handler
         m_handler = std::make_shared<AudioOutputStreamHandler>(stream);
@@ -194,6 +227,7 @@ bool AASBAudioOutput::prepare(const std::string& url, bool repeating) {
 
         // generate a unique token id
         m_currentToken = aace::engine::utils::uuid::generateUUID();
+        resetPosition(m_currentToken);
 
         aasb::message::audio::audioOutput::PrepareURLMessage message;
         message.payload.channel = m_name;
@@ -292,28 +326,15 @@ bool AASBAudioOutput::resume() {
 }
 
 int64_t AASBAudioOutput::getPosition() {
-    try {
-        AACE_VERBOSE(LX(TAG));
-
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
-
-        aasb::message::audio::audioOutput::GetPositionMessage message;
-        message.payload.channel = m_name;
-        message.payload.token = m_currentToken;
-
-        auto result = m_messageBroker_lock->publish(message.toString()).get();
-
-        ThrowIfNot(result.valid(), "waitForMessageResponseFailed");
-
-        aasb::message::audio::audioOutput::GetPositionMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
+    AACE_VERBOSE(LX(TAG));
 
-        return payload.position;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return TIME_UNKNOWN;
+    int64_t position;
+    if (getExtrapolatedPosition(position)) {
+        return position;
     }
+
+    // request the position from the application after a seek, or when the last reported position is too old
+    return requestPosition();
 }
 
 bool AASBAudioOutput::setPosition(int64_t position) {
@@ -328,6 +349,12 @@ bool AASBAudioOutput::setPosition(int64_t position) {
         message.payload.token = m_currentToken;
         message.payload.position = position;
 
+        // the position is requested from the application after a seek
+        {
+            std::lock_guard<std::mutex> lock(m_positionMutex);
+            m_positionValid = false;
+        }
+
         m_messageBroker_lock->publish(message.toString()).send();
 
         return true;
@@ -338,28 +365,16 @@ bool AASBAudioOutput::setPosition(int64_t position) {
 }
 
 int64_t AASBAudioOutput::getDuration() {
-    try {
-        AACE_VERBOSE(LX(TAG));
-
-        auto m_messageBroker_lock = m_messageBroker.lock();
-        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
-
-        aasb::message::audio::audioOutput::GetDurationMessage message;
-        message.payload.channel = m_name;
-        message.payload.token = m_currentToken;
-
-        auto result = m_messageBroker_lock->publish(message.toString()).get();
+    AACE_VERBOSE(LX(TAG));
 
-        ThrowIfNot(result.valid(), "waitForMessageResponseFailed");
-
-        aasb::message::audio::audioOutput::GetDurationMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
-
-        return payload.duration;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return TIME_UNKNOWN;
+    {
+        std::lock_guard<std::mutex> lock(m_positionMutex);
+        if (m_duration != TIME_UNKNOWN) {
+            return m_duration;
+        }
     }
+
+    return requestDuration();
 }
 
 int64_t AASBAudioOutput::getNumBytesBuffered() {
@@ -377,8 +392,7 @@ int64_t AASBAudioOutput::getNumBytesBuffered() {
 
         ThrowIfNot(result.valid(), "waitForMessageResponseFailed");
 
-        aasb::message::audio::audioOutput::GetNumBytesBufferedMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
+        aasb::message::audio::audioOutput::GetNumBytesBufferedMessageReply::Payload payload = result.payloadJson();
 
         return payload.bufferedBytes;
     } catch (std::exception& ex) {
@@ -427,6 +441,133 @@ bool AASBAudioOutput::mutedStateChanged(MutedState state) {
     }
 }
 
+//
+// playback position tracking
+//
+
+void AASBAudioOutput::resetPosition(const std::string& token) {
+    std::lock_guard<std::mutex> lock(m_positionMutex);
+    m_positionToken = token;
+    m_positionValid = true;
+    m_playing = false;
+    m_anchorPosition = 0;
+    m_anchorTime = std::chrono::steady_clock::now();
+    m_duration = TIME_UNKNOWN;
+}
+
+void AASBAudioOutput::updatePosition(const std::string& token, int64_t position, int64_t duration) {
+    std::lock_guard<std::mutex> lock(m_positionMutex);
+
+    // ignore positions reported for a previous source
+    if (token != m_positionToken) {
+        return;
+    }
+
+    m_positionValid = true;
+    m_anchorPosition = position;
+    m_anchorTime = std::chrono::steady_clock::now();
+
+    if (duration != TIME_UNKNOWN) {
+        m_duration = duration;
+    }
+}
+
+void AASBAudioOutput::updateMediaState(const std::string& token, MediaState state) {
+    std::lock_guard<std::mutex> lock(m_positionMutex);
+
+    if (token != m_positionToken) {
+        return;
+    }
+
+    // re-anchor the position at the state transition so that extrapolation starts or stops here
+    auto now = std::chrono::steady_clock::now();
+    m_anchorPosition = getExtrapolatedPositionLocked(now);
+    m_anchorTime = now;
+    m_playing = state == MediaState::PLAYING;
+}
+
+bool AASBAudioOutput::getExtrapolatedPosition(int64_t& position) {
+    std::lock_guard<std::mutex> lock(m_positionMutex);
+
+    auto now = std::chrono::steady_clock::now();
+    if (m_positionValid == false || (m_playing && now - m_anchorTime > MAX_POSITION_EXTRAPOLATION)) {
+        return false;
+    }
+
+    position = getExtrapolatedPositionLocked(now);
+
+    return true;
+}
+
+int64_t AASBAudioOutput::getExtrapolatedPositionLocked(std::chrono::steady_clock::time_point now) {
+    if (m_playing == false) {
+        return m_anchorPosition;
+    }
+
+    auto position =
+        m_anchorPosition + std::chrono::duration_cast<std::chrono::milliseconds>(now - m_anchorTime).count();
+
+    return m_duration != TIME_UNKNOWN ? std::min(position, m_duration) : position;
+}
+
+int64_t AASBAudioOutput::requestPosition() {
+    try {
+        auto m_messageBroker_lock = m_messageBroker.lock();
+        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
+
+        auto token = m_currentToken;
+
+        aasb::message::audio::audioOutput::GetPositionMessage message;
+        message.payload.channel = m_name;
+        message.payload.token = token;
+
+        auto result = m_messageBroker_lock->publish(message.toString()).get();
+
+        ThrowIfNot(result.valid(), "waitForMessageResponseFailed");
+
+        aasb::message::audio::audioOutput::GetPositionMessageReply::Payload payload = result.payloadJson();
+
+        updatePosition(token, payload.position, TIME_UNKNOWN);
+
+        return payload.position;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return TIME_UNKNOWN;
+    }
+}
+
+int64_t AASBAudioOutput::requestDuration() {
+    try {
+        auto m_messageBroker_lock = m_messageBroker.lock();
+        ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
+
+        auto token = m_currentToken;
+
+        aasb::message::audio::audioOutput::GetDurationMessage message;
+        message.payload.channel = m_name;
+        message.payload.token = token;
+
+        auto result = m_messageBroker_lock->publish(message.toString()).get();
+
+        ThrowIfNot(result.valid(), "waitForMessageResponseFailed");
+
+        aasb::message::audio::audioOutput::GetDurationMessageReply::Payload payload = result.payloadJson();
+
+        // the duration of a stream may not be known until it has been buffered, so only known durations are cached
+        if (payload.duration >= 0) {
+            std::lock_guard<std::mutex> lock(m_positionMutex);
+            if (token == m_positionToken) {
+                m_duration = payload.duration;
+            }
+        }
+
+        return payload.duration;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return TIME_UNKNOWN;
+    }
+}
+
 //
 // AudioOutputStreamHandler
 //
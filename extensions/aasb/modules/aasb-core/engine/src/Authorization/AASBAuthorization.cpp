@@ -56,7 +56,7 @@ bool AASBAuthorization::initialize(std::shared_ptr<aace::engine::aasb::MessageBr
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::authorization::authorization::StartAuthorizationMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->startAuthorization(payload.service, payload.data);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -71,7 +71,7 @@ bool AASBAuthorization::initialize(std::shared_ptr<aace::engine::aasb::MessageBr
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::authorization::authorization::CancelAuthorizationMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->cancelAuthorization(payload.service);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -86,7 +86,7 @@ bool AASBAuthorization::initialize(std::shared_ptr<aace::engine::aasb::MessageBr
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::authorization::authorization::SendEventMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->sendEvent(payload.service, payload.event);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -100,8 +100,7 @@ bool AASBAuthorization::initialize(std::shared_ptr<aace::engine::aasb::MessageBr
                 try {
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
-                    aasb::message::authorization::authorization::LogoutMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                    aasb::message::authorization::authorization::LogoutMessage::Payload payload = message.payloadJson();
                     sp->logout(payload.service);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -204,9 +203,8 @@ std::string AASBAuthorization::getAuthorizationData(const std::string& service,
         auto result = m_messageBroker_lock->publish(message.toString()).get();
 
         if (result.valid()) {
-            std::string payload = result.payload();
             aasb::message::authorization::authorization::GetAuthorizationDataMessageReply::Payload replyPayload =
-                nlohmann::json::parse(payload);
+                result.payloadJson();
             AACE_INFO(LX(TAG).m("ReplyReceived"));
             return replyPayload.data;
         } else {
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <nlohmann/json.hpp>
+
 #include <AASB/Engine/Location/AASBLocationEngineService.h>
 #include <AASB/Engine/Location/AASBLocationProvider.h>
 #include <AACE/Engine/AASB/MessageBrokerInterface.h>
@@ -28,11 +30,65 @@ static const std::string TAG("aasb.location.AASBLocationEngineService");
 // Minimum version this module supports
 static const aace::engine::core::Version minRequiredVersion = VERSION("3.0");
 
+// Default maximum age of a cached location
+static const std::chrono::milliseconds DEFAULT_MAX_LOCATION_AGE = std::chrono::milliseconds(5000);
+
 // register the service
 REGISTER_SERVICE(AASBLocationEngineService);
 
 AASBLocationEngineService::AASBLocationEngineService(const aace::engine::core::ServiceDescription& description) :
-        aace::engine::aasb::AASBHandlerEngineService(description, minRequiredVersion, {"LocationProvider"}) {
+        aace::engine::aasb::AASBHandlerEngineService(description, minRequiredVersion, {"LocationProvider"}),
+        m_maxLocationAge(DEFAULT_MAX_LOCATION_AGE),
+        m_prefetchInterval(0) {
+}
+
+bool AASBLocationEngineService::configureAASBInterface(
+    const std::string& name,
+    bool enabled,
+    std::istream& configuration) {
+    try {
+        // call inherited configure method
+        ThrowIfNot(
+            AASBHandlerEngineService::configureAASBInterface(name, enabled, configuration),
+            "configureAASBInterfaceFailed");
+
+        // handle specific interface configuration options
+        if (name == "LocationProvider" && enabled) {
+            ThrowIfNot(configureLocationProvider(configuration), "configureLocationProviderFailed");
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AASBLocationEngineService::configureLocationProvider(std::istream& configuration) {
+    try {
+        auto root = nlohmann::json::parse(configuration);
+
+        auto maxLocationAge = root["/maxLocationAge"_json_pointer];
+        if (maxLocationAge != nullptr) {
+            ThrowIfNot(maxLocationAge.is_number_unsigned(), "invalidMaxLocationAge");
+            m_maxLocationAge = std::chrono::milliseconds(maxLocationAge.get<uint64_t>());
+        }
+
+        auto prefetchInterval = root["/prefetchInterval"_json_pointer];
+        if (prefetchInterval != nullptr) {
+            ThrowIfNot(prefetchInterval.is_number_unsigned(), "invalidPrefetchInterval");
+            m_prefetchInterval = std::chrono::milliseconds(prefetchInterval.get<uint64_t>());
+        }
+
+        AACE_DEBUG(LX(TAG)
+                       .d("maxLocationAge", m_maxLocationAge.count())
+                       .d("prefetchInterval", m_prefetchInterval.count()));
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
 }
 
 bool AASBLocationEngineService::postRegister() {
@@ -43,7 +99,8 @@ bool AASBLocationEngineService::postRegister() {
 
         // LocationProvider
         if (isInterfaceEnabled("LocationProvider")) {
-            auto locationProvider = AASBLocationProvider::create(aasbServiceInterface->getMessageBroker());
+            auto locationProvider = AASBLocationProvider::create(
+                aasbServiceInterface->getMessageBroker(), m_maxLocationAge, m_prefetchInterval);
             ThrowIfNull(locationProvider, "invalidLocationProviderHandler");
             getContext()->registerPlatformInterface(locationProvider);
         }
@@ -21,6 +21,7 @@
 #include <AASB/Message/Location/LocationProvider/GetLocationMessage.h>
 #include <AASB/Message/Location/LocationProvider/GetLocationMessageReply.h>
 #include <AASB/Message/Location/LocationProvider/LocationServiceAccessChangedMessage.h>
+#include <AASB/Message/Location/LocationProvider/LocationUpdatedMessage.h>
 
 namespace aasb {
 namespace engine {
@@ -32,11 +33,40 @@ static const std::string TAG("aasb.location.AASBLocationProvider");
 // aliases
 using Message = aace::engine::aasb::Message;
 
+// Converts a location from an AASB message payload.
+static aace::location::Location toLocation(const aasb::message::location::Location& location) {
+    auto altitude = location.altitude < 0 ? aace::location::Location::UNDEFINED : location.altitude;
+    auto accuracy = location.accuracy < 0 ? aace::location::Location::UNDEFINED : location.accuracy;
+
+    return aace::location::Location(location.latitude, location.longitude, altitude, accuracy);
+}
+
+AASBLocationProvider::AASBLocationProvider(
+    std::chrono::milliseconds maxLocationAge,
+    std::chrono::milliseconds prefetchInterval) :
+        m_maxLocationAge(maxLocationAge), m_prefetchInterval(prefetchInterval) {
+}
+
+AASBLocationProvider::~AASBLocationProvider() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_prefetchTrigger.notify_all();
+
+    if (m_prefetchThread.joinable()) {
+        m_prefetchThread.join();
+    }
+}
+
 std::shared_ptr<AASBLocationProvider> AASBLocationProvider::create(
-    std::shared_ptr<aace::engine::aasb::MessageBrokerInterface> messageBroker) {
+    std::shared_ptr<aace::engine::aasb::MessageBrokerInterface> messageBroker,
+    std::chrono::milliseconds maxLocationAge,
+    std::chrono::milliseconds prefetchInterval) {
     try {
         // create the location provider platform handler
-        auto locationProvider = std::shared_ptr<AASBLocationProvider>(new AASBLocationProvider());
+        auto locationProvider =
+            std::shared_ptr<AASBLocationProvider>(new AASBLocationProvider(maxLocationAge, prefetchInterval));
 
         // initialize the platform handler
         ThrowIfNot(locationProvider->initialize(messageBroker), "initializeFailed");
@@ -69,14 +99,47 @@ bool AASBLocationProvider::initialize(std::shared_ptr<aace::engine::aasb::Messag
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::location::locationProvider::LocationServiceAccessChangedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
+                    // the cached location should not be reported after the access changes
+                    sp->invalidateCache();
                     sp->locationServiceAccessChanged(static_cast<LocationServiceAccess>(payload.access));
 
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG, "LocationServiceAccessChangedMessage").d("reason", ex.what()));
                 }
             });
+
+        //
+        // LocationProvider:LocationUpdated
+        //
+        messageBroker->subscribe(
+            aasb::message::location::locationProvider::LocationUpdatedMessage::topic(),
+            aasb::message::location::locationProvider::LocationUpdatedMessage::action(),
+            [wp](const Message& message) {
+                try {
+                    auto sp = wp.lock();
+                    ThrowIfNull(sp, "invalidWeakPtrReference");
+
+                    aasb::message::location::locationProvider::LocationUpdatedMessage::Payload payload =
+                        message.payloadJson();
+
+                    sp->updateLocation(toLocation(payload.location));
+
+                    if (payload.country.empty() == false) {
+                        sp->updateCountry(payload.country);
+                    }
+
+                } catch (std::exception& ex) {
+                    AACE_ERROR(LX(TAG, "LocationUpdatedMessage").d("reason", ex.what()));
+                }
+            });
+
+        // start requesting the location in the background if prefetching is enabled
+        if (m_maxLocationAge.count() > 0 && m_prefetchInterval.count() > 0) {
+            m_prefetchThread = std::thread(&AASBLocationProvider::prefetchLoop, this);
+        }
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -89,9 +152,47 @@ bool AASBLocationProvider::initialize(std::shared_ptr<aace::engine::aasb::Messag
 //
 
 aace::location::Location AASBLocationProvider::getLocation() {
-    try {
-        AACE_VERBOSE(LX(TAG));
+    AACE_VERBOSE(LX(TAG));
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_locationValid && isFresh(m_locationUpdateTime)) {
+            return m_location;
+        }
+    }
+
+    // request the location from the application if the cached location is too old
+    requestLocation();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_location;
+}
+
+std::string AASBLocationProvider::getCountry() {
+    AACE_VERBOSE(LX(TAG));
 
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_countryValid && isFresh(m_countryUpdateTime)) {
+            return m_country;
+        }
+    }
+
+    // request the country from the application if the cached country is too old
+    if (requestCountry() == false) {
+        return "";
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_country;
+}
+
+//
+// private
+//
+
+bool AASBLocationProvider::requestLocation() {
+    try {
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
@@ -101,26 +202,20 @@ aace::location::Location AASBLocationProvider::getLocation() {
 
         ThrowIfNot(result.valid(), "waitForGetLocationTimeout");
 
-        aasb::message::location::locationProvider::GetLocationMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
-
-        auto altitude = payload.location.altitude < 0 ? aace::location::Location::UNDEFINED : payload.location.altitude;
-        auto accuracy = payload.location.accuracy < 0 ? aace::location::Location::UNDEFINED : payload.location.accuracy;
+        aasb::message::location::locationProvider::GetLocationMessageReply::Payload payload = result.payloadJson();
 
         // parse the location from payload
-        m_location =
-            aace::location::Location(payload.location.latitude, payload.location.longitude, altitude, accuracy);
+        updateLocation(toLocation(payload.location));
+
+        return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
     }
-
-    return m_location;
 }
 
-std::string AASBLocationProvider::getCountry() {
+bool AASBLocationProvider::requestCountry() {
     try {
-        AACE_VERBOSE(LX(TAG));
-
         auto m_messageBroker_lock = m_messageBroker.lock();
         ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
 
@@ -130,13 +225,54 @@ std::string AASBLocationProvider::getCountry() {
 
         ThrowIfNot(result.valid(), "waitForGetCountryTimeout");
 
-        aasb::message::location::locationProvider::GetCountryMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
+        aasb::message::location::locationProvider::GetCountryMessageReply::Payload payload = result.payloadJson();
+
+        updateCountry(payload.country);
 
-        return payload.country;
+        return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
-        return "";
+        return false;
+    }
+}
+
+void AASBLocationProvider::updateLocation(const aace::location::Location& location) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_location = location;
+    m_locationValid = true;
+    m_locationUpdateTime = std::chrono::steady_clock::now();
+}
+
+void AASBLocationProvider::updateCountry(const std::string& country) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_country = country;
+    m_countryValid = true;
+    m_countryUpdateTime = std::chrono::steady_clock::now();
+}
+
+void AASBLocationProvider::invalidateCache() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_locationValid = false;
+    m_countryValid = false;
+}
+
+bool AASBLocationProvider::isFresh(std::chrono::steady_clock::time_point updateTime) {
+    return std::chrono::steady_clock::now() - updateTime <= m_maxLocationAge;
+}
+
+void AASBLocationProvider::prefetchLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_shutdown == false) {
+        // request the location only if it has not been pushed by the application since the last request
+        if (m_locationValid == false ||
+            std::chrono::steady_clock::now() - m_locationUpdateTime >= m_prefetchInterval) {
+            lock.unlock();
+            requestLocation();
+            lock.lock();
+        }
+
+        m_prefetchTrigger.wait_for(lock, m_prefetchInterval, [this]() { return m_shutdown; });
     }
 }
 
@@ -70,7 +70,7 @@ bool AASBNetworkInfoProvider::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     ThrowIfNull(sp, "invalidWeakPtrReference");
 
                     aasb::message::network::networkInfoProvider::NetworkStatusChangedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     // invoke the engine network status changed method
                     sp->networkStatusChanged(static_cast<NetworkStatus>(payload.status), payload.wifiSignalStrength);
@@ -104,7 +104,7 @@ AASBNetworkInfoProvider::NetworkStatus AASBNetworkInfoProvider::getNetworkStatus
         ThrowIfNot(result.valid(), "waitForGetNetworkStatusTimeout");
 
         aasb::message::network::networkInfoProvider::GetNetworkStatusMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
+            result.payloadJson();
 
         return static_cast<NetworkStatus>(payload.status);
     } catch (std::exception& ex) {
@@ -127,7 +127,7 @@ int AASBNetworkInfoProvider::getWifiSignalStrength() {
         ThrowIfNot(result.valid(), "waitForGetWifiSignalStrengthTimeout");
 
         aasb::message::network::networkInfoProvider::GetWifiSignalStrengthMessageReply::Payload payload =
-            nlohmann::json::parse(result.payload());
+            result.payloadJson();
 
         return payload.wifiSignalStrength;
     } catch (std::exception& ex) {
@@ -64,7 +64,7 @@ bool AASBPropertyManager::initialize(std::shared_ptr<aace::engine::aasb::Message
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::propertyManager::propertyManager::SetPropertyMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->setProperty(payload.name, payload.value);
 
                     AACE_INFO(LX(TAG, "SetPropertyMessage").m("MessageRouted"));
@@ -81,7 +81,7 @@ bool AASBPropertyManager::initialize(std::shared_ptr<aace::engine::aasb::Message
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::propertyManager::propertyManager::GetPropertyMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     AACE_INFO(LX(TAG, "GetPropertyMessage").m("MessageRouted"));
 
@@ -0,0 +1,274 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <AASB/Engine/Audio/AASBAudioOutput.h>
+#include <AACE/Engine/AASB/MessageBrokerInterface.h>
+#include <AACE/Engine/AASB/StreamManagerInterface.h>
+
+#include <AASB/Message/Audio/AudioOutput/GetPositionMessage.h>
+#include <AASB/Message/Audio/AudioOutput/GetPositionMessageReply.h>
+#include <AASB/Message/Audio/AudioOutput/MediaStateChangedMessage.h>
+#include <AASB/Message/Audio/AudioOutput/PositionUpdatedMessage.h>
+#include <AASB/Message/Audio/AudioOutput/PrepareURLMessage.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using aace::engine::aasb::Message;
+using aace::engine::aasb::PublishMessage;
+using ::aasb::engine::audio::AASBAudioOutput;
+using MediaState = ::aasb::message::audio::MediaState;
+
+/// The channel name of the audio output used by the tests
+static const std::string CHANNEL = "TestChannel";
+
+/// The time a test waits for the extrapolated position to advance
+static const std::chrono::milliseconds ADVANCE_TIME(100);
+
+/**
+ * Message broker that records the messages published by the audio output, replies to position requests
+ * with a configurable position, and delivers messages from the application to the audio output.
+ */
+class TestMessageBroker : public aace::engine::aasb::MessageBrokerInterface {
+public:
+    void subscribe(const std::string& topic, MessageHandler handler, Message::Direction direction) override {
+    }
+
+    void subscribe(
+        const std::string& topic,
+        const std::string& action,
+        MessageHandler handler,
+        Message::Direction direction) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_handlers[topic + "." + action] = handler;
+    }
+
+    PublishMessage publish(const std::string& message, Message::Direction direction) override {
+        return PublishMessage(
+            direction, message, std::chrono::milliseconds(1000), [this](const PublishMessage& pm, bool sync) {
+                return invoke(pm.message(), sync);
+            });
+    }
+
+    void deliver(const std::string& topic, const std::string& action, const std::string& message) {
+        MessageHandler handler;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            handler = m_handlers[topic + "." + action];
+        }
+        handler(Message(message, Message::Direction::INCOMING));
+    }
+
+    std::string getLastToken() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_lastToken;
+    }
+
+    int getPositionRequests() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_positionRequests;
+    }
+
+    void setReportedPosition(int position) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_reportedPosition = position;
+    }
+
+private:
+    Message invoke(const Message& message, bool sync) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (message.action() == ::aasb::message::audio::audioOutput::PrepareURLMessage::action()) {
+            m_lastToken = message.payloadJson().at("token").get<std::string>();
+        }
+
+        if (sync && message.action() == ::aasb::message::audio::audioOutput::GetPositionMessage::action()) {
+            m_positionRequests++;
+
+            ::aasb::message::audio::audioOutput::GetPositionMessageReply reply;
+            reply.header.messageDescription.replyToId = message.messageId();
+            reply.payload.position = m_reportedPosition;
+
+            return Message(reply.toString(), Message::Direction::INCOMING);
+        }
+
+        return Message::INVALID;
+    }
+
+    std::mutex m_mutex;
+    std::map<std::string, MessageHandler> m_handlers;
+    std::string m_lastToken;
+    int m_positionRequests = 0;
+    int m_reportedPosition = 0;
+};
+
+/// Stream manager that accepts every stream handler
+class TestStreamManager : public aace::engine::aasb::StreamManagerInterface {
+public:
+    bool registerStreamHandler(const std::string& streamId, std::shared_ptr<aace::aasb::AASBStream> stream) override {
+        return true;
+    }
+
+    std::shared_ptr<aace::aasb::AASBStream> requestStreamHandler(
+        const std::string& streamId,
+        aace::aasb::AASBStream::Mode mode) override {
+        return nullptr;
+    }
+};
+
+/// Test harness for @c AASBAudioOutput class
+class AASBAudioOutputTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_messageBroker = std::make_shared<TestMessageBroker>();
+        m_streamManager = std::make_shared<TestStreamManager>();
+        m_audioOutput = AASBAudioOutput::create(
+            CHANNEL, aace::audio::AudioOutputProvider::AudioOutputType::MUSIC, m_messageBroker, m_streamManager);
+        ASSERT_NE(nullptr, m_audioOutput);
+    }
+
+protected:
+    std::string prepare() {
+        EXPECT_TRUE(m_audioOutput->prepare("https://example.com/audio.mp3", false));
+        return m_messageBroker->getLastToken();
+    }
+
+    void reportMediaState(const std::string& token, MediaState state) {
+        ::aasb::message::audio::audioOutput::MediaStateChangedMessage message;
+        message.payload.channel = CHANNEL;
+        message.payload.token = token;
+        message.payload.state = state;
+        m_messageBroker->deliver(message.topic(), message.action(), message.toString());
+    }
+
+    void reportPosition(const std::string& token, int64_t position, int64_t duration = -1) {
+        ::aasb::message::audio::audioOutput::PositionUpdatedMessage message;
+        message.payload.channel = CHANNEL;
+        message.payload.token = token;
+        message.payload.position = position;
+        message.payload.duration = duration;
+        m_messageBroker->deliver(message.topic(), message.action(), message.toString());
+    }
+
+    std::shared_ptr<TestMessageBroker> m_messageBroker;
+    std::shared_ptr<TestStreamManager> m_streamManager;
+    std::shared_ptr<AASBAudioOutput> m_audioOutput;
+};
+
+/**
+ * Test that the position is extrapolated from the last reported position while playing, and that preparing a
+ * new source starts again at zero without requesting the position.
+ */
+TEST_F(AASBAudioOutputTest, prepareResetsPosition) {
+    auto token = prepare();
+    EXPECT_EQ(0, m_audioOutput->getPosition());
+
+    reportMediaState(token, MediaState::PLAYING);
+    reportPosition(token, 10000);
+    std::this_thread::sleep_for(ADVANCE_TIME);
+
+    auto position = m_audioOutput->getPosition();
+    EXPECT_GE(position, 10000 + ADVANCE_TIME.count());
+    EXPECT_LT(position, 15000);
+
+    auto nextToken = prepare();
+    ASSERT_NE(token, nextToken);
+    EXPECT_EQ(0, m_audioOutput->getPosition());
+
+    // positions reported for the previous source are ignored
+    reportPosition(token, 20000);
+    EXPECT_EQ(0, m_audioOutput->getPosition());
+    EXPECT_EQ(0, m_messageBroker->getPositionRequests());
+}
+
+/**
+ * Test that the position does not advance while playback is paused or buffering, and advances again from the
+ * same position when playback resumes.
+ */
+TEST_F(AASBAudioOutputTest, positionFreezesWhilePausedOrBuffering) {
+    auto token = prepare();
+    reportMediaState(token, MediaState::PLAYING);
+    reportPosition(token, 1000);
+    std::this_thread::sleep_for(ADVANCE_TIME);
+
+    reportMediaState(token, MediaState::STOPPED);
+    auto paused = m_audioOutput->getPosition();
+    EXPECT_GE(paused, 1000 + ADVANCE_TIME.count());
+    std::this_thread::sleep_for(ADVANCE_TIME);
+    EXPECT_EQ(paused, m_audioOutput->getPosition());
+
+    reportMediaState(token, MediaState::PLAYING);
+    reportMediaState(token, MediaState::BUFFERING);
+    auto buffering = m_audioOutput->getPosition();
+    std::this_thread::sleep_for(ADVANCE_TIME);
+    EXPECT_EQ(buffering, m_audioOutput->getPosition());
+
+    reportMediaState(token, MediaState::PLAYING);
+    std::this_thread::sleep_for(ADVANCE_TIME);
+    EXPECT_GE(m_audioOutput->getPosition(), buffering + ADVANCE_TIME.count());
+    EXPECT_EQ(0, m_messageBroker->getPositionRequests());
+}
+
+/**
+ * Test that the extrapolated position does not pass the duration reported by the application.
+ */
+TEST_F(AASBAudioOutputTest, positionStopsAtDuration) {
+    auto token = prepare();
+    reportMediaState(token, MediaState::PLAYING);
+    reportPosition(token, 1000, 1010);
+    std::this_thread::sleep_for(ADVANCE_TIME);
+
+    EXPECT_EQ(1010, m_audioOutput->getPosition());
+    EXPECT_EQ(1010, m_audioOutput->getDuration());
+}
+
+/**
+ * Test that the position is requested from the application after a seek, and when the last reported position
+ * is older than the maximum extrapolation time while playing.
+ */
+TEST_F(AASBAudioOutputTest, positionIsRequestedWhenNotKnown) {
+    auto token = prepare();
+    reportMediaState(token, MediaState::PLAYING);
+    reportPosition(token, 1000);
+
+    m_messageBroker->setReportedPosition(30000);
+    EXPECT_TRUE(m_audioOutput->setPosition(30000));
+    EXPECT_EQ(30000, m_audioOutput->getPosition());
+    EXPECT_EQ(1, m_messageBroker->getPositionRequests());
+
+    // the requested position is extrapolated until it is older than the maximum extrapolation time
+    EXPECT_GE(m_audioOutput->getPosition(), 30000);
+    EXPECT_EQ(1, m_messageBroker->getPositionRequests());
+
+    m_messageBroker->setReportedPosition(40000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5100));
+    EXPECT_EQ(40000, m_audioOutput->getPosition());
+    EXPECT_EQ(2, m_messageBroker->getPositionRequests());
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -141,7 +141,7 @@ inline void from_json(const nlohmann::json& j, UpdateMessagesStatusFailedMessage
 
 inline std::string UpdateMessagesStatusFailedMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace messaging
@@ -60,7 +60,7 @@ bool AASBMessaging::initialize(std::shared_ptr<aace::engine::aasb::MessageBroker
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::messaging::messaging::ConversationsReportMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->conversationsReport(payload.token, payload.conversations);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -75,7 +75,7 @@ bool AASBMessaging::initialize(std::shared_ptr<aace::engine::aasb::MessageBroker
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::messaging::messaging::SendMessageFailedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->sendMessageFailed(payload.token, static_cast<ErrorCode>(payload.code), payload.message);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -90,7 +90,7 @@ bool AASBMessaging::initialize(std::shared_ptr<aace::engine::aasb::MessageBroker
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::messaging::messaging::SendMessageSucceededMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->sendMessageSucceeded(payload.token);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -105,7 +105,7 @@ bool AASBMessaging::initialize(std::shared_ptr<aace::engine::aasb::MessageBroker
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::messaging::messaging::UpdateMessagesStatusFailedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->updateMessagesStatusFailed(
                         payload.token, static_cast<ErrorCode>(payload.code), payload.message);
                 } catch (std::exception& ex) {
@@ -121,7 +121,7 @@ bool AASBMessaging::initialize(std::shared_ptr<aace::engine::aasb::MessageBroker
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::messaging::messaging::UpdateMessagesStatusSucceededMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->updateMessagesStatusSucceeded(payload.token);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -136,7 +136,7 @@ bool AASBMessaging::initialize(std::shared_ptr<aace::engine::aasb::MessageBroker
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::messaging::messaging::UpdateMessagingEndpointStateMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->updateMessagingEndpointState(
                         static_cast<ConnectionState>(payload.connectionState),
                         static_cast<PermissionState>(payload.sendPermission),
@@ -125,7 +125,7 @@ inline void from_json(const nlohmann::json& j, ShowPreviousWaypointsMessage& c)
 
 inline std::string ShowPreviousWaypointsMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace navigation
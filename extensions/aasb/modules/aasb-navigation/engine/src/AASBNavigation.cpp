@@ -77,7 +77,7 @@ bool AASBNavigation::initialize(std::shared_ptr<aace::engine::aasb::MessageBroke
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::navigation::navigation::NavigationEventMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->navigationEvent(static_cast<EventName>(payload.event));
 
                     AACE_INFO(LX(TAG, "NavigationEventMessage").m("MessageRouted"));
@@ -94,7 +94,7 @@ bool AASBNavigation::initialize(std::shared_ptr<aace::engine::aasb::MessageBroke
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::navigation::navigation::NavigationErrorMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->navigationError(
                         static_cast<ErrorType>(payload.type),
                         static_cast<ErrorCode>(payload.code),
@@ -114,7 +114,7 @@ bool AASBNavigation::initialize(std::shared_ptr<aace::engine::aasb::MessageBroke
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::navigation::navigation::ShowAlternativeRoutesSucceededMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->showAlternativeRoutesSucceeded(payload.payload);
 
                     AACE_INFO(LX(TAG, "ShowAlternativeRoutesSucceededMessage").m("MessageRouted"));
@@ -230,9 +230,8 @@ std::string AASBNavigation::getNavigationState() {
         auto result = m_messageBroker_lock->publish(message.toString()).get();
 
         if (result.valid()) {
-            std::string payload = result.payload();
             aasb::message::navigation::navigation::GetNavigationStateMessageReply::Payload replyPayload =
-                nlohmann::json::parse(payload);
+                result.payloadJson();
             m_cachedNavState = replyPayload.navigationState;
         }
 
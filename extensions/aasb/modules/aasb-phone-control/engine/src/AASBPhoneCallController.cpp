@@ -119,7 +119,7 @@ bool AASBPhoneCallController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::phoneCallController::phoneCallController::ConnectionStateChangedMessage::Payload
-                        payload = nlohmann::json::parse(message.payload());
+                        payload = message.payloadJson();
                     sp->connectionStateChanged(static_cast<ConnectionState>(payload.state));
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG, "ConnectionStateChangedMessage").d("reason", ex.what()));
@@ -134,7 +134,7 @@ bool AASBPhoneCallController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::phoneCallController::phoneCallController::CallStateChangedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->callStateChanged(static_cast<CallState>(payload.state), payload.callId, payload.callerId);
                 } catch (std::exception& ex) {
@@ -150,7 +150,7 @@ bool AASBPhoneCallController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::phoneCallController::phoneCallController::CallFailedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->callFailed(payload.callId, static_cast<CallError>(payload.code), payload.message);
                 } catch (std::exception& ex) {
@@ -166,7 +166,7 @@ bool AASBPhoneCallController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::phoneCallController::phoneCallController::CallerIdReceivedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->callerIdReceived(payload.callId, payload.callerId);
                 } catch (std::exception& ex) {
@@ -182,7 +182,7 @@ bool AASBPhoneCallController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::phoneCallController::phoneCallController::SendDTMFSucceededMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->sendDTMFSucceeded(payload.callId);
                 } catch (std::exception& ex) {
@@ -198,7 +198,7 @@ bool AASBPhoneCallController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::phoneCallController::phoneCallController::SendDTMFFailedMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     sp->sendDTMFFailed(payload.callId, static_cast<DTMFError>(payload.code), payload.message);
                 } catch (std::exception& ex) {
@@ -214,7 +214,7 @@ bool AASBPhoneCallController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::phoneCallController::phoneCallController::DeviceConfigurationUpdatedMessage::Payload
-                        payload = nlohmann::json::parse(message.payload());
+                        payload = message.payloadJson();
                     auto configurationMapString = nlohmann::json::parse(payload.configurationMap);
 
                     std::unordered_map<CallingDeviceConfigurationProperty, bool> configurationMap;
@@ -240,7 +240,7 @@ bool AASBPhoneCallController::initialize(std::shared_ptr<aace::engine::aasb::Mes
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::phoneCallController::phoneCallController::CreateCallIdMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
 
                     auto m_messageBroker_lock = sp->m_messageBroker.lock();
                     ThrowIfNull(m_messageBroker_lock, "invalidMessageBrokerReference");
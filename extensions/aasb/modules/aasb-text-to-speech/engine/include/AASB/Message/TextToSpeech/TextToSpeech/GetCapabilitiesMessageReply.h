@@ -133,7 +133,7 @@ inline void from_json(const nlohmann::json& j, GetCapabilitiesMessageReply& c) {
 
 inline std::string GetCapabilitiesMessageReply::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace textToSpeech
@@ -157,7 +157,7 @@ inline void from_json(const nlohmann::json& j, PrepareSpeechCompletedMessage& c)
 
 inline std::string PrepareSpeechCompletedMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace textToSpeech
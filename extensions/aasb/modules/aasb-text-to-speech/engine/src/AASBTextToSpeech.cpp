@@ -68,7 +68,7 @@ bool AASBTextToSpeech::initialize(
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::textToSpeech::textToSpeech::PrepareSpeechMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->prepareSpeech(payload.speechId, payload.text, payload.provider, payload.options);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -83,7 +83,7 @@ bool AASBTextToSpeech::initialize(
                     auto sp = wp.lock();
                     ThrowIfNull(sp, "invalidWeakPtrReference");
                     aasb::message::textToSpeech::textToSpeech::GetCapabilitiesMessage::Payload payload =
-                        nlohmann::json::parse(message.payload());
+                        message.payloadJson();
                     sp->getCapabilities(message.messageId(), payload.provider);
                 } catch (std::exception& ex) {
                     AACE_ERROR(LX(TAG).d("reason", ex.what()));
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <AACE/AASB/AASBRingBufferStream.h>
+
+using aace::aasb::AASBRingBufferStream;
+using aace::aasb::AASBStream;
+
+static constexpr size_t STREAM_CAPACITY = 64 * 1024;
+
+/**
+ * Measures writing and reading a chunk through the copying @c AASBStream interface. The argument is
+ * the chunk size in bytes.
+ */
+static void BM_AASBStreamCopy(benchmark::State& state) {
+    auto stream = AASBRingBufferStream::create(STREAM_CAPACITY, AASBStream::Mode::READ);
+    auto size = static_cast<size_t>(state.range(0));
+
+    std::vector<char> input(size, 'a');
+    std::vector<char> output(size);
+
+    for (auto _ : state) {
+        stream->write(input.data(), size);
+        benchmark::DoNotOptimize(stream->read(output.data(), size));
+    }
+
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_AASBStreamCopy)->Arg(320)->Arg(4096)->Arg(16384);
+
+/**
+ * Measures producing and consuming a chunk in place, without the intermediate copies made by
+ * @c read() and @c write(). The argument is the chunk size in bytes.
+ */
+static void BM_AASBStreamInPlace(benchmark::State& state) {
+    auto stream = AASBRingBufferStream::create(STREAM_CAPACITY, AASBStream::Mode::READ);
+    auto size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        for (size_t written = 0; written < size;) {
+            char* region = nullptr;
+            auto available = std::min(stream->acquireWrite(&region), size - written);
+            std::memset(region, 'a', available);
+            stream->commitWrite(available);
+            written += available;
+        }
+        for (size_t read = 0; read < size;) {
+            const char* region = nullptr;
+            auto available = std::min(stream->acquireRead(&region), size - read);
+            benchmark::DoNotOptimize(region);
+            stream->commitRead(available);
+            read += available;
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_AASBStreamInPlace)->Arg(320)->Arg(4096)->Arg(16384);
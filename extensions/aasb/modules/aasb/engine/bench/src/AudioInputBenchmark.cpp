@@ -0,0 +1,74 @@
+/*
+ * Copyright 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <AACE/Audio/AudioInput.h>
+#include <AACE/Engine/Audio/AudioInputEngineImpl.h>
+
+using aace::engine::audio::AudioInputEngineImpl;
+
+// 10ms of 16kHz mono audio
+static constexpr size_t SAMPLES_PER_CHUNK = 160;
+
+/**
+ * Platform audio input that does not capture audio, the benchmark writes the samples to the engine.
+ */
+class BenchmarkAudioInput : public aace::audio::AudioInput {
+public:
+    bool startAudioInput() override {
+        return true;
+    }
+    bool stopAudioInput() override {
+        return true;
+    }
+};
+
+/**
+ * Measures the cost of fanning out the audio written by the platform to the audio input channels.
+ * The argument is the number of channels, and each channel copies the samples into its own buffer
+ * like a shared data stream writer would.
+ */
+static void BM_AudioInputWrite(benchmark::State& state) {
+    auto platformAudioInput = std::make_shared<BenchmarkAudioInput>();
+    auto audioInputEngineImpl = AudioInputEngineImpl::create(platformAudioInput);
+    auto consumers = static_cast<size_t>(state.range(0));
+
+    std::vector<std::vector<int16_t>> buffers(consumers, std::vector<int16_t>(SAMPLES_PER_CHUNK));
+    std::vector<AudioInputEngineImpl::ChannelId> channels;
+    for (auto& buffer : buffers) {
+        auto* destination = buffer.data();
+        channels.push_back(audioInputEngineImpl->start([destination](const int16_t* data, const size_t size) {
+            std::memcpy(destination, data, std::min(size, SAMPLES_PER_CHUNK) * sizeof(int16_t));
+        }));
+    }
+
+    std::vector<int16_t> samples(SAMPLES_PER_CHUNK, 0x1234);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(audioInputEngineImpl->write(samples.data(), samples.size()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * SAMPLES_PER_CHUNK * sizeof(int16_t));
+
+    for (auto id : channels) {
+        audioInputEngineImpl->stop(id);
+    }
+    audioInputEngineImpl->doShutdown();
+}
+BENCHMARK(BM_AudioInputWrite)->Arg(0)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <AACE/Engine/AASB/Message.h>
+#include <AASB/Message/Audio/AudioOutput/MediaStateChangedMessage.h>
+#include <AASB/Message/Audio/AudioOutput/PrepareStreamMessage.h>
+#include <AASB/Message/Navigation/Navigation/StartNavigationMessage.h>
+
+using aace::engine::aasb::Message;
+using aasb::message::audio::AudioOutputAudioType;
+using aasb::message::audio::AudioStreamEncoding;
+using aasb::message::audio::MediaState;
+using aasb::message::audio::audioOutput::MediaStateChangedMessage;
+using aasb::message::audio::audioOutput::PrepareStreamMessage;
+using aasb::message::navigation::navigation::StartNavigationMessage;
+
+template <typename T>
+static T createMessage();
+
+template <>
+PrepareStreamMessage createMessage<PrepareStreamMessage>() {
+    PrepareStreamMessage message;
+    message.payload.channel = "SpeechSynthesizer";
+    message.payload.audioType = AudioOutputAudioType::TTS;
+    message.payload.token = "9f8a3c1e-5b7d-4e2a-8c6f-1d0b2a4e6c8f";
+    message.payload.streamId = "3b2e7d4a-1c6f-4a8e-9d5b-7f0c2e4a6b8d";
+    message.payload.repeating = false;
+    message.payload.encoding = AudioStreamEncoding::MP3;
+    return message;
+}
+
+template <>
+MediaStateChangedMessage createMessage<MediaStateChangedMessage>() {
+    MediaStateChangedMessage message;
+    message.payload.channel = "AudioPlayer";
+    message.payload.token = "9f8a3c1e-5b7d-4e2a-8c6f-1d0b2a4e6c8f";
+    message.payload.state = MediaState::PLAYING;
+    return message;
+}
+
+template <>
+StartNavigationMessage createMessage<StartNavigationMessage>() {
+    StartNavigationMessage message;
+    message.payload.payload =
+        R"({"transportationMode":"DRIVING","waypoints":[)"
+        R"({"type":"SOURCE","address":{"addressLine1":"2795 Augustine Drive","city":"Santa Clara",)"
+        R"("stateOrRegion":"CA","postalCode":"95054","countryCode":"US"},"coordinate":[37.3809385,-121.9794862]},)"
+        R"({"type":"DESTINATION","address":{"addressLine1":"750 Castro Street","city":"Mountain View",)"
+        R"("stateOrRegion":"CA","postalCode":"94041","countryCode":"US"},"coordinate":[37.3894162,-122.0827377],)"
+        R"("name":"Starbucks","pointOfInterest":{"id":"AlexaLocalSearch","hoursOfOperation":[)"
+        R"({"dayOfWeek":"MONDAY","hours":[{"open":"08:00:00-08:00","close":"22:00:00-08:00"}],"type":"OPEN_DURING_HOURS"})"
+        R"(],"phoneNumber":"+14082955501"}}]})";
+    return message;
+}
+
+/**
+ * Measures parsing a serialized message and converting its payload to the generated payload type,
+ * which is the work done for every message received by an AASB handler.
+ */
+template <typename T>
+static void BM_MessageParse(benchmark::State& state) {
+    auto serialized = createMessage<T>().toString();
+
+    for (auto _ : state) {
+        Message parsed(serialized, Message::Direction::INCOMING);
+        auto payload = parsed.payload<typename T::Payload>();
+        benchmark::DoNotOptimize(payload);
+    }
+
+    state.SetBytesProcessed(state.iterations() * serialized.size());
+}
+BENCHMARK_TEMPLATE(BM_MessageParse, PrepareStreamMessage);
+BENCHMARK_TEMPLATE(BM_MessageParse, MediaStateChangedMessage);
+BENCHMARK_TEMPLATE(BM_MessageParse, StartNavigationMessage);
+
+/**
+ * Measures serializing a generated message, which is the work done for every message published
+ * by an AASB handler.
+ */
+template <typename T>
+static void BM_MessageSerialize(benchmark::State& state) {
+    auto message = createMessage<T>();
+    int64_t bytes = 0;
+
+    for (auto _ : state) {
+        auto serialized = message.toString();
+        bytes += serialized.size();
+        benchmark::DoNotOptimize(serialized);
+    }
+
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK_TEMPLATE(BM_MessageSerialize, PrepareStreamMessage);
+BENCHMARK_TEMPLATE(BM_MessageSerialize, MediaStateChangedMessage);
+BENCHMARK_TEMPLATE(BM_MessageSerialize, StartNavigationMessage);
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <AACE/Engine/AASB/MessageBroker.h>
+
+using aace::engine::aasb::Message;
+using aace::engine::aasb::MessageBroker;
+
+static const std::string TOPIC = "Benchmark";
+
+static std::string createPublishMessage(const std::string& id, const std::string& topic, const std::string& action) {
+    return R"({"header":{"version":"3.2","messageType":"Publish","id":")" + id +
+           R"(","messageDescription":{"topic":")" + topic + R"(","action":")" + action +
+           R"("}},"payload":{"channel":"SpeechSynthesizer","token":"token","state":"PLAYING"}})";
+}
+
+static std::string createReplyMessage(
+    const std::string& replyToId,
+    const std::string& topic,
+    const std::string& action) {
+    return R"({"header":{"version":"3.2","messageType":"Reply","id":"reply-)" + replyToId +
+           R"(","messageDescription":{"topic":")" + topic + R"(","action":")" + action + R"(","replyToId":")" +
+           replyToId + R"("}},"payload":{"position":1000}})";
+}
+
+/**
+ * Measures the throughput of asynchronous messages published with @c send(), including the delivery
+ * to the subscriber. The argument is the number of topics, which are delivered by the same number of
+ * message lanes.
+ */
+static void BM_MessageBrokerPublishSend(benchmark::State& state) {
+    auto broker = MessageBroker::create();
+    auto topics = static_cast<std::size_t>(state.range(0));
+    broker->setMessageLanes(topics);
+
+    std::atomic<int64_t> received{0};
+    std::vector<std::string> messages;
+    for (std::size_t j = 0; j < topics; j++) {
+        auto topic = TOPIC + std::to_string(j);
+        broker->subscribe(
+            topic, "Send", [&received](const Message& message) { received++; }, Message::Direction::OUTGOING);
+        messages.push_back(createPublishMessage("send-" + std::to_string(j), topic, "Send"));
+    }
+
+    int64_t sent = 0;
+    for (auto _ : state) {
+        broker->publish(messages[sent % topics]).send();
+        sent++;
+    }
+
+    // include the delivery of the queued messages in the measurement
+    while (received.load() < sent) {
+        std::this_thread::yield();
+    }
+
+    state.SetItemsProcessed(sent);
+    broker->shutdown();
+}
+BENCHMARK(BM_MessageBrokerPublishSend)->Arg(1)->Arg(4)->UseRealTime();
+
+/**
+ * Measures the round trip latency of a synchronous message published with @c get(), which is
+ * answered by a subscriber replying on the message lane.
+ */
+static void BM_MessageBrokerPublishGet(benchmark::State& state) {
+    auto broker = MessageBroker::create();
+    std::weak_ptr<MessageBroker> wp = broker;
+
+    auto reply = createReplyMessage("get", TOPIC, "GetPosition");
+    broker->subscribe(
+        TOPIC,
+        "GetPosition",
+        [wp, reply](const Message& message) {
+            if (auto sp = wp.lock()) {
+                sp->publish(reply, Message::Direction::INCOMING).send();
+            }
+        },
+        Message::Direction::OUTGOING);
+
+    auto message = createPublishMessage("get", TOPIC, "GetPosition");
+    for (auto _ : state) {
+        auto result = broker->publish(message).get();
+        if (!result.valid()) {
+            state.SkipWithError("invalid reply");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    broker->shutdown();
+}
+BENCHMARK(BM_MessageBrokerPublishGet)->UseRealTime();
+
+/**
+ * Measures the cost of publishing a message that does not have any subscribers, which is the
+ * overhead of parsing and routing the message on the publishing thread.
+ */
+static void BM_MessageBrokerPublishUnrouted(benchmark::State& state) {
+    auto broker = MessageBroker::create();
+    auto message = createPublishMessage("unrouted", TOPIC, "Unrouted");
+
+    for (auto _ : state) {
+        broker->publish(message).send();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    broker->shutdown();
+}
+BENCHMARK(BM_MessageBrokerPublishUnrouted);
@@ -17,6 +17,7 @@
 #define AACE_ENGINE_AASB_MESSAGE_H
 
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include <nlohmann/json.hpp>
@@ -25,6 +26,12 @@ namespace aace {
 namespace engine {
 namespace aasb {
 
+/**
+ * An immutable, parsed AASB message. The message JSON is parsed once when the
+ * message is created, and the parsed representation is shared by all copies of
+ * the message, so passing a @c Message between executors and subscribers does
+ * not copy or re-parse the message content.
+ */
 class Message {
 private:
     Message();
@@ -52,21 +59,41 @@ public:
     // payload
     const std::string payload() const;
 
-    // serialize
+    /**
+     * Returns the parsed message payload without serializing it. A null json
+     * value is returned if the message does not contain a payload object.
+     */
+    const nlohmann::json& payloadJson() const;
+
+    /**
+     * Converts the parsed message payload directly into the specified type,
+     * which is typically the @c Payload struct of a generated message. Throws
+     * if the payload cannot be converted.
+     */
+    template <typename T>
+    T payload() const {
+        return payloadJson().get<T>();
+    }
+
+    // serialize (compact)
     const std::string str() const;
 
     // symbolic constants
     static const Message INVALID;
 
 private:
-    nlohmann::json m_message;
-    Direction m_direction;
-    MessageType m_messageType;
-    std::string m_messageId;
-    std::string m_topic;
-    std::string m_action;
-    std::string m_replyTo;
-    std::string m_payload;
+    struct MessageData {
+        nlohmann::json message;
+        Direction direction = Direction::OUTGOING;
+        MessageType messageType = MessageType::PUBLISH;
+        std::string messageId;
+        std::string topic;
+        std::string action;
+        std::string replyTo;
+    };
+
+    // shared, read-only message data
+    std::shared_ptr<const MessageData> m_data;
 };
 
 inline std::ostream& operator<<(std::ostream& stream, const Message::Direction& direction) {
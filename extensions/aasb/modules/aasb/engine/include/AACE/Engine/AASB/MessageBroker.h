@@ -34,20 +34,51 @@ class MessageBroker
         : public MessageBrokerInterface
         , public std::enable_shared_from_this<MessageBroker> {
 private:
-    using SyncPromiseType = std::promise<std::string>;
-
-    MessageBroker() = default;
-
-    std::string getMessageType(
-        Message::Direction direction,
-        const std::string& topic = "*",
-        const std::string& action = "*");
+    using SyncPromiseType = std::promise<Message>;
+
+    // subscription registered with the message broker
+    struct Subscription {
+        Message::Direction direction;
+        std::string topic;
+        std::string action;
+        MessageHandler handler;
+    };
+
+    // handlers subscribed to a topic, precomputed for each subscribed action
+    struct TopicRoute {
+        // handlers for topic:action, followed by the topic:* and *:* handlers
+        std::unordered_map<std::string, std::vector<MessageHandler>> actionHandlers;
+        // handlers for actions without a specific subscriber (topic:* followed by *:*)
+        std::vector<MessageHandler> anyActionHandlers;
+    };
+
+    // read-only table used to resolve all subscribers of a message with a single route lookup
+    struct RoutingTable {
+        std::unordered_map<std::string, TopicRoute> topicRoutes[2];
+        std::vector<MessageHandler> anyTopicHandlers[2];
+
+        const std::vector<MessageHandler>& route(
+            Message::Direction direction,
+            const std::string& topic,
+            const std::string& action) const;
+    };
+
+    MessageBroker();
 
     void publishAsync(const PublishMessage& pm, aace::engine::utils::threading::Executor& executor);
     Message publishSync(const PublishMessage& pm, aace::engine::utils::threading::Executor& executor);
     void reply(const PublishMessage& pm);
 
-    void notifySubscribers(const std::string& type, const Message& message);
+    void notifySubscribers(const Message& message);
+
+    std::shared_ptr<const RoutingTable> buildRoutingTable();
+    std::shared_ptr<const RoutingTable> getRoutingTable();
+
+    void createMessageLanes(std::size_t count);
+    void drainMessageLanes(const std::vector<std::shared_ptr<aace::engine::utils::threading::Executor>>& lanes);
+    std::shared_ptr<aace::engine::utils::threading::Executor> getMessageLane(
+        Message::Direction direction,
+        const std::string& topic);
 
     void addSyncMessagePromise(const std::string& messageId, std::shared_ptr<SyncPromiseType> promise);
     void removeSyncMessagePromise(const std::string& messageId);
@@ -75,13 +106,22 @@ public:
 
     void setMessageTimeout(const std::chrono::milliseconds& value);
 
-private:
-    // executor for deferred asynchronous message sending
-    aace::engine::utils::threading::Executor m_incomingMessageExecutor;
-    aace::engine::utils::threading::Executor m_outgoingMessageExecutor;
+    /**
+     * Sets the number of lanes used to deliver messages in each direction. Each lane
+     * delivers messages on its own executor thread, and all messages for a topic are
+     * delivered in order by the same lane.
+     */
+    void setMessageLanes(std::size_t count);
 
-    // map of subscribers
-    std::unordered_map<std::string, std::vector<MessageHandler>> m_subscriberMap;
+private:
+    // executors for deferred message sending, indexed by message topic
+    std::vector<std::shared_ptr<aace::engine::utils::threading::Executor>> m_incomingMessageLanes;
+    std::vector<std::shared_ptr<aace::engine::utils::threading::Executor>> m_outgoingMessageLanes;
+    std::mutex m_lane_mutex;
+
+    // subscribers in the order they were registered, and the routing table built from them
+    std::vector<Subscription> m_subscriptions;
+    std::shared_ptr<const RoutingTable> m_routingTable;
 
     // mutex and map for handling synchronous messages
     std::mutex m_pub_sub_mutex;
@@ -61,6 +61,10 @@ public:
 protected:
     Message::Direction m_direction;
     std::string m_message;
+
+    // the message is parsed once when the publish message is created, and the
+    // parsed message is shared with the broker and all of the subscribers
+    Message m_parsedMessage;
     InvokeHandler m_invokeHandler;
     std::chrono::milliseconds m_timeout;
     SuccessHandler m_successHandler;
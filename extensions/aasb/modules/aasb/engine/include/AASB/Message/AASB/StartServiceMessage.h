@@ -115,7 +115,7 @@ inline void from_json(const nlohmann::json& j, StartServiceMessage& c) {
 
 inline std::string StartServiceMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace service
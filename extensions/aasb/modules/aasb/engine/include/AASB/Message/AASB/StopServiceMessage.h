@@ -115,7 +115,7 @@ inline void from_json(const nlohmann::json& j, StopServiceMessage& c) {
 
 inline std::string StopServiceMessage::toString() const {
     nlohmann::json j = *this;
-    return j.dump(3);
+    return j.dump();
 }
 
 }  // namespace service
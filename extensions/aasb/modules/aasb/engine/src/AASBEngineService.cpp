@@ -35,6 +35,9 @@ static const std::string TAG("aace.aasb.AASBEngineService");
 // Minimum version this module supports
 static const aace::engine::core::Version m_minRequiredVersion = VERSION("3.0");
 
+/// Maximum number of message lanes in each direction, since each lane has its own thread
+static const uint64_t MAX_MESSAGE_LANES = 64;
+
 // register the service
 REGISTER_SERVICE(AASBEngineService);
 
@@ -95,6 +98,15 @@ bool AASBEngineService::configure(std::shared_ptr<std::istream> configuration) {
 
         m_messageBroker->setMessageTimeout(std::chrono::milliseconds(m_defaultMessageTimeout));
 
+        auto messageLanes = root["/messageLanes"_json_pointer];
+
+        if (messageLanes != nullptr) {
+            ThrowIfNot(messageLanes.is_number_integer() && messageLanes.is_number_unsigned(), "invalidMessageLanes");
+            auto count = messageLanes.get<uint64_t>();
+            ThrowIf(count == 0 || count > MAX_MESSAGE_LANES, "invalidMessageLanes");
+            m_messageBroker->setMessageLanes(static_cast<std::size_t>(count));
+        }
+
         auto version = root["/version"_json_pointer];
         if (version.is_string()) {
             m_configuredVersion = aace::engine::core::Version(version.get<std::string>());
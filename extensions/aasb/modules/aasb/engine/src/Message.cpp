@@ -28,102 +28,118 @@ static const std::string TAG("aace.aasb.Message");
 // symbolic constants
 const Message Message::INVALID = Message();
 
-Message::Message() : m_direction(Direction::OUTGOING) {
+Message::Message() : m_data(std::make_shared<MessageData>()) {
 }
 
 Message::Message(const std::string& msg, Direction direction) {
+    auto data = std::make_shared<MessageData>();
+
     try {
-        m_message = nlohmann::json::parse(msg);
-        ThrowIf(m_message.is_null(), "invalidMessage");
+        data->message = nlohmann::json::parse(msg);
+        ThrowIf(data->message.is_null(), "invalidMessage");
 
-        auto messageType = m_message["/header/messageType"_json_pointer];
+        auto messageType = data->message["/header/messageType"_json_pointer];
         ThrowIfNull(messageType, "missingMessageType");
 
-        auto messageId = m_message["/header/id"_json_pointer];
+        auto messageId = data->message["/header/id"_json_pointer];
         ThrowIfNull(messageId, "missingMessageId");
 
-        m_messageId = messageId;
+        data->messageId = messageId;
 
         if (aace::engine::utils::string::equal(messageType.get<std::string>(), "publish", false)) {
-            m_messageType = MessageType::PUBLISH;
+            data->messageType = MessageType::PUBLISH;
 
-            auto topic = m_message["/header/messageDescription/topic"_json_pointer];
+            auto topic = data->message["/header/messageDescription/topic"_json_pointer];
             ThrowIfNull(topic, "missingMessageTopic");
 
-            auto action = m_message["/header/messageDescription/action"_json_pointer];
+            auto action = data->message["/header/messageDescription/action"_json_pointer];
             ThrowIfNull(action, "missingMessageAction");
 
-            m_topic = topic;
-            m_action = action;
+            data->topic = topic;
+            data->action = action;
         } else if (aace::engine::utils::string::equal(messageType.get<std::string>(), "reply", false)) {
-            m_messageType = MessageType::REPLY;
+            data->messageType = MessageType::REPLY;
 
-            auto replyTo = m_message["/header/messageDescription/replyToId"_json_pointer];
+            auto replyTo = data->message["/header/messageDescription/replyToId"_json_pointer];
             ThrowIfNull(replyTo, "missingReplyTo");
 
-            auto topic = m_message["/header/messageDescription/topic"_json_pointer];
+            auto topic = data->message["/header/messageDescription/topic"_json_pointer];
             ThrowIfNull(topic, "missingMessageTopic");
 
-            auto action = m_message["/header/messageDescription/action"_json_pointer];
+            auto action = data->message["/header/messageDescription/action"_json_pointer];
             ThrowIfNull(action, "missingMessageAction");
 
-            m_replyTo = replyTo;
-            m_topic = topic;
-            m_action = action;
+            data->replyTo = replyTo;
+            data->topic = topic;
+            data->action = action;
         } else {
             Throw("invalidMessgeType");
         }
 
-        m_direction = direction;
+        data->direction = direction;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()).d("msg", msg));
-        m_message = nullptr;
+        data->message = nullptr;
     }
+
+    m_data = data;
 }
 
 const bool Message::valid() const {
-    return m_message.is_null() ? false : true;
+    return m_data->message.is_null() ? false : true;
 }
 
 const std::string& Message::messageId() const {
-    return m_messageId;
+    return m_data->messageId;
 }
 
 const Message::MessageType& Message::messageType() const {
-    return m_messageType;
+    return m_data->messageType;
 }
 
 const std::string& Message::topic() const {
-    return m_topic;
+    return m_data->topic;
 }
 
 const std::string& Message::action() const {
-    return m_action;
+    return m_data->action;
 }
 
 const std::string& Message::replyTo() const {
-    return m_replyTo;
+    return m_data->replyTo;
 }
 
 const std::string Message::payload() const {
     try {
-        auto payloadIt = m_message.find("payload");
-        ThrowIf(payloadIt == m_message.end(), "missingPayloadInMessage");
+        auto payloadIt = m_data->message.find("payload");
+        ThrowIf(payloadIt == m_data->message.end(), "missingPayloadInMessage");
         ThrowIfNot(payloadIt->is_object(), "invalidPayloadType");
 
-        return payloadIt->get<nlohmann::json>().dump(3);
+        return payloadIt->dump();
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return std::string();
     }
 }
 
+const nlohmann::json& Message::payloadJson() const {
+    static const nlohmann::json s_nullPayload;
+
+    auto payloadIt = m_data->message.find("payload");
+    if (payloadIt == m_data->message.end() || payloadIt->is_object() == false) {
+        AACE_ERROR(LX(TAG).d("reason", "missingOrInvalidPayloadInMessage"));
+        return s_nullPayload;
+    }
+
+    return *payloadIt;
+}
+
 const Message::Direction& Message::direction() const {
-    return m_direction;
+    return m_data->direction;
 }
 
 const std::string Message::str() const {
-    return m_message.dump(3);
+    return m_data->message.dump();
 }
 
 }  // namespace aasb
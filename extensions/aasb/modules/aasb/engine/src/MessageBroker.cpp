@@ -16,8 +16,6 @@
 #include <AACE/Engine/AASB/MessageBroker.h>
 #include <AACE/Engine/Core/EngineMacros.h>
 
-#include <sstream>
-
 namespace aace {
 namespace engine {
 namespace aasb {
@@ -25,33 +23,112 @@ namespace aasb {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.aasb.MessageBroker");
 
+// wildcard used to subscribe to all topics or actions
+static const std::string WILDCARD("*");
+
+// default number of message lanes for each message direction
+static const std::size_t DEFAULT_MESSAGE_LANES = 1;
+
 class MessageImpl;
 
+static std::size_t directionIndex(Message::Direction direction) {
+    return direction == Message::Direction::INCOMING ? 0 : 1;
+}
+
+const std::vector<MessageBrokerInterface::MessageHandler>& MessageBroker::RoutingTable::route(
+    Message::Direction direction,
+    const std::string& topic,
+    const std::string& action) const {
+    auto index = directionIndex(direction);
+    auto topicIt = topicRoutes[index].find(topic);
+
+    if (topicIt == topicRoutes[index].end()) {
+        return anyTopicHandlers[index];
+    }
+
+    auto actionIt = topicIt->second.actionHandlers.find(action);
+
+    return actionIt != topicIt->second.actionHandlers.end() ? actionIt->second : topicIt->second.anyActionHandlers;
+}
+
+MessageBroker::MessageBroker() : m_routingTable(std::make_shared<RoutingTable>()) {
+    createMessageLanes(DEFAULT_MESSAGE_LANES);
+}
+
 std::shared_ptr<MessageBroker> MessageBroker::create() {
     return std::shared_ptr<MessageBroker>(new MessageBroker());
 }
 
 void MessageBroker::shutdown() {
-    m_outgoingMessageExecutor.waitForSubmittedTasks();
-    m_incomingMessageExecutor.waitForSubmittedTasks();
+    std::vector<std::shared_ptr<aace::engine::utils::threading::Executor>> outgoingMessageLanes;
+    std::vector<std::shared_ptr<aace::engine::utils::threading::Executor>> incomingMessageLanes;
+    {
+        std::lock_guard<std::mutex> lock(m_lane_mutex);
+        outgoingMessageLanes.swap(m_outgoingMessageLanes);
+        incomingMessageLanes.swap(m_incomingMessageLanes);
+    }
 
-    m_outgoingMessageExecutor.shutdown();
-    m_incomingMessageExecutor.shutdown();
+    drainMessageLanes(outgoingMessageLanes);
+    drainMessageLanes(incomingMessageLanes);
 }
 
-std::string MessageBroker::getMessageType(
+void MessageBroker::createMessageLanes(std::size_t count) {
+    for (auto lanes : {&m_incomingMessageLanes, &m_outgoingMessageLanes}) {
+        lanes->clear();
+
+        for (std::size_t j = 0; j < count; j++) {
+            lanes->push_back(std::make_shared<aace::engine::utils::threading::Executor>());
+        }
+    }
+}
+
+void MessageBroker::drainMessageLanes(
+    const std::vector<std::shared_ptr<aace::engine::utils::threading::Executor>>& lanes) {
+    // the lane lock must not be held here, since the messages being delivered can publish other messages
+    for (auto& next : lanes) {
+        next->waitForSubmittedTasks();
+        next->shutdown();
+    }
+}
+
+void MessageBroker::setMessageLanes(std::size_t count) {
+    try {
+        ThrowIf(count == 0, "invalidMessageLaneCount");
+        AACE_DEBUG(LX(TAG).d("count", count));
+
+        std::vector<std::shared_ptr<aace::engine::utils::threading::Executor>> incomingMessageLanes;
+        std::vector<std::shared_ptr<aace::engine::utils::threading::Executor>> outgoingMessageLanes;
+        {
+            std::lock_guard<std::mutex> lock(m_lane_mutex);
+            ReturnIf(count == m_incomingMessageLanes.size());
+
+            incomingMessageLanes.swap(m_incomingMessageLanes);
+            outgoingMessageLanes.swap(m_outgoingMessageLanes);
+            createMessageLanes(count);
+        }
+
+        // the messages already queued in the previous lanes are delivered before they are released
+        drainMessageLanes(incomingMessageLanes);
+        drainMessageLanes(outgoingMessageLanes);
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).d("count", count));
+    }
+}
+
+std::shared_ptr<aace::engine::utils::threading::Executor> MessageBroker::getMessageLane(
     Message::Direction direction,
-    const std::string& topic,
-    const std::string& action) {
-    std::stringstream str;
+    const std::string& topic) {
+    std::lock_guard<std::mutex> lock(m_lane_mutex);
 
-    str << direction << ":" << (topic.empty() ? "*" : topic) << ":" << (action.empty() ? "*" : action);
+    auto& lanes = direction == Message::Direction::INCOMING ? m_incomingMessageLanes : m_outgoingMessageLanes;
+    ReturnIf(lanes.empty(), nullptr);
 
-    return str.str();
+    // all messages for a topic are delivered by the same lane to preserve their order
+    return lanes[std::hash<std::string>()(topic) % lanes.size()];
 }
 
 void MessageBroker::subscribe(const std::string& topic, MessageHandler handler, Message::Direction direction) {
-    subscribe(topic, "*", handler, direction);
+    subscribe(topic, WILDCARD, handler, direction);
 }
 
 void MessageBroker::subscribe(
@@ -63,19 +140,69 @@ void MessageBroker::subscribe(
         AACE_DEBUG(LX(TAG).d("direction", direction).d("topic", topic).d("action", action));
 
         std::lock_guard<std::mutex> lock(m_pub_sub_mutex);
-        std::string type = getMessageType(direction, topic, action);
 
-        auto it = m_subscriberMap.find(type);
-        if (it != m_subscriberMap.end()) {
-            it->second.push_back(handler);
-        } else {
-            m_subscriberMap[type] = {handler};
-        }
+        m_subscriptions.push_back(
+            {direction, topic.empty() ? WILDCARD : topic, action.empty() ? WILDCARD : action, handler});
+
+        // subscriptions are registered when the engine is configured, so the routing table
+        // is rebuilt here to keep message dispatch down to a single route lookup
+        m_routingTable = buildRoutingTable();
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
     }
 }
 
+std::shared_ptr<const MessageBroker::RoutingTable> MessageBroker::buildRoutingTable() {
+    auto routingTable = std::make_shared<RoutingTable>();
+
+    for (auto direction : {Message::Direction::INCOMING, Message::Direction::OUTGOING}) {
+        auto index = directionIndex(direction);
+        auto& anyTopicHandlers = routingTable->anyTopicHandlers[index];
+        auto& topicRoutes = routingTable->topicRoutes[index];
+
+        // subscribers interested in all topics and actions (*:*)
+        for (auto& next : m_subscriptions) {
+            if (next.direction == direction && next.topic == WILDCARD && next.action == WILDCARD) {
+                anyTopicHandlers.push_back(next.handler);
+            }
+        }
+
+        // subscribers interested in all actions for a topic (topic:*)
+        for (auto& next : m_subscriptions) {
+            if (next.direction == direction && next.topic != WILDCARD && next.action == WILDCARD) {
+                topicRoutes[next.topic].anyActionHandlers.push_back(next.handler);
+            }
+        }
+
+        // subscribers interested in a specific message (topic:action), which are notified
+        // first, followed by the topic:* subscribers and the *:* subscribers
+        for (auto& next : m_subscriptions) {
+            if (next.direction == direction && next.topic != WILDCARD && next.action != WILDCARD) {
+                topicRoutes[next.topic].actionHandlers[next.action].push_back(next.handler);
+            }
+        }
+
+        for (auto& topicRoute : topicRoutes) {
+            auto& route = topicRoute.second;
+            for (auto& actionHandlers : route.actionHandlers) {
+                actionHandlers.second.insert(
+                    actionHandlers.second.end(), route.anyActionHandlers.begin(), route.anyActionHandlers.end());
+                actionHandlers.second.insert(
+                    actionHandlers.second.end(), anyTopicHandlers.begin(), anyTopicHandlers.end());
+            }
+            route.anyActionHandlers.insert(
+                route.anyActionHandlers.end(), anyTopicHandlers.begin(), anyTopicHandlers.end());
+        }
+    }
+
+    return routingTable;
+}
+
+std::shared_ptr<const MessageBroker::RoutingTable> MessageBroker::getRoutingTable() {
+    std::lock_guard<std::mutex> lock(m_pub_sub_mutex);
+    return m_routingTable;
+}
+
 PublishMessage MessageBroker::publish(const std::string& message, Message::Direction direction) {
     // create a wp reference
     std::weak_ptr<MessageBroker> wp = shared_from_this();
@@ -90,16 +217,13 @@ PublishMessage MessageBroker::publish(const std::string& message, Message::Direc
 
             // handle publish message type
             if (msg.messageType() == Message::MessageType::PUBLISH) {
+                auto lane = sp->getMessageLane(pm.direction(), msg.topic());
+                ThrowIfNull(lane, "invalidMessageLane");
+
                 if (sync) {
-                    return sp->publishSync(
-                        pm,
-                        pm.direction() == Message::Direction::INCOMING ? sp->m_incomingMessageExecutor
-                                                                       : sp->m_outgoingMessageExecutor);
+                    return sp->publishSync(pm, *lane);
                 } else {
-                    sp->publishAsync(
-                        pm,
-                        pm.direction() == Message::Direction::INCOMING ? sp->m_incomingMessageExecutor
-                                                                       : sp->m_outgoingMessageExecutor);
+                    sp->publishAsync(pm, *lane);
                     return Message::INVALID;
                 }
             }
@@ -127,23 +251,15 @@ void MessageBroker::publishAsync(const PublishMessage& pm, aace::engine::utils::
     // capture weak ptr reference in callback
     std::weak_ptr<MessageBroker> wp = shared_from_this();
 
-    // We publish asynchronous messages on the executor thread so that all messages
-    // are sequenced in the order which they are published... This has the effect of
-    // blocking asynchronous messages if there is a synchronous message that is
-    // currently blocking the message queue.
-    //
-    // This is intentional behavior, but we may want to support a different, or
-    // additional asynchronous message behavior.
+    // We publish asynchronous messages on the executor thread of the message topic's
+    // lane so that all messages for a topic are sequenced in the order which they are
+    // published. Synchronous messages wait for their reply on the publishing thread,
+    // so a pending reply does not block other messages in the same lane.
     executor.submit([wp, message]() {
         if (auto sp = wp.lock()) {
-            // publish message to listeners interested in this specific message first (topic:action)
-            sp->notifySubscribers(sp->getMessageType(message.direction(), message.topic(), message.action()), message);
-
-            // publish message to listeners interested in all actions for this topic (topic:*)
-            sp->notifySubscribers(sp->getMessageType(message.direction(), message.topic()), message);
-
-            // publish message to listeners interested in all topics and actions (*:*)
-            sp->notifySubscribers(sp->getMessageType(message.direction()), message);
+            // publish message to listeners interested in this specific message (topic:action), all
+            // actions for this topic (topic:*), and all topics and actions (*:*)
+            sp->notifySubscribers(message);
         } else {
             AACE_ERROR(LX(TAG).d("reason", "invalidWeakPtrReference"));
         }
@@ -162,54 +278,45 @@ Message MessageBroker::publishSync(const PublishMessage& pm, aace::engine::utils
         std::shared_ptr<SyncPromiseType> promise = std::make_shared<SyncPromiseType>();
 
         // create a future to receive the promised reply message when it is received
-        std::shared_future<std::string> future(promise->get_future());
+        std::shared_future<Message> future(promise->get_future());
 
         // capture weak ptr reference in callback
         std::weak_ptr<MessageBroker> wp = shared_from_this();
 
-        auto task = executor.submit([wp, message, timeout, promise, future]() {
-            auto sp = wp.lock();
-
+        auto task = executor.submit([wp, message, promise]() {
             try {
+                auto sp = wp.lock();
                 ThrowIfNull(sp, "invalidWeakPtrReference");
 
                 // add the promise to the message sync map
                 sp->addSyncMessagePromise(message.messageId(), promise);
 
-                // notify the subscribers that are interested in this specific message (topic:action)
-                sp->notifySubscribers(
-                    sp->getMessageType(message.direction(), message.topic(), message.action()), message);
-
-                // notify the subscribers that are interested in all actions for this topic (topic:*)
-                sp->notifySubscribers(sp->getMessageType(message.direction(), message.topic()), message);
-
-                // notify the subscribers that are interested in all topics and actions (*:*)
-                sp->notifySubscribers(sp->getMessageType(message.direction()), message);
-
-                // wait for the future
-                ThrowIfNot(future.wait_for(timeout) == std::future_status::ready, "syncMessageTimeout" + message.str());
+                // notify the subscribers that are interested in this specific message (topic:action), all
+                // actions for this topic (topic:*), and all topics and actions (*:*)
+                sp->notifySubscribers(message);
             } catch (std::exception& ex) {
                 AACE_ERROR(LX(TAG).d("reason", ex.what()));
                 promise->set_exception(std::current_exception());
             }
-
-            // if we have a valid message broker then remove the sync message
-            if (sp != nullptr) {
-                sp->removeSyncMessagePromise(message.messageId());
-            }
         });
 
-        // wait for the task to complete
+        // wait for the message to be dispatched to the subscribers
         task.wait();
 
+        // wait for the reply on the publishing thread, so that the dispatch lane is free to
+        // deliver other messages while the reply is pending
+        auto status = future.wait_for(timeout);
+
+        // remove the sync message so a late reply is published as an asynchronous message
+        removeSyncMessagePromise(message.messageId());
+
+        ThrowIfNot(status == std::future_status::ready, "syncMessageTimeout" + message.str());
+
         // make sure the response was valid
         ThrowIfNot(future.valid(), "invalidMessageResponse");
 
         // return the response message
-        return Message(
-            future.get(),
-            message.direction() == Message::Direction::INCOMING ? Message::Direction::OUTGOING
-                                                                : Message::Direction::INCOMING);
+        return future.get();
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         return Message::INVALID;
@@ -225,26 +332,26 @@ void MessageBroker::reply(const PublishMessage& pm) {
         if (promise == nullptr) {
             AACE_VERBOSE(
                 LX(TAG).m("Publishing reply message because no promise is registered"));
-            publishAsync(
-                pm,
-                pm.direction() == Message::Direction::INCOMING ? m_incomingMessageExecutor : m_outgoingMessageExecutor);
+            auto lane = getMessageLane(pm.direction(), message.topic());
+            ThrowIfNull(lane, "invalidMessageLane");
+
+            publishAsync(pm, *lane);
         } else {
-            promise->set_value(message.str());
+            promise->set_value(message);
         }
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
     }
 }
 
-void MessageBroker::notifySubscribers(const std::string& type, const Message& message) {
-    AACE_DEBUG(LX(TAG).d("type", type));
+void MessageBroker::notifySubscribers(const Message& message) {
+    AACE_DEBUG(LX(TAG).d("direction", message.direction()).d("topic", message.topic()).d("action", message.action()));
 
-    //std::lock_guard<std::mutex> pub_sub_lock( m_pub_sub_mutex );
-    auto it = m_subscriberMap.find(type);
-    if (it != m_subscriberMap.end()) {
-        for (auto& next : it->second) {
-            next(message);
-        }
+    // hold a reference to the routing table so it stays valid while the handlers are invoked
+    auto routingTable = getRoutingTable();
+
+    for (auto& next : routingTable->route(message.direction(), message.topic(), message.action())) {
+        next(message);
     }
 }
 
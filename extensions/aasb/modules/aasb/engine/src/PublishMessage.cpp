@@ -29,10 +29,14 @@ PublishMessage::PublishMessage(
     const std::string& message,
     const std::chrono::milliseconds& timeout,
     InvokeHandler invokeHandler) :
-        m_direction(direction), m_message(message), m_timeout(timeout), m_invokeHandler(invokeHandler) {
+        m_direction(direction),
+        m_message(message),
+        m_parsedMessage(message, direction),
+        m_invokeHandler(invokeHandler),
+        m_timeout(timeout) {
 }
 
-PublishMessage::PublishMessage(const PublishMessage& pm) {
+PublishMessage::PublishMessage(const PublishMessage& pm) : m_parsedMessage(pm.m_parsedMessage) {
     m_direction = pm.m_direction;
     m_message = pm.m_message;
     m_timeout = pm.m_timeout;
@@ -102,7 +106,7 @@ const PublishMessage::ErrorHandler PublishMessage::errorHandler() const {
 }
 
 const Message PublishMessage::message() const {
-    return Message(m_message, m_direction);
+    return m_parsedMessage;
 }
 
 const bool PublishMessage::valid() const {
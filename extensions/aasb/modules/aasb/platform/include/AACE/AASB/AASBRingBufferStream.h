@@ -0,0 +1,190 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_AASB_AASB_RING_BUFFER_STREAM_H
+#define AACE_AASB_AASB_RING_BUFFER_STREAM_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "AASBStream.h"
+
+/** @file */
+
+namespace aace {
+namespace aasb {
+
+/**
+ * AASBRingBufferStream is an @c AASBStream backed by a lock-free, single-producer/single-consumer
+ * ring buffer in shared memory. In addition to the copying @c read() and @c write() methods, the
+ * producer and consumer can access the buffer in place with @c acquireWrite()/commitWrite() and
+ * @c acquireRead()/commitRead(), and can block with @c waitForData()/waitForSpace() instead of
+ * polling the stream.
+ *
+ * On Linux the buffer is allocated in a memory file, which can be mapped by another process with
+ * @c AASBRingBufferStream::open(), and the blocking methods wait on a futex in the shared mapping, so
+ * the producer and the consumer can be in different processes. The readiness file descriptor returned
+ * by @c getReadyFd() can be used with @c poll() to wait for data in an event loop, and can be passed to
+ * another process together with the shared memory file descriptor.
+ */
+class AASBRingBufferStream : public AASBStream {
+private:
+    struct SharedState;
+
+    AASBRingBufferStream(Mode mode);
+
+    bool initialize(size_t capacity);
+    bool initialize(int sharedMemoryFd, int readyFd);
+
+    static size_t getDataOffset();
+
+public:
+    /**
+     * Creates a new ring buffer stream.
+     *
+     * @param [in] capacity The minimum capacity of the buffer in bytes. The capacity is rounded up to a power of two.
+     * @param [in] mode The stream @c Mode reported to the client opening the stream.
+     * @return The new stream, or @c nullptr if the buffer could not be allocated.
+     */
+    static std::shared_ptr<AASBRingBufferStream> create(size_t capacity, Mode mode);
+
+    /**
+     * Maps a ring buffer stream created by another process.
+     *
+     * @param [in] sharedMemoryFd The file descriptor returned by @c getSharedMemoryFd() in the process
+     * that created the stream.
+     * @param [in] mode The stream @c Mode.
+     * @param [in] readyFd The file descriptor returned by @c getReadyFd() in the process that created the
+     * stream, or -1 if the readiness file descriptor is not used.
+     * @return The mapped stream, or @c nullptr if the file descriptor does not refer to a ring buffer stream.
+     */
+    static std::shared_ptr<AASBRingBufferStream> open(int sharedMemoryFd, Mode mode, int readyFd = -1);
+
+    virtual ~AASBRingBufferStream();
+
+    // aace::aasb::AASBStream
+    ssize_t read(char* data, const size_t size) override;
+
+    /**
+     * Writes all of the data to the stream, blocking while the buffer is full for up to one second.
+     *
+     * @return The number of bytes written, which is less than @c size if the stream was closed
+     * during the write or the reader did not make space in time, or -1 if the stream was closed
+     * before any data was written.
+     */
+    ssize_t write(const char* data, const size_t size) override;
+    bool isClosed() override;
+    AASBStream::Mode getMode() override;
+
+    /**
+     * Gets the largest contiguous region of the buffer that can be written in place.
+     *
+     * @param [out] data Set to the start of the writable region
+     * @return The number of bytes that can be written to @c data
+     */
+    size_t acquireWrite(char** data);
+
+    /**
+     * Publishes bytes written in place to the region returned by @c acquireWrite().
+     *
+     * @param [in] size The number of bytes written
+     */
+    void commitWrite(size_t size);
+
+    /**
+     * Gets the largest contiguous region of the buffer that can be read in place.
+     *
+     * @param [out] data Set to the start of the readable region
+     * @return The number of bytes that can be read from @c data
+     */
+    size_t acquireRead(const char** data);
+
+    /**
+     * Releases bytes read in place from the region returned by @c acquireRead().
+     *
+     * @param [in] size The number of bytes read
+     */
+    void commitRead(size_t size);
+
+    /**
+     * Blocks until data is available to read, the stream is closed, or the timeout expires.
+     *
+     * @param [in] timeout The maximum time to wait
+     * @param [in] size The minimum number of bytes to wait for
+     * @return @c true if at least @c size bytes are available to read
+     */
+    bool waitForData(const std::chrono::milliseconds& timeout, size_t size = 1);
+
+    /**
+     * Blocks until space is available to write, the stream is closed, or the timeout expires.
+     *
+     * @return @c true if space is available to write
+     */
+    bool waitForSpace(const std::chrono::milliseconds& timeout);
+
+    /**
+     * Closes the stream. Data already written can still be read, and a reader should drain it with
+     * @c read() or @c acquireRead() until @c getReadableSize() returns 0.
+     */
+    void close();
+
+    /// Returns the capacity of the buffer in bytes.
+    size_t getCapacity();
+
+    /// Returns the number of bytes available to read.
+    size_t getReadableSize();
+
+    /// Returns the shared memory file descriptor, or -1 if the buffer can only be shared in this process.
+    int getSharedMemoryFd();
+
+    /**
+     * Returns an event file descriptor that becomes readable when data is written or the stream is
+     * closed, or -1 if readiness file descriptors are not supported on this platform. The file
+     * descriptor is signaled only after it has been requested, and the reader should read the event
+     * counter to clear it.
+     */
+    int getReadyFd();
+
+private:
+    void notify();
+    bool wait(const std::chrono::milliseconds& timeout, std::function<bool()> predicate);
+
+private:
+    const Mode m_mode;
+
+    // shared memory mapping
+    SharedState* m_state = nullptr;
+    char* m_buffer = nullptr;
+    size_t m_capacity = 0;
+    size_t m_mappedSize = 0;
+    int m_sharedMemoryFd = -1;
+
+    // readiness file descriptor
+    int m_readyFd = -1;
+
+    // in process notification, used where a futex is not available
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
+
+}  // namespace aasb
+}  // namespace aace
+
+#endif  // AACE_AASB_AASB_RING_BUFFER_STREAM_H
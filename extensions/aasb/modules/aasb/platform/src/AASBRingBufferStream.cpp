@@ -0,0 +1,413 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/AASB/AASBRingBufferStream.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+namespace aace {
+namespace aasb {
+
+// identifies a shared memory region that contains a ring buffer stream
+static const uint32_t RING_BUFFER_MAGIC = 0x41415342;
+
+// the buffer data starts on a cache line boundary after the shared state
+static const size_t CACHE_LINE_SIZE = 64;
+
+// maximum buffer capacity
+static const size_t MAX_CAPACITY = 1u << 30;
+
+// maximum time a blocking write waits for space before checking if the stream was closed
+static const std::chrono::milliseconds WRITE_WAIT_TIMEOUT = std::chrono::milliseconds(100);
+
+// maximum time a write blocks while the buffer is full, so a writer is not stalled forever if the reader stops reading
+static const std::chrono::milliseconds MAX_WRITE_BLOCKING_TIME = std::chrono::milliseconds(1000);
+
+// Shared state at the start of the mapped region. The write and read indexes are kept on
+// separate cache lines so the producer and the consumer do not contend for the same line.
+// The notification state is shared too, so a producer and a consumer in different processes
+// can wake each other up.
+struct AASBRingBufferStream::SharedState {
+    uint32_t magic;
+    uint32_t capacity;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> writeIndex;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> readIndex;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> closed;
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> waiters;
+    std::atomic<uint32_t> readyFdRequested;
+};
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32-bit integer");
+
+size_t AASBRingBufferStream::getDataOffset() {
+    return (sizeof(SharedState) + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+}
+
+AASBRingBufferStream::AASBRingBufferStream(Mode mode) : m_mode(mode) {
+}
+
+std::shared_ptr<AASBRingBufferStream> AASBRingBufferStream::create(size_t capacity, Mode mode) {
+    auto stream = std::shared_ptr<AASBRingBufferStream>(new AASBRingBufferStream(mode));
+    return stream->initialize(capacity) ? stream : nullptr;
+}
+
+std::shared_ptr<AASBRingBufferStream> AASBRingBufferStream::open(int sharedMemoryFd, Mode mode, int readyFd) {
+    auto stream = std::shared_ptr<AASBRingBufferStream>(new AASBRingBufferStream(mode));
+    return stream->initialize(sharedMemoryFd, readyFd) ? stream : nullptr;
+}
+
+bool AASBRingBufferStream::initialize(size_t capacity) {
+    if (capacity == 0 || capacity > MAX_CAPACITY) {
+        return false;
+    }
+
+    // round the capacity up to a power of two so indexes can be masked
+    m_capacity = 1;
+    while (m_capacity < capacity) {
+        m_capacity <<= 1;
+    }
+
+    m_mappedSize = getDataOffset() + m_capacity;
+
+    void* region = MAP_FAILED;
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+    m_sharedMemoryFd = static_cast<int>(syscall(SYS_memfd_create, "aasb-stream", 0));
+    if (m_sharedMemoryFd >= 0) {
+        if (ftruncate(m_sharedMemoryFd, static_cast<off_t>(m_mappedSize)) == 0) {
+            region = mmap(nullptr, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_sharedMemoryFd, 0);
+        }
+        if (region == MAP_FAILED) {
+            ::close(m_sharedMemoryFd);
+            m_sharedMemoryFd = -1;
+        }
+    }
+#endif
+
+    // fall back to memory that can only be shared within this process
+    if (region == MAP_FAILED) {
+        region = mmap(nullptr, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (region == MAP_FAILED) {
+            return false;
+        }
+    }
+
+    m_state = new (region) SharedState();
+    m_state->magic = RING_BUFFER_MAGIC;
+    m_state->capacity = static_cast<uint32_t>(m_capacity);
+    m_state->writeIndex = 0;
+    m_state->readIndex = 0;
+    m_state->closed = 0;
+    m_state->sequence = 0;
+    m_state->waiters = 0;
+    m_state->readyFdRequested = 0;
+
+    m_buffer = static_cast<char*>(region) + getDataOffset();
+
+#ifdef __linux__
+    m_readyFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
+
+    return true;
+}
+
+bool AASBRingBufferStream::initialize(int sharedMemoryFd, int readyFd) {
+    struct stat info;
+    if (sharedMemoryFd < 0 || fstat(sharedMemoryFd, &info) != 0 ||
+        static_cast<size_t>(info.st_size) <= getDataOffset()) {
+        return false;
+    }
+
+    m_mappedSize = static_cast<size_t>(info.st_size);
+
+    void* region = mmap(nullptr, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, sharedMemoryFd, 0);
+    if (region == MAP_FAILED) {
+        return false;
+    }
+
+    m_state = static_cast<SharedState*>(region);
+    m_capacity = m_state->capacity;
+
+    if (m_state->magic != RING_BUFFER_MAGIC || m_capacity == 0 || (m_capacity & (m_capacity - 1)) != 0 ||
+        getDataOffset() + m_capacity > m_mappedSize) {
+        munmap(region, m_mappedSize);
+        m_state = nullptr;
+        return false;
+    }
+
+    m_buffer = static_cast<char*>(region) + getDataOffset();
+    m_sharedMemoryFd = dup(sharedMemoryFd);
+
+    // the readiness file descriptor refers to the same event counter as in the process that created the stream
+    if (readyFd >= 0) {
+        m_readyFd = fcntl(readyFd, F_DUPFD_CLOEXEC, 0);
+    }
+
+    return true;
+}
+
+AASBRingBufferStream::~AASBRingBufferStream() {
+    if (m_state != nullptr) {
+        munmap(m_state, m_mappedSize);
+    }
+    if (m_sharedMemoryFd >= 0) {
+        ::close(m_sharedMemoryFd);
+    }
+    if (m_readyFd >= 0) {
+        ::close(m_readyFd);
+    }
+}
+
+//
+// aace::aasb::AASBStream
+//
+
+ssize_t AASBRingBufferStream::read(char* data, const size_t size) {
+    size_t count = 0;
+
+    // the readable data may wrap around the end of the buffer
+    while (count < size) {
+        const char* region = nullptr;
+        size_t available = std::min(acquireRead(&region), size - count);
+        if (available == 0) {
+            break;
+        }
+        std::memcpy(data + count, region, available);
+        commitRead(available);
+        count += available;
+    }
+
+    return static_cast<ssize_t>(count);
+}
+
+ssize_t AASBRingBufferStream::write(const char* data, const size_t size) {
+    if (m_state->closed.load()) {
+        return -1;
+    }
+
+    size_t count = 0;
+    auto deadline = std::chrono::steady_clock::now() + MAX_WRITE_BLOCKING_TIME;
+
+    // the writable space may wrap around the end of the buffer, and the write blocks while the
+    // buffer is full so the data is not dropped, until the reader makes space, the stream is
+    // closed, or the reader has not made space for too long
+    while (count < size) {
+        char* region = nullptr;
+        size_t available = std::min(acquireWrite(&region), size - count);
+        if (available == 0) {
+            if (m_state->closed.load() || std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+            waitForSpace(WRITE_WAIT_TIMEOUT);
+            continue;
+        }
+        std::memcpy(region, data + count, available);
+        commitWrite(available);
+        count += available;
+    }
+
+    return count == 0 && size > 0 && m_state->closed.load() ? -1 : static_cast<ssize_t>(count);
+}
+
+bool AASBRingBufferStream::isClosed() {
+    // a writer is done as soon as the stream is closed, and a reader when all of the data has been read
+    return m_state->closed.load() && (m_mode == Mode::WRITE || getReadableSize() == 0);
+}
+
+AASBStream::Mode AASBRingBufferStream::getMode() {
+    return m_mode;
+}
+
+//
+// in place access
+//
+
+size_t AASBRingBufferStream::acquireWrite(char** data) {
+    auto writeIndex = m_state->writeIndex.load(std::memory_order_relaxed);
+    auto readIndex = m_state->readIndex.load(std::memory_order_acquire);
+    auto offset = static_cast<size_t>(writeIndex & (m_capacity - 1));
+    auto space = m_capacity - static_cast<size_t>(writeIndex - readIndex);
+
+    *data = m_buffer + offset;
+
+    return std::min(space, m_capacity - offset);
+}
+
+void AASBRingBufferStream::commitWrite(size_t size) {
+    if (size > 0) {
+        m_state->writeIndex.fetch_add(size);
+        notify();
+
+#ifdef __linux__
+        if (m_state->readyFdRequested.load(std::memory_order_relaxed) && m_readyFd >= 0) {
+            eventfd_write(m_readyFd, 1);
+        }
+#endif
+    }
+}
+
+size_t AASBRingBufferStream::acquireRead(const char** data) {
+    auto readIndex = m_state->readIndex.load(std::memory_order_relaxed);
+    auto writeIndex = m_state->writeIndex.load(std::memory_order_acquire);
+    auto offset = static_cast<size_t>(readIndex & (m_capacity - 1));
+    auto available = static_cast<size_t>(writeIndex - readIndex);
+
+    *data = m_buffer + offset;
+
+    return std::min(available, m_capacity - offset);
+}
+
+void AASBRingBufferStream::commitRead(size_t size) {
+    if (size > 0) {
+        m_state->readIndex.fetch_add(size);
+        notify();
+    }
+}
+
+//
+// blocking access
+//
+
+bool AASBRingBufferStream::waitForData(const std::chrono::milliseconds& timeout, size_t size) {
+    size = std::max<size_t>(std::min(size, m_capacity), 1);
+    return wait(timeout, [this, size]() { return getReadableSize() >= size || m_state->closed.load(); }) &&
+           getReadableSize() >= size;
+}
+
+bool AASBRingBufferStream::waitForSpace(const std::chrono::milliseconds& timeout) {
+    return wait(timeout, [this]() { return getReadableSize() < m_capacity || m_state->closed.load(); }) &&
+           m_state->closed.load() == false;
+}
+
+#ifdef __linux__
+
+bool AASBRingBufferStream::wait(const std::chrono::milliseconds& timeout, std::function<bool()> predicate) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (predicate() == false) {
+        // the sequence is loaded and the waiter count is incremented before the predicate is checked
+        // again, so a producer or consumer that updates an index after the check will see the waiter
+        // and change the sequence, and the futex wait will not sleep through the update
+        auto sequence = m_state->sequence.load();
+        m_state->waiters++;
+
+        if (predicate()) {
+            m_state->waiters--;
+            return true;
+        }
+
+        auto remaining = deadline - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::steady_clock::duration::zero()) {
+            m_state->waiters--;
+            return false;
+        }
+
+        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(remaining);
+        struct timespec relative;
+        relative.tv_sec = static_cast<time_t>(seconds.count());
+        relative.tv_nsec =
+            static_cast<long>(std::chrono::duration_cast<std::chrono::nanoseconds>(remaining - seconds).count());
+
+        // the futex word is in the shared mapping, so it is not a private futex
+        syscall(
+            SYS_futex, reinterpret_cast<uint32_t*>(&m_state->sequence), FUTEX_WAIT, sequence, &relative, nullptr, 0);
+        m_state->waiters--;
+    }
+
+    return true;
+}
+
+void AASBRingBufferStream::notify() {
+    m_state->sequence++;
+    if (m_state->waiters.load() > 0) {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_state->sequence), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+}
+
+#else
+
+bool AASBRingBufferStream::wait(const std::chrono::milliseconds& timeout, std::function<bool()> predicate) {
+    if (predicate()) {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // the waiter count is incremented before the predicate is checked again, so a producer or
+    // consumer that updates an index after the check will see the waiter and notify it
+    m_state->waiters++;
+    bool result = m_cv.wait_for(lock, timeout, predicate);
+    m_state->waiters--;
+
+    return result;
+}
+
+void AASBRingBufferStream::notify() {
+    if (m_state->waiters.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cv.notify_all();
+    }
+}
+
+#endif
+
+void AASBRingBufferStream::close() {
+    m_state->closed = 1;
+
+    // wake up waiters so they can observe that the stream is closed
+    notify();
+
+#ifdef __linux__
+    if (m_readyFd >= 0) {
+        eventfd_write(m_readyFd, 1);
+    }
+#endif
+}
+
+size_t AASBRingBufferStream::getCapacity() {
+    return m_capacity;
+}
+
+size_t AASBRingBufferStream::getReadableSize() {
+    return static_cast<size_t>(m_state->writeIndex.load() - m_state->readIndex.load());
+}
+
+int AASBRingBufferStream::getSharedMemoryFd() {
+    return m_sharedMemoryFd;
+}
+
+int AASBRingBufferStream::getReadyFd() {
+    m_state->readyFdRequested = 1;
+    return m_readyFd;
+}
+
+}  // namespace aasb
+}  // namespace aace
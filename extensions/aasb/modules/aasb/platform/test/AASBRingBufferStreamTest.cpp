@@ -0,0 +1,168 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AACE/AASB/AASBRingBufferStream.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using aace::aasb::AASBRingBufferStream;
+using aace::aasb::AASBStream;
+
+/// Test harness for @c AASBRingBufferStream class
+class AASBRingBufferStreamTest : public ::testing::Test {
+protected:
+    static std::vector<char> makeData(size_t size) {
+        std::vector<char> data(size);
+        for (size_t j = 0; j < size; j++) {
+            data[j] = static_cast<char>(j % 251);
+        }
+        return data;
+    }
+};
+
+/**
+ * Test that a reader waiting for data is woken up when another thread writes to the stream.
+ */
+TEST_F(AASBRingBufferStreamTest, waitForDataWakesUpOnWrite) {
+    auto stream = AASBRingBufferStream::create(1024, AASBStream::Mode::WRITE);
+    ASSERT_NE(nullptr, stream);
+
+    EXPECT_FALSE(stream->waitForData(std::chrono::milliseconds(10)));
+
+    std::thread writer([stream]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        stream->write("abcd", 4);
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(stream->waitForData(std::chrono::seconds(5), 4));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    writer.join();
+
+    char data[4];
+    EXPECT_EQ(4, stream->read(data, sizeof(data)));
+    EXPECT_EQ("abcd", std::string(data, sizeof(data)));
+}
+
+/**
+ * Test that a write larger than the buffer blocks until the reader makes space, and that all of the
+ * data is delivered in order.
+ */
+TEST_F(AASBRingBufferStreamTest, writeBlocksWhileBufferIsFull) {
+    auto stream = AASBRingBufferStream::create(256, AASBStream::Mode::WRITE);
+    ASSERT_NE(nullptr, stream);
+
+    auto expected = makeData(4096);
+    std::vector<char> received;
+
+    std::thread reader([stream, &received]() {
+        char buffer[64];
+        while (received.size() < 4096 && stream->waitForData(std::chrono::seconds(5))) {
+            auto count = stream->read(buffer, sizeof(buffer));
+            received.insert(received.end(), buffer, buffer + count);
+        }
+    });
+
+    EXPECT_EQ(4096, stream->write(expected.data(), expected.size()));
+    reader.join();
+
+    EXPECT_EQ(expected, received);
+}
+
+/**
+ * Test that a write to a full buffer that is never read returns a short count instead of blocking forever.
+ */
+TEST_F(AASBRingBufferStreamTest, writeTimesOutWhenBufferStaysFull) {
+    auto stream = AASBRingBufferStream::create(256, AASBStream::Mode::WRITE);
+    ASSERT_NE(nullptr, stream);
+
+    auto data = makeData(512);
+    auto count = stream->write(data.data(), data.size());
+
+    EXPECT_EQ(static_cast<ssize_t>(stream->getCapacity()), count);
+    EXPECT_FALSE(stream->isClosed());
+
+    // a full buffer does not report that the stream is closed
+    EXPECT_EQ(0, stream->write(data.data(), data.size()));
+}
+
+/**
+ * Test that a write blocked on a full buffer returns when the stream is closed.
+ */
+TEST_F(AASBRingBufferStreamTest, closeWakesUpBlockedWriter) {
+    auto stream = AASBRingBufferStream::create(256, AASBStream::Mode::WRITE);
+    ASSERT_NE(nullptr, stream);
+
+    auto data = makeData(stream->getCapacity());
+    ASSERT_EQ(static_cast<ssize_t>(data.size()), stream->write(data.data(), data.size()));
+
+    ssize_t result = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::thread writer([stream, &data, &result]() { result = stream->write(data.data(), data.size()); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    stream->close();
+    writer.join();
+
+    EXPECT_EQ(-1, result);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(900));
+    EXPECT_TRUE(stream->isClosed());
+}
+
+/**
+ * Test that a reader opening the stream in read mode can read the data written before the stream
+ * was closed, and sees the stream as closed only when it has been drained.
+ */
+TEST_F(AASBRingBufferStreamTest, readerDrainsDataOnClose) {
+    auto stream = AASBRingBufferStream::create(1024, AASBStream::Mode::READ);
+    ASSERT_NE(nullptr, stream);
+
+    ASSERT_EQ(8, stream->write("abcdefgh", 8));
+    stream->close();
+
+    EXPECT_FALSE(stream->isClosed());
+    EXPECT_TRUE(stream->waitForData(std::chrono::milliseconds(10)));
+
+    char data[8];
+    EXPECT_EQ(8, stream->read(data, sizeof(data)));
+    EXPECT_EQ("abcdefgh", std::string(data, sizeof(data)));
+    EXPECT_TRUE(stream->isClosed());
+}
+
+/**
+ * Test that a writer sees the stream as closed as soon as it is closed, even if data is still buffered.
+ */
+TEST_F(AASBRingBufferStreamTest, writerClosedImmediately) {
+    auto stream = AASBRingBufferStream::create(1024, AASBStream::Mode::WRITE);
+    ASSERT_NE(nullptr, stream);
+
+    ASSERT_EQ(8, stream->write("abcdefgh", 8));
+    stream->close();
+
+    EXPECT_TRUE(stream->isClosed());
+    EXPECT_EQ(-1, stream->write("abcd", 4));
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
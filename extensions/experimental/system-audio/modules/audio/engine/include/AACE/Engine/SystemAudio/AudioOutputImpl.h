@@ -23,6 +23,8 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
+#include <cstdint>
 #include <aal.h>
 #include <vector>
 #include <deque>
@@ -45,6 +47,7 @@ public:
     void onStart();
     void onStop(aal_status_t reason);
     void onDataRequested();
+    void onEnoughData();
     void onAlmostDone();
 
     // aace::audio::AudioOutput
@@ -133,6 +136,13 @@ private:
     std::atomic<bool> m_streaming;
     std::string m_deviceName;
 
+    // Set when the pipeline has enough data queued, cleared when it requests more data
+    bool m_pipelineFull = false;
+    // Counts the data requests of the pipeline, so a full write waits for a request made after it
+    uint64_t m_dataRequests = 0;
+    std::mutex m_feedMutex;
+    std::condition_variable m_cvFeed;
+
     State m_state;
     std::mutex m_stateMutex;
     std::condition_variable m_cvStateChange;
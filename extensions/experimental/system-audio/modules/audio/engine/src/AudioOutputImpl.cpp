@@ -34,6 +34,9 @@ static const char* TAG("aace.systemAudio.AudioOutputImpl");
 
 static constexpr size_t READ_BUFFER_SIZE = 4096;
 
+// The audio stream does not signal when data arrives, so an empty read is retried after this interval
+static constexpr std::chrono::milliseconds READ_RETRY_INTERVAL(10);
+
 std::ostream& operator<<(std::ostream& stream, AudioOutputImpl::State state) {
     switch (state) {
         case AudioOutputImpl::State::Created:
@@ -234,10 +237,15 @@ bool AudioOutputImpl::writeStreamToPipeline() {
     try {
         ThrowIfNull(m_currentStream, "invalidAudioStream");
 
-        constexpr std::chrono::milliseconds RETRY_INTERVAL(100);
         char buffer[READ_BUFFER_SIZE];
         ssize_t size = 0;
 
+        // wait until the pipeline requests more data
+        {
+            std::unique_lock<std::mutex> lock(m_feedMutex);
+            m_cvFeed.wait(lock, [this] { return !m_pipelineFull || !m_streaming; });
+        }
+
         while (m_streaming) {
             size = m_currentStream->read(buffer, READ_BUFFER_SIZE);
             ThrowIf(size < 0, "readFromStreamFailed");
@@ -249,19 +257,29 @@ bool AudioOutputImpl::writeStreamToPipeline() {
                 return false;
             }
             // if we didn't read any data and the stream is not closed, then
-            // sleep some mount of time before next read
-            std::this_thread::sleep_for(RETRY_INTERVAL);
+            // wait before the next read, or until streaming is stopped
+            std::unique_lock<std::mutex> lock(m_feedMutex);
+            m_cvFeed.wait_for(lock, READ_RETRY_INTERVAL, [this] { return !m_streaming; });
         }
 
         // write the data to the player's pipeline
         while (m_streaming) {
+            uint64_t dataRequests;
+            {
+                std::lock_guard<std::mutex> lock(m_feedMutex);
+                dataRequests = m_dataRequests;
+            }
+
             int written = aal_player_write(m_player, buffer, size);
             ThrowIf(written < 0, "writeToPipelineFailed");
             if (written > 0) {
                 ThrowIf(written != size, "writeToPipelinePartially");
                 break;
             }
-            std::this_thread::sleep_for(RETRY_INTERVAL);
+
+            // the player queue is full, so wait until it requests more data after the write
+            std::unique_lock<std::mutex> lock(m_feedMutex);
+            m_cvFeed.wait(lock, [this, dataRequests] { return m_dataRequests != dataRequests || !m_streaming; });
         }
 
         return true;
@@ -382,21 +400,40 @@ void AudioOutputImpl::executeStartStreaming() {
         return;
     }
     // Start streaming thread
+    {
+        std::lock_guard<std::mutex> lock(m_feedMutex);
+        m_pipelineFull = false;
+    }
     m_streaming = true;
     m_streamingThread = std::thread(&AudioOutputImpl::streamingLoop, this);
 }
 
 void AudioOutputImpl::executeStopStreaming() {
-    m_streaming = false;
+    {
+        std::lock_guard<std::mutex> lock(m_feedMutex);
+        m_streaming = false;
+    }
+    m_cvFeed.notify_all();
     if (m_streamingThread.joinable()) {
         m_streamingThread.join();
     }
 }
 
 void AudioOutputImpl::onDataRequested() {
+    {
+        std::lock_guard<std::mutex> lock(m_feedMutex);
+        m_pipelineFull = false;
+        m_dataRequests++;
+    }
+    m_cvFeed.notify_all();
     m_executorCallback.submit([this]() { executeStartStreaming(); });
 }
 
+void AudioOutputImpl::onEnoughData() {
+    std::lock_guard<std::mutex> lock(m_feedMutex);
+    m_pipelineFull = true;
+}
+
 //
 // aace::audio::AudioOutput
 //
@@ -432,6 +469,16 @@ bool AudioOutputImpl::executePrepare(
                 case audio::AudioStream::Encoding::UNKNOWN:
                     // Note: We assume the unknown streams are all MP3 formatted
                 case audio::AudioStream::Encoding::MP3: {
+                    // feed the audio stream to the pipeline as it arrives if it can be decoded there, so playback
+                    // starts with the first frames; a repeating stream is staged in a temp file instead because
+                    // the stream can only be read once
+                    const uint32_t mp3_stream_caps = AAL_MODULE_CAP_STREAM_PLAYBACK | AAL_MODULE_CAP_MP3_STREAM_PLAYBACK;
+                    if (!repeating && aal_find_module_by_capability(mp3_stream_caps) != AAL_INVALID_MODULE) {
+                        m_currentStream = stream;
+                        ThrowIfNot(prepareStream(stream), "prepareStreamMP3Failed");
+                        break;
+                    }
+
                     // write the audio stream to a temp file
                     char tmpFile[] = "/tmp/aac_audio_XXXXXX";
                     int fd = mkstemp(tmpFile);
@@ -575,7 +622,22 @@ bool AudioOutputImpl::prepareUrl(const std::string& url) {
 bool AudioOutputImpl::prepareStream(const std::shared_ptr<aace::audio::AudioStream>& stream) {
     try {
         auto af = stream->getAudioFormat();
-        preparePlayer([this, &af](aal_attributes_t* attr, aal_audio_parameters_t* params) {
+        auto encoding = stream->getEncoding();
+        preparePlayer([this, &af, encoding](aal_attributes_t* attr, aal_audio_parameters_t* params) {
+            if (encoding != aace::audio::AudioStream::Encoding::LPCM) {
+                // Use different module if MP3 Stream is not supported by the specified module
+                const uint32_t mp3_stream_caps = AAL_MODULE_CAP_STREAM_PLAYBACK | AAL_MODULE_CAP_MP3_STREAM_PLAYBACK;
+                if ((aal_get_module_capabilities(m_moduleId) & mp3_stream_caps) != mp3_stream_caps) {
+                    int module = aal_find_module_by_capability(mp3_stream_caps);
+                    ThrowIf(module == AAL_INVALID_MODULE, "Mp3StreamUnsupported");
+                    attr->module_id = module;
+                }
+
+                // Note: We assume the unknown streams are all MP3 formatted
+                params->stream_type = AAL_STREAM_MP3;
+                return params;
+            }
+
             ThrowIf(af.getEncoding() != aace::audio::AudioFormat::Encoding::LPCM, "unsupported encoding");
             ThrowIf(
                 af.getSampleFormat() != aace::audio::AudioFormat::SampleFormat::SIGNED ||
@@ -634,6 +696,11 @@ void AudioOutputImpl::preparePlayer(
           ReturnIf(!user_data);
           auto *self = static_cast<AudioOutputImpl*>(user_data);
           self->onDataRequested();
+        },
+        .on_enough_data = [](void* user_data) {
+          ReturnIf(!user_data);
+          auto *self = static_cast<AudioOutputImpl*>(user_data);
+          self->onEnoughData();
         }
     };
     // clang-format on
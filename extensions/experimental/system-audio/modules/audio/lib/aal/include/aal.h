@@ -43,6 +43,7 @@ typedef struct {
     void (*on_almost_done)(void* user_data);
     void (*on_data)(const int16_t* data, const size_t length, void* user_data);
     void (*on_data_requested)(void* user_data);
+    void (*on_enough_data)(void* user_data);
 } aal_listener_t;
 
 typedef struct {
@@ -54,7 +55,7 @@ typedef struct {
     int module_id;                   // the AAL module to use
 } aal_attributes_t;
 
-typedef enum { AAL_STREAM_LPCM, AAL_STREAM_UNKNOWN } aal_stream_type_t;
+typedef enum { AAL_STREAM_LPCM, AAL_STREAM_UNKNOWN, AAL_STREAM_MP3 } aal_stream_type_t;
 
 typedef struct {
     /**
@@ -95,6 +96,7 @@ typedef void* aal_handle_t;
 #define AAL_MODULE_CAP_STREAM_PLAYBACK 0x01u
 #define AAL_MODULE_CAP_URL_PLAYBACK 0x02u
 #define AAL_MODULE_CAP_LPCM_PLAYBACK 0x04u
+#define AAL_MODULE_CAP_MP3_STREAM_PLAYBACK 0x08u
 
 int aal_get_module_count();
 int aal_find_module_by_capability(uint32_t caps);
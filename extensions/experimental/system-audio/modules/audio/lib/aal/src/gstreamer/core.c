@@ -66,6 +66,7 @@ aal_gst_context_t* gstreamer_create_context(GstElement* pipeline, const char* el
     // GLoop creation for the bus watch
     ctx->worker_context = g_main_context_new();
     ctx->main_loop = g_main_loop_new(ctx->worker_context, false);
+    g_mutex_init(&ctx->appsrc_lock);
 
     return ctx;
 }
@@ -100,6 +101,14 @@ void gstreamer_destroy(aal_handle_t handle) {
     gst_element_set_state(ctx->pipeline, GST_STATE_NULL);
     gst_object_unref(ctx->pipeline);
 
+    if (ctx->appsrc) gst_object_unref(ctx->appsrc);
+    g_mutex_clear(&ctx->appsrc_lock);
+
+    if (ctx->buffer_pool) {
+        gst_buffer_pool_set_active(ctx->buffer_pool, FALSE);
+        gst_object_unref(ctx->buffer_pool);
+    }
+
     g_main_context_unref(ctx->worker_context);
     g_main_loop_quit(ctx->main_loop);
     g_main_loop_unref(ctx->main_loop);
@@ -353,7 +362,8 @@ extern const aal_recorder_ops_t gstreamer_recorder_ops;
 // clang-format off
 const aal_module_t gstreamer_module = {
 	.name = "GStreamer",
-	.capabilities = AAL_MODULE_CAP_STREAM_PLAYBACK | AAL_MODULE_CAP_URL_PLAYBACK | AAL_MODULE_CAP_LPCM_PLAYBACK,
+	.capabilities = AAL_MODULE_CAP_STREAM_PLAYBACK | AAL_MODULE_CAP_URL_PLAYBACK | AAL_MODULE_CAP_LPCM_PLAYBACK |
+		AAL_MODULE_CAP_MP3_STREAM_PLAYBACK,
 	.initialize = gstreamer_initialize,
 	.deinitialize = NULL,
 	.player_ops = &gstreamer_player_ops,
@@ -39,6 +39,11 @@ typedef struct {
     GMainContext* worker_context;
 
     aal_audio_parameters_t audio_params;
+
+    // Cached appsrc of the pipeline, protected by appsrc_lock
+    GstElement* appsrc;
+    GMutex appsrc_lock;
+    GstBufferPool* buffer_pool;
 } aal_gst_context_t;
 
 aal_gst_context_t* gstreamer_create_context(GstElement* pipeline, const char* element, const aal_attributes_t* attr);
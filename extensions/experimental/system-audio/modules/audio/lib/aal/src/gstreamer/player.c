@@ -36,6 +36,14 @@
 
 #define APPSRC_URI "appsrc://"
 
+// Buffers written to appsrc are taken from a pool instead of being allocated for each write. The buffer size
+// matches the chunk size the engine writes, larger writes fall back to allocating a buffer.
+#define POOL_BUFFER_SIZE 4096
+#define POOL_MIN_BUFFERS 8
+
+// Request more data when the appsrc queue drops below this level, so it is refilled before it runs empty
+#define APPSRC_MIN_PERCENT 50
+
 static void need_data_callback(GstAppSrc* src, guint length, gpointer pointer) {
     aal_gst_context_t* ctx = (aal_gst_context_t*)pointer;
     g_debug("onNeedData: length=%d\n", length);
@@ -43,7 +51,9 @@ static void need_data_callback(GstAppSrc* src, guint length, gpointer pointer) {
 }
 
 static void enough_data_callback(GstAppSrc* src, gpointer pointer) {
+    aal_gst_context_t* ctx = (aal_gst_context_t*)pointer;
     g_debug("onEnoughData\n");
+    if (ctx->listener && ctx->listener->on_enough_data) ctx->listener->on_enough_data(ctx->user_data);
 }
 
 static gboolean seek_data_callback(GstAppSrc* src, guint64 offset, gpointer pointer) {
@@ -66,8 +76,15 @@ static void source_setup_callback(GstElement* playbin, GstElement* source, gpoin
 
     if (!GST_IS_APP_SRC(source)) return;
 
+    // Cache the appsrc so writes do not have to query the pipeline
+    g_mutex_lock(&ctx->appsrc_lock);
+    if (ctx->appsrc) gst_object_unref(ctx->appsrc);
+    ctx->appsrc = GST_ELEMENT(gst_object_ref(source));
+    g_mutex_unlock(&ctx->appsrc_lock);
+
     // Set appsrc stream type
     gst_app_src_set_stream_type(GST_APP_SRC(source), GST_APP_STREAM_TYPE_STREAM);
+    g_object_set(G_OBJECT(source), "min-percent", APPSRC_MIN_PERCENT, NULL);
 
     // Setup appsrc Callbacks
 #ifdef USE_APPSRC_CALLBACK
@@ -86,6 +103,9 @@ static void source_setup_callback(GstElement* playbin, GstElement* source, gpoin
                 ctx->audio_params.lpcm.channels,
                 ctx->audio_params.lpcm.sample_rate);
             break;
+        case AAL_STREAM_MP3:
+            caps_string = g_strdup("audio/mpeg, mpegversion=(int)1");
+            break;
         default:
             caps_string = NULL;
             break;
@@ -99,7 +119,37 @@ static void source_setup_callback(GstElement* playbin, GstElement* source, gpoin
         g_free(caps_string);
     }
 
-    g_object_set(G_OBJECT(source), "format", GST_FORMAT_TIME, NULL);
+    // Encoded streams are pushed as they arrive without timestamps, so let the parser derive them from the bytes
+    if (ctx->audio_params.stream_type == AAL_STREAM_MP3) {
+        g_object_set(G_OBJECT(source), "format", GST_FORMAT_BYTES, NULL);
+    } else {
+        g_object_set(G_OBJECT(source), "format", GST_FORMAT_TIME, NULL);
+    }
+}
+
+static GstAppSrc* get_appsrc(aal_gst_context_t* ctx) {
+    GstAppSrc* appsrc = NULL;
+
+    g_mutex_lock(&ctx->appsrc_lock);
+    if (ctx->appsrc) appsrc = GST_APP_SRC(gst_object_ref(ctx->appsrc));
+    g_mutex_unlock(&ctx->appsrc_lock);
+
+    return appsrc;
+}
+
+static GstBufferPool* create_buffer_pool() {
+    GstBufferPool* pool = gst_buffer_pool_new();
+    GstStructure* config = gst_buffer_pool_get_config(pool);
+
+    // Note: The pool is not limited, so acquiring a buffer never blocks the writer
+    gst_buffer_pool_config_set_params(config, NULL, POOL_BUFFER_SIZE, POOL_MIN_BUFFERS, 0);
+    if (!gst_buffer_pool_set_config(pool, config) || !gst_buffer_pool_set_active(pool, TRUE)) {
+        g_warning("Couldn't activate buffer pool\n");
+        gst_object_unref(pool);
+        return NULL;
+    }
+
+    return pool;
 }
 
 static aal_handle_t gstreamer_player_create(const aal_attributes_t* attr, aal_audio_parameters_t* params) {
@@ -110,8 +160,8 @@ static aal_handle_t gstreamer_player_create(const aal_attributes_t* attr, aal_au
     GstElement* volume = NULL;
 
     if (!attr->uri || IS_EMPTY_STRING(attr->uri)) {
-        if (params != NULL && params->stream_type != AAL_STREAM_LPCM) {
-            g_debug("Should only specify audio parameters for LPCM stream");
+        if (params != NULL && params->stream_type != AAL_STREAM_LPCM && params->stream_type != AAL_STREAM_MP3) {
+            g_debug("Should only specify audio parameters for LPCM or MP3 stream");
             goto exit;
         }
     } else {
@@ -190,6 +240,7 @@ static aal_handle_t gstreamer_player_create(const aal_attributes_t* attr, aal_au
             ctx->audio_params.lpcm.channels = AAL_AVS_CHANNELS;
             ctx->audio_params.lpcm.channels = AAL_AVS_SAMPLE_RATE;
         }
+        ctx->buffer_pool = create_buffer_pool();
         g_object_set(GST_OBJECT(ctx->pipeline), "uri", APPSRC_URI, NULL);
     } else {
         g_object_set(GST_OBJECT(ctx->pipeline), "uri", attr->uri, NULL);
@@ -236,13 +287,15 @@ static int64_t gstreamer_player_get_duration(aal_handle_t handle) {
 }
 
 static int64_t gstreamer_player_get_num_bytes_buffered(aal_handle_t handle) {
-    GstElement* source = NULL;
+    int64_t bytes = 0;
     aal_gst_context_t* ctx = (aal_gst_context_t*)handle;
+    GstAppSrc* appsrc = get_appsrc(ctx);
 
-    g_object_get(ctx->pipeline, "source", &source, NULL);
-
-    if (GST_IS_APP_SRC(source)) return gst_app_src_get_current_level_bytes(GST_APP_SRC(source));
-    return 0;
+    if (appsrc) {
+        bytes = gst_app_src_get_current_level_bytes(appsrc);
+        gst_object_unref(appsrc);
+    }
+    return bytes;
 }
 
 static void gstreamer_player_seek(aal_handle_t handle, int64_t position) {
@@ -322,19 +375,31 @@ static ssize_t gstreamer_player_write(aal_handle_t handle, const char* data, con
     GstMapInfo info;
     GstFlowReturn ret;
     ssize_t r = -1;
-    GstElement* source = NULL;
     aal_gst_context_t* ctx = (aal_gst_context_t*)handle;
+    GstAppSrc* appsrc = get_appsrc(ctx);
 
-    g_object_get(ctx->pipeline, "source", &source, NULL);
-
-    if (!GST_IS_APP_SRC(source)) {
+    if (!appsrc) {
         g_warning("AppSrc is not available\n");
         return r;
     }
 
-    g_debug("write size=%zu current=%llu\n", size, gst_app_src_get_current_level_bytes(GST_APP_SRC(source)));
+    guint64 level = gst_app_src_get_current_level_bytes(appsrc);
+    g_debug("write size=%zu current=%llu\n", size, level);
 
-    buffer = gst_buffer_new_allocate(NULL, size, NULL);
+    // Report the queue as full instead of growing it past max-bytes, the player requests more data with need-data
+    if (level >= gst_app_src_get_max_bytes(appsrc)) {
+        r = 0;
+        goto exit;
+    }
+
+    if (ctx->buffer_pool && size <= POOL_BUFFER_SIZE) {
+        if (gst_buffer_pool_acquire_buffer(ctx->buffer_pool, &buffer, NULL) == GST_FLOW_OK) {
+            gst_buffer_set_size(buffer, size);
+        } else {
+            buffer = NULL;
+        }
+    }
+    if (!buffer) buffer = gst_buffer_new_allocate(NULL, size, NULL);
     if (!buffer) {
         g_warning("Couldn't allocate buffer\n");
         goto exit;
@@ -350,10 +415,10 @@ static ssize_t gstreamer_player_write(aal_handle_t handle, const char* data, con
     gst_buffer_unmap(buffer, &info);
 
 #ifdef USE_APPSRC_PUSH
-    ret = gst_app_src_push_buffer(GST_APP_SRC(source), buffer);
+    ret = gst_app_src_push_buffer(appsrc, buffer);
     buffer = NULL;
 #else
-    g_signal_emit_by_name(source, "push-buffer", buffer, &ret);
+    g_signal_emit_by_name(appsrc, "push-buffer", buffer, &ret);
 #endif
 
     if (ret != GST_FLOW_OK) {
@@ -365,17 +430,19 @@ static ssize_t gstreamer_player_write(aal_handle_t handle, const char* data, con
 
 exit:
     if (buffer) gst_buffer_unref(buffer);
+    gst_object_unref(appsrc);
 
     return r;
 }
 
 static void gstreamer_player_notify_end_of_stream(aal_handle_t handle) {
-    GstElement* source = NULL;
     aal_gst_context_t* ctx = (aal_gst_context_t*)handle;
+    GstAppSrc* appsrc = get_appsrc(ctx);
 
-    g_object_get(ctx->pipeline, "source", &source, NULL);
-
-    if (GST_IS_APP_SRC(source)) gst_app_src_end_of_stream(GST_APP_SRC(source));
+    if (appsrc) {
+        gst_app_src_end_of_stream(appsrc);
+        gst_object_unref(appsrc);
+    }
 }
 
 const aal_player_ops_t gstreamer_player_ops = {.create = gstreamer_player_create,
@@ -153,9 +153,13 @@ TEST(Interactive, DISABLED_Player) {
                 if (r > 0) {
                     LOG("Write to player %ld", r);
                     ssize_t w = aal_player_write(handle, buffer, r);
+                    // The player accepts nothing while its queue is full, so retry until it has room
+                    while (w == 0) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                        w = aal_player_write(handle, buffer, r);
+                    }
                     if (w != (ssize_t)r) {
                         LOG("aal_player_write failed written=%ld vs size=%ld", w, r);
-                        // Will retry...
                     }
                 }
                 if (r != BUFFER_SIZE) {
@@ -391,4 +395,16 @@ TEST(FunctionalTest, CreateWithStream) {
         aal_handle_t player = aal_player_create(&attr, &audio_params);
         ASSERT_EQ(player, nullptr);
     }
+    {  // Can play MP3 stream only if the module supports it
+        aal_audio_parameters_t audio_params;
+        audio_params.stream_type = AAL_STREAM_MP3;
+
+        aal_handle_t player = aal_player_create(&attr, &audio_params);
+        if (aal_get_module_capabilities(param_module_id) & AAL_MODULE_CAP_MP3_STREAM_PLAYBACK) {
+            ASSERT_NE(player, nullptr);
+            aal_player_destroy(player);
+        } else {
+            ASSERT_EQ(player, nullptr);
+        }
+    }
 }
\ No newline at end of file
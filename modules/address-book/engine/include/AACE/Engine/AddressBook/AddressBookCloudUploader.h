@@ -20,6 +20,7 @@
 #include <thread>
 #include <deque>
 #include <unordered_map>
+#include <unordered_set>
 #include <condition_variable>
 
 #include <AVSCommon/SDKInterfaces/AuthObserverInterface.h>
@@ -30,6 +31,7 @@
 #include <AACE/Network/NetworkInfoProvider.h>
 #include <AACE/Engine/Network/NetworkInfoObserver.h>
 #include <AACE/Engine/Network/NetworkObservableInterface.h>
+#include <AACE/Engine/Storage/LocalStorageInterface.h>
 
 #include "AddressBookObserver.h"
 #include "AddressBookServiceInterface.h"
@@ -107,7 +109,8 @@ private:
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
         NetworkInfoObserver::NetworkStatus networkStatus,
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage);
 
 public:
     static std::shared_ptr<AddressBookCloudUploader> create(
@@ -116,7 +119,8 @@ public:
         std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
         NetworkInfoObserver::NetworkStatus networkStatus,
         std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
-        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints);
+        std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage = nullptr);
 
     // AddressBookObserver
     bool addressBookAdded(std::shared_ptr<AddressBookEntity> addressBookEntity) override;
@@ -148,14 +152,43 @@ private:
 
     bool checkAndAutoProvisionAccount();
     std::string prepareForUpload(std::shared_ptr<AddressBookEntity> addressBookEntity);
-    bool upload(const std::string& cloudAddressBookId, std::shared_ptr<rapidjson::Document>);
-    bool uploadEntries(const std::string& cloudAddressBookId, std::shared_ptr<rapidjson::Document> document);
+    bool upload(
+        const std::string& cloudAddressBookId,
+        std::shared_ptr<rapidjson::Document>,
+        std::queue<std::string>& failedEntries);
+    bool uploadEntries(
+        const std::string& cloudAddressBookId,
+        std::shared_ptr<rapidjson::Document> document,
+        std::queue<std::string>& failedEntries);
 
     std::string createAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity);
     bool deleteAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity);
 
     bool cleanAllCloudAddressBooks();
 
+    // Batches of entries are uploaded by a pipeline while the platform adds entries
+    enum class UploadResult { SUCCESS, FAILED, REPLACE };
+    struct UploadSession;
+    UploadResult uploadAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity, bool incremental);
+    bool prepareUploadSession(UploadSession& session);
+    bool uploadBatch(UploadSession& session, std::shared_ptr<rapidjson::Document> batch);
+    bool applyEntryChanges(UploadSession& session);
+
+    // Upload index of the entries in the cloud address books, used to upload only the changed entries
+    bool loadUploadState(
+        const std::string& addressBookType,
+        std::string& cloudAddressBookId,
+        std::string& addressBookSourceId);
+    bool saveUploadState(
+        const std::string& addressBookType,
+        const std::string& cloudAddressBookId,
+        const std::string& addressBookSourceId);
+    bool removeUploadedAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity);
+    bool isIndexedCloudAddressBook(const std::string& addressBookType, const std::string& cloudAddressBookId);
+    std::unordered_map<std::string, std::string> loadUploadIndex(const std::string& addressBookType);
+    void clearUploadIndex(const std::string& addressBookType);
+    static std::string computeEntryHash(const rapidjson::Value& entry);
+
     bool isEventEnqueuedLocked(Event::Type type, std::shared_ptr<AddressBookEntity> addressBookEntity);
     void removeMatchingAddEventFromQueueLocked(std::shared_ptr<AddressBookEntity> addressBookEntity);
 
@@ -165,7 +198,9 @@ private:
         const std::string& addressBookId,
         std::shared_ptr<rapidjson::Document> document,
         HTTPResponse& httpResponse);
-    UploadFlowState handleParseHTTPResponse(const HTTPResponse& httpResponse);
+    UploadFlowState handleParseHTTPResponse(
+        const HTTPResponse& httpResponse,
+        std::queue<std::string>& failedEntries);
     UploadFlowState handleError(const std::string& addressBookId);
 
     void logNetworkMetrics(const HTTPResponse& httpResponse);
@@ -200,6 +235,9 @@ private:
     bool m_isAuthRefreshed = false;
     NetworkInfoObserver::NetworkStatus m_networkStatus;
 
+    /// Local storage for the upload index, or @c nullptr to upload the complete address book every time
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> m_localStorage;
+
     std::thread m_eventThread;
 };
 
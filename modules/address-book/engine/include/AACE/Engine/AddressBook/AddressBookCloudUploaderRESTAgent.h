@@ -17,6 +17,7 @@
 #ifndef AACE_ENGINE_ADDRESS_BOOK_ADDRESSBOOK_CLOUD_UPLOADER_REST_AGENT_H
 #define AACE_ENGINE_ADDRESS_BOOK_ADDRESSBOOK_CLOUD_UPLOADER_REST_AGENT_H
 
+#include <atomic>
 #include <queue>
 
 #include <AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h>
@@ -63,6 +64,10 @@ public:
         const std::string& addressBookType,
         std::string& cloudAddressBookId);
     bool deleteCloudAddressBook(const std::string& cloudAddressBookId);
+    bool deleteCloudAddressBookEntry(const std::string& cloudAddressBookId, const std::string& entrySourceId);
+
+    /// Returns @c false once the service rejected a request to delete an entry as unsupported
+    bool isEntryDeleteSupported();
 
     HTTPResponse uploadDocumentToCloud(
         std::shared_ptr<rapidjson::Document> document,
@@ -135,6 +140,9 @@ private:
     /// ACMS REST endpoint used for uploading.
     std::string m_acmsEndpoint;
 
+    /// Whether the service supports deleting single entries, until it rejects such a request
+    std::atomic<bool> m_entryDeleteSupported{true};
+
     /// Mutex to allow serialized access to m_pceId
     std::mutex m_pceIdMutex;
 };
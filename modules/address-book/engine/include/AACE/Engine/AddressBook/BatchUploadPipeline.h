@@ -0,0 +1,140 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_ADDRESS_BOOK_BATCH_UPLOAD_PIPELINE_H
+#define AACE_ENGINE_ADDRESS_BOOK_BATCH_UPLOAD_PIPELINE_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace addressBook {
+
+/**
+ * Uploads batches of entries on a bounded number of threads, while the next batches are created. Adding a batch
+ * blocks while the queue is full, so the memory used is bounded by the number of batches in flight.
+ */
+template <typename Batch>
+class BatchUploadPipeline {
+public:
+    using UploadFunction = std::function<bool(Batch)>;
+
+    BatchUploadPipeline(size_t maxConcurrentUploads, size_t maxQueuedBatches, UploadFunction upload) :
+            m_maxConcurrentUploads(maxConcurrentUploads), m_maxQueuedBatches(maxQueuedBatches), m_upload(upload) {
+    }
+
+    ~BatchUploadPipeline() {
+        finish();
+    }
+
+    // Queues a batch for upload, blocking while the queue is full. Returns @c false if an upload failed, in which
+    // case the batch and the remaining queued batches are dropped.
+    bool push(Batch batch) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_spaceAvailable.wait(
+            lock, [this]() { return m_failed || m_finished || m_queue.size() < m_maxQueuedBatches; });
+
+        if (m_failed || m_finished) {
+            return false;
+        }
+
+        m_queue.push_back(std::move(batch));
+
+        if (m_workers.size() < m_maxConcurrentUploads) {
+            m_workers.emplace_back(&BatchUploadPipeline::uploadLoop, this);
+        }
+
+        m_batchAvailable.notify_one();
+
+        return true;
+    }
+
+    // Waits for the queued batches to be uploaded, and returns @c true if all of them were uploaded.
+    bool finish() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_finished = true;
+        }
+
+        m_batchAvailable.notify_all();
+        m_spaceAvailable.notify_all();
+
+        for (auto& worker : m_workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return !m_failed;
+    }
+
+private:
+    void uploadLoop() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true) {
+            m_batchAvailable.wait(lock, [this]() { return m_finished || !m_queue.empty(); });
+
+            if (m_queue.empty()) {
+                return;
+            }
+
+            auto batch = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_spaceAvailable.notify_one();
+
+            // Drop the remaining batches once an upload failed.
+            if (m_failed) {
+                continue;
+            }
+
+            lock.unlock();
+            bool success = m_upload(batch);
+            batch = Batch();
+            lock.lock();
+
+            if (!success) {
+                m_failed = true;
+                m_spaceAvailable.notify_all();
+            }
+        }
+    }
+
+private:
+    size_t m_maxConcurrentUploads;
+    size_t m_maxQueuedBatches;
+    UploadFunction m_upload;
+
+    std::mutex m_mutex;
+    std::condition_variable m_batchAvailable;
+    std::condition_variable m_spaceAvailable;
+    std::deque<Batch> m_queue;
+    std::vector<std::thread> m_workers;
+    bool m_finished = false;
+    bool m_failed = false;
+};
+
+}  // namespace addressBook
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_ADDRESS_BOOK_BATCH_UPLOAD_PIPELINE_H
@@ -16,6 +16,8 @@
 // JSON for Modern C++
 #include <nlohmann/json.hpp>
 
+#include <cstdio>
+#include <functional>
 #include <typeinfo>
 #include <rapidjson/error/en.h>
 #include <rapidjson/pointer.h>
@@ -27,6 +29,7 @@
 #include <AACE/Engine/Utils/Metrics/Metrics.h>
 #include <AACE/Engine/Network/NetworkEngineService.h>
 #include <AACE/Engine/AddressBook/AddressBookCloudUploader.h>
+#include <AACE/Engine/AddressBook/BatchUploadPipeline.h>
 
 namespace aace {
 namespace engine {
@@ -40,6 +43,12 @@ static const std::string TAG("aace.addressBook.addressBookCloudUploader");
 /// Upload entreis batch size
 static const int UPLOAD_BATCH_SIZE = 100;
 
+/// Max number of batches uploaded at the same time
+static const size_t MAX_CONCURRENT_UPLOADS = 2;
+
+/// Max number of batches waiting to be uploaded, before adding entries blocks
+static const size_t MAX_QUEUED_BATCHES = 2;
+
 /// Max allowed phonenumbers per entry
 static const int MAX_ALLOWED_ADDRESSES_PER_ENTRY = 30;
 
@@ -88,6 +97,22 @@ static const std::string METRIC_NETWORK_BAD_USER_INPUT = "Network.BadUserInput";
 /// Metric for any Network Error
 static const std::string METRIC_NETWORK_ERROR = "Network.Error";
 
+/// Local storage table mapping the cloud address book type to the ids of the uploaded cloud address book and of the
+/// address book it was uploaded from
+static const std::string UPLOAD_STATE_TABLE = "aace.addressBook.cloudUploader";
+
+/// Local storage table prefix for the entry hashes of the uploaded cloud address book
+static const std::string UPLOAD_INDEX_TABLE_PREFIX = "aace.addressBook.cloudUploader.";
+
+/// Cloud address book types uploaded by the Auto SDK
+static const std::vector<std::string> CLOUD_ADDRESS_BOOK_TYPES = {"automotive", "automotivePostalAddress"};
+
+/// Max number of removed or changed entries deleted one by one, before the cloud address book is replaced instead
+static const size_t MAX_INCREMENTAL_DELETED_ENTRIES = UPLOAD_BATCH_SIZE;
+
+/// Max fraction of the uploaded entries deleted one by one, before the cloud address book is replaced instead
+static const double MAX_INCREMENTAL_DELETED_ENTRIES_RATIO = 0.1;
+
 using json = nlohmann::json;
 
 AddressBookCloudUploader::AddressBookCloudUploader() :
@@ -100,12 +125,19 @@ std::shared_ptr<AddressBookCloudUploader> AddressBookCloudUploader::create(
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
     NetworkInfoObserver::NetworkStatus networkStatus,
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage) {
     try {
         auto addressBookCloudUploader = std::shared_ptr<AddressBookCloudUploader>(new AddressBookCloudUploader());
         ThrowIfNot(
             addressBookCloudUploader->initialize(
-                addressBookService, authDelegate, deviceInfo, networkStatus, networkObserver, alexaEndpoints),
+                addressBookService,
+                authDelegate,
+                deviceInfo,
+                networkStatus,
+                networkObserver,
+                alexaEndpoints,
+                localStorage),
             "initializeAddressBookCloudUploaderFailed");
 
         return addressBookCloudUploader;
@@ -121,13 +153,15 @@ bool AddressBookCloudUploader::initialize(
     std::shared_ptr<alexaClientSDK::avsCommon::utils::DeviceInfo> deviceInfo,
     NetworkInfoObserver::NetworkStatus networkStatus,
     std::shared_ptr<aace::engine::network::NetworkObservableInterface> networkObserver,
-    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints) {
+    std::shared_ptr<aace::engine::alexa::AlexaEndpointInterface> alexaEndpoints,
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage) {
     try {
         m_addressBookService = addressBookService;
         m_authDelegate = authDelegate;
         m_deviceInfo = deviceInfo;
         m_networkStatus = networkStatus;
         m_networkObserver = networkObserver;
+        m_localStorage = localStorage;
 
         m_addressBookCloudUploaderRESTAgent = aace::engine::addressBook::AddressBookCloudUploaderRESTAgent::create(
             authDelegate, m_deviceInfo, alexaEndpoints);
@@ -167,6 +201,7 @@ void AddressBookCloudUploader::doShutdown() {
     m_authDelegate.reset();
     m_addressBookService.reset();
     m_addressBookCloudUploaderRESTAgent.reset();
+    m_localStorage.reset();
 }
 
 void AddressBookCloudUploader::onAuthStateChange(
@@ -293,15 +328,73 @@ void AddressBookCloudUploader::removeMatchingAddEventFromQueueLocked(
     }
 }
 
+/// State of an address book upload, shared by the batch uploads
+struct AddressBookCloudUploader::UploadSession {
+    std::shared_ptr<AddressBookEntity> addressBookEntity;
+    std::string addressBookType;
+
+    /// The cloud address book is prepared when the first batch is ready
+    bool prepared = false;
+    std::string cloudAddressBookId;
+
+    /// Whether the cloud address book matches the upload index, so only the changed entries are uploaded
+    bool incremental = false;
+
+    /// Hashes of the entries in the cloud address book when the upload started
+    std::unordered_map<std::string, std::string> uploadIndex;
+
+    /// Max number of entries deleted from the cloud address book before it is replaced instead
+    size_t maxDeletedEntries = 0;
+
+    /// Changed entries, uploaded after their previous version is deleted from the cloud address book
+    std::mutex changedEntriesMutex;
+    std::shared_ptr<rapidjson::Document> changedEntries;
+
+    /// Set when too many entries changed, so the cloud address book is replaced instead
+    std::atomic<bool> replace{false};
+
+    /// Ids of the entries added by the platform
+    std::unordered_set<std::string> entryIds;
+
+    int numberOfEntries = 0;
+    int numberOfBatches = 0;
+    std::atomic<int> numberOfUploadedEntries{0};
+
+    /// Time spent uploading batches, excluding the time the platform takes to add the entries
+    std::mutex uploadDurationMutex;
+    double uploadDuration = 0;
+    int numberOfUploadedBatches = 0;
+};
+
 class AddressBookEntriesFactory : public aace::addressBook::AddressBook::IAddressBookEntriesFactory {
 public:
-    AddressBookEntriesFactory(
-        std::shared_ptr<AddressBookEntity> addressBookEntity,
-        std::vector<std::shared_ptr<rapidjson::Document>>& documents) :
-            m_addressBookEntity(std::move(addressBookEntity)), m_documents(documents) {
+    using BatchHandler = std::function<bool(std::shared_ptr<rapidjson::Document>)>;
+
+    AddressBookEntriesFactory(std::shared_ptr<AddressBookEntity> addressBookEntity, BatchHandler batchHandler) :
+            m_addressBookEntity(std::move(addressBookEntity)), m_batchHandler(std::move(batchHandler)) {
+    }
+
+    /**
+     * Passes the batches that were not passed to the batch handler yet.
+     *
+     * @return @c false if a batch could not be handled
+     */
+    bool flush() {
+        handOffBatches(m_documents.size());
+        return !m_failed;
     }
 
 private:
+    // Passes the batches before @c bucketIndex to the batch handler, which releases them from the factory.
+    void handOffBatches(size_t bucketIndex) {
+        for (; m_handedOffBatches < bucketIndex; m_handedOffBatches++) {
+            auto document = std::move(m_documents[m_handedOffBatches]);
+            if (!m_failed && !m_batchHandler(document)) {
+                m_failed = true;
+            }
+        }
+    }
+
     bool isEntryPresent(const std::string& entryId) {
         auto it = m_ids.find(entryId);
         if (it == m_ids.end()) {
@@ -311,6 +404,8 @@ private:
     }
 
     void createEntryDataField(const std::string& entryId) {
+        ThrowIf(m_failed, "uploadFailed");
+
         auto it = m_ids.find(entryId);
         if (it == m_ids.end()) {
             // For "m_ids[id] = m_ids.size();" on Ubuntu platform, [] seems to increment the m_ids
@@ -323,6 +418,11 @@ private:
 
             // Check if bucket mapping to bucketIndex is new bucket to be created.
             if (bucketIndex + 1 > (m_documents.size())) {
+                // The previous buckets are full. Entries added with addEntry() are complete, so upload them now.
+                if (m_streaming) {
+                    handOffBatches(bucketIndex);
+                }
+
                 auto document = std::make_shared<rapidjson::Document>();
                 document->SetObject();
 
@@ -356,6 +456,7 @@ private:
         auto bucketIndex = m_ids[entryId] / UPLOAD_BATCH_SIZE;
         auto entriesIndex = m_ids[entryId] % UPLOAD_BATCH_SIZE;
 
+        ThrowIfNull(m_documents[bucketIndex], "entryAlreadyUploaded");
         auto& document = *m_documents[bucketIndex];
         auto& entries = document["entries"];
 
@@ -364,6 +465,7 @@ private:
 
     rapidjson::Document::AllocatorType& GetAllocator(const std::string& entryId) {
         auto bucketIndex = m_ids[entryId] / UPLOAD_BATCH_SIZE;
+        ThrowIfNull(m_documents[bucketIndex], "entryAlreadyUploaded");
         auto& document = *m_documents[bucketIndex];
 
         return document.GetAllocator();
@@ -684,6 +786,9 @@ public:
         const std::string& nickname,
         const std::string& phoneticFirstName = "",
         const std::string& phoneticLastName = "") {
+        // Entries built with the deprecated methods may be completed by later calls, so they are kept until
+        // the platform added all of the entries.
+        m_streaming = false;
         try {
             ThrowIf(entryId.empty(), "entryIdEmpty");
             ThrowIf(entryId.size() > MAX_ALLOWED_ENTRY_ID_SIZE, "entryIdExceedsMaxSize");
@@ -729,6 +834,7 @@ public:
     }
 
     bool addPhone(const std::string& entryId, const std::string& label, const std::string& number) {
+        m_streaming = false;
         try {
             ThrowIf(entryId.empty(), "entryIdEmpty");
             ThrowIf(entryId.size() > MAX_ALLOWED_ENTRY_ID_SIZE, "entryIdExceedsMaxSize");
@@ -780,6 +886,7 @@ public:
         float latitudeInDegrees,
         float longitudeInDegrees,
         float accuracyInMeters) {
+        m_streaming = false;
         try {
             ThrowIf(entryId.empty(), "entryIdEmpty");
             ThrowIf(entryId.size() > MAX_ALLOWED_ENTRY_ID_SIZE, "entryIdExceedsMaxSize");
@@ -851,8 +958,18 @@ public:
 
 private:
     std::shared_ptr<AddressBookEntity> m_addressBookEntity;
-    std::vector<std::shared_ptr<rapidjson::Document>>& m_documents;
+    BatchHandler m_batchHandler;
+    std::vector<std::shared_ptr<rapidjson::Document>> m_documents;
     std::unordered_map<std::string, rapidjson::SizeType> m_ids;
+
+    /// Number of leading batches passed to the batch handler
+    size_t m_handedOffBatches = 0;
+
+    /// Whether full batches are passed to the batch handler while entries are added
+    bool m_streaming = true;
+
+    /// Whether a batch could not be handled, after which no more entries are added
+    bool m_failed = false;
 };
 
 bool AddressBookCloudUploader::handleUpload(std::shared_ptr<AddressBookEntity> addressBookEntity) {
@@ -860,64 +977,133 @@ bool AddressBookCloudUploader::handleUpload(std::shared_ptr<AddressBookEntity> a
     try {
         addressBookSourceId = addressBookEntity->getSourceId();
 
-        std::vector<std::shared_ptr<rapidjson::Document>> documents;
-        auto factory = std::make_shared<AddressBookEntriesFactory>(addressBookEntity, documents);
+        auto result = uploadAddressBook(addressBookEntity, m_localStorage != nullptr);
+        if (result == UploadResult::REPLACE) {
+            // Too many entries changed, or a changed entry could not be deleted, so replace the cloud address book.
+            AACE_INFO(
+                LX(TAG, "handleUpload").m("replacingCloudAddressBook").d("addressBookSourceId", addressBookSourceId));
+            result = uploadAddressBook(addressBookEntity, false);
+        }
+
+        return result == UploadResult::SUCCESS;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "handleUpload").d("addressBookSourceId", addressBookSourceId).d("reason", ex.what()));
+        return false;
+    }
+}
+
+AddressBookCloudUploader::UploadResult AddressBookCloudUploader::uploadAddressBook(
+    std::shared_ptr<AddressBookEntity> addressBookEntity,
+    bool incremental) {
+    std::string addressBookSourceId = INVALID_ADDRESS_BOOK_SOURCE_ID;
+    UploadSession session;
+    try {
+        addressBookSourceId = addressBookEntity->getSourceId();
+        session.addressBookEntity = addressBookEntity;
+        session.addressBookType = addressBookEntity->toJSONAddressBookType();
+        session.incremental = incremental;
+
+        // Batches are uploaded while the platform is still adding entries.
+        BatchUploadPipeline<std::shared_ptr<rapidjson::Document>> pipeline(
+            MAX_CONCURRENT_UPLOADS, MAX_QUEUED_BATCHES, [this, &session](std::shared_ptr<rapidjson::Document> batch) {
+                return uploadBatch(session, batch);
+            });
+
+        auto factory = std::make_shared<AddressBookEntriesFactory>(
+            addressBookEntity, [this, &session, &pipeline](std::shared_ptr<rapidjson::Document> batch) {
+                //Preparing for the upload
+                if (!session.prepared) {
+                    ReturnIfNot(prepareUploadSession(session), false);
+                    session.prepared = true;
+                }
+
+                auto& entries = (*batch)["entries"];
+                for (auto& entry : entries.GetArray()) {
+                    session.entryIds.insert(entry["entrySourceId"].GetString());
+                }
+                session.numberOfEntries += entries.Size();
+                session.numberOfBatches++;
+
+                return pipeline.push(batch);
+            });
 
         AACE_INFO(LX(TAG, "handleUpload").m("GettingAddressBookEntries").d("addressBookSourceId", addressBookSourceId));
 
-        if (!m_addressBookService->getEntries(addressBookSourceId, factory)) {
+        bool entriesAdded = m_addressBookService->getEntries(addressBookSourceId, factory);
+        bool batchesAdded = factory->flush();
+        bool batchesUploaded = pipeline.finish();
+
+        // Too many entries changed, so the remaining entries were not added.
+        ReturnIf(session.replace, UploadResult::REPLACE);
+
+        // A cloud address book kept from the previous session is not left in the cloud when no entries are uploaded.
+        if ((!entriesAdded || session.numberOfEntries <= 0) && !session.prepared && incremental) {
+            ThrowIfNot(removeUploadedAddressBook(addressBookEntity), "removeUploadedAddressBookFailed");
+        }
+
+        if (!entriesAdded) {
             // getEntries can return false, it probably means OEM was not successful in providing all the entries.
-            // The common reason could be the address book may have become unavailable or not accessible, so do not retry.
+            // The common reason could be the address book may have become unavailable or not accessible. The upload is
+            // only retried if batches were already uploaded; otherwise the address book is dropped.
             AACE_WARN(
                 LX(TAG, "handleUpload").d("addressBookSourceId", addressBookSourceId).d("reason", "getEntriesFailed"));
-            // Return true to drop this address book from retry.
-            return true;
+
+            // Batches were uploaded before getEntries failed, so the cloud address book is incomplete. Delete it, and
+            // retry the upload.
+            if (session.prepared) {
+                if (m_localStorage != nullptr) {
+                    clearUploadIndex(session.addressBookType);
+                }
+                if (!m_addressBookCloudUploaderRESTAgent->deleteCloudAddressBook(session.cloudAddressBookId)) {
+                    AACE_ERROR(LX(TAG, "handleUpload")
+                                   .d("addressBookSourceId", addressBookSourceId)
+                                   .d("reason", "deletePartialCloudAddressBookFailed"));
+                }
+                return UploadResult::FAILED;
+            }
+
+            // Return success to drop this address book from retry.
+            return UploadResult::SUCCESS;
         }
 
-        if (documents.size() <= 0) {
+        if (session.numberOfEntries <= 0) {
             // Its the empty document.
             AACE_WARN(LX(TAG, "handleUpload")
                           .d("addressBookSourceId", addressBookSourceId)
                           .d("reason", "emptyDocumentToUpload"));
-            // Return true to drop this address book from retry.
-            return true;
+            // Return success to drop this address book from retry.
+            return UploadResult::SUCCESS;
         }
 
-        int numberOfEntries = 0;
-        for (auto document : documents) {
-            auto entries = document->FindMember("entries");
-            if (entries != document->MemberEnd()) {
-                numberOfEntries += entries->value.Size();
-            }
-        }
-
-        //Preparing for the upload
-        auto cloudAddressBookId = prepareForUpload(addressBookEntity);
-        ThrowIf(cloudAddressBookId.empty(), "prepareUploadFailed");
-
-        double uploadStartTimer = getCurrentTimeInMs();
+        ThrowIfNot(batchesAdded && batchesUploaded, "uploadDocumentFailed");
 
-        //Upload json document in a loop.
-        for (auto document : documents) {
-            ThrowIfNot(upload(cloudAddressBookId, document), "uploadDocumentFailed");
+        if (session.incremental) {
+            ReturnIfNot(applyEntryChanges(session), UploadResult::REPLACE);
         }
 
         // It is assumed that between contacts and navigation addresses the difference is payload that should not
         // influence the latency for uploading one batch of address book entries.
-        double totalDuration = getCurrentTimeInMs() - uploadStartTimer;
-        double timeToUploadOneBatch = totalDuration / documents.size();
-        emitTimerMetrics(
-            METRIC_PROGRAM_NAME_SUFFIX, "handleUpload", METRIC_TIME_TO_UPLOAD_ONE_BATCH, timeToUploadOneBatch);
+        if (session.numberOfUploadedBatches > 0) {
+            double timeToUploadOneBatch = session.uploadDuration / session.numberOfUploadedBatches;
+            emitTimerMetrics(
+                METRIC_PROGRAM_NAME_SUFFIX, "handleUpload", METRIC_TIME_TO_UPLOAD_ONE_BATCH, timeToUploadOneBatch);
+        }
 
         AACE_INFO(LX(TAG, "handleUpload")
                       .m("SuccessfullyUploaded")
                       .d("addressBookSourceId", addressBookSourceId)
-                      .d("numberOfEntries", numberOfEntries));
+                      .d("numberOfEntries", session.numberOfEntries)
+                      .d("numberOfUploadedEntries", session.numberOfUploadedEntries.load())
+                      .d("incremental", session.incremental));
 
-        return true;
+        return UploadResult::SUCCESS;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "handleUpload").d("addressBookSourceId", addressBookSourceId).d("reason", ex.what()));
-        return false;
+        // The cloud address book may be partially uploaded, so it is replaced by the next upload.
+        if (m_localStorage != nullptr && session.prepared) {
+            clearUploadIndex(session.addressBookType);
+        }
+        AACE_ERROR(LX(TAG, "uploadAddressBook").d("addressBookSourceId", addressBookSourceId).d("reason", ex.what()));
+        return UploadResult::FAILED;
     }
 }
 
@@ -928,6 +1114,10 @@ bool AddressBookCloudUploader::handleRemove(std::shared_ptr<AddressBookEntity> a
 
         ThrowIfNot(deleteAddressBook(addressBookEntity), "addressBookDeleteFailed");
 
+        if (m_localStorage != nullptr) {
+            clearUploadIndex(addressBookEntity->toJSONAddressBookType());
+        }
+
         AACE_INFO(LX(TAG, "handleRemove").m("Removed Successfully").d("addressBookSourceId", addressBookSourceId));
 
         return true;
@@ -1055,13 +1245,14 @@ std::string AddressBookCloudUploader::prepareForUpload(std::shared_ptr<AddressBo
 
 bool AddressBookCloudUploader::upload(
     const std::string& cloudAddressBookId,
-    std::shared_ptr<rapidjson::Document> document) {
+    std::shared_ptr<rapidjson::Document> document,
+    std::queue<std::string>& failedEntries) {
     try {
         auto entries = document->FindMember("entries");
 
         AACE_DEBUG(LX(TAG, "upload").d("entries.Size()", entries->value.Size()));
 
-        ThrowIfNot(uploadEntries(cloudAddressBookId, document), "uploadEntriesFailed");
+        ThrowIfNot(uploadEntries(cloudAddressBookId, document, failedEntries), "uploadEntriesFailed");
 
         return true;
     } catch (std::exception& ex) {
@@ -1072,7 +1263,8 @@ bool AddressBookCloudUploader::upload(
 
 bool AddressBookCloudUploader::uploadEntries(
     const std::string& cloudAddressBookId,
-    std::shared_ptr<rapidjson::Document> document) {
+    std::shared_ptr<rapidjson::Document> document,
+    std::queue<std::string>& failedEntries) {
     HTTPResponse httpResponse;
     auto flowState = UploadFlowState::POST;
     bool success = true;
@@ -1087,7 +1279,7 @@ bool AddressBookCloudUploader::uploadEntries(
                 nextFlowState = handleUploadEntries(cloudAddressBookId, document, httpResponse);
                 break;
             case UploadFlowState::PARSE:
-                nextFlowState = handleParseHTTPResponse(httpResponse);
+                nextFlowState = handleParseHTTPResponse(httpResponse, failedEntries);
                 break;
             case UploadFlowState::ERROR:
                 nextFlowState = handleError(cloudAddressBookId);
@@ -1146,9 +1338,9 @@ AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleUpload
 }
 
 AddressBookCloudUploader::UploadFlowState AddressBookCloudUploader::handleParseHTTPResponse(
-    const HTTPResponse& httpResponse) {
+    const HTTPResponse& httpResponse,
+    std::queue<std::string>& failedEntries) {
     try {
-        std::queue<std::string> failedEntries;
         ThrowIfNot(
             m_addressBookCloudUploaderRESTAgent->parseCreateAddressBookEntryResponse(httpResponse, failedEntries),
             "responseJsonParseFailed");
@@ -1250,37 +1442,329 @@ bool AddressBookCloudUploader::cleanAllCloudAddressBooks() {
 
         auto dsn = m_deviceInfo->getDeviceSerialNumber();
 
-        // Delete Contact Address book
-        std::string cloudAddressBookId;
-        ThrowIfNot(
-            m_addressBookCloudUploaderRESTAgent->getCloudAddressBookId(dsn, "automotive", cloudAddressBookId),
-            "getCloudAddressBookIdFailed");
-        if (!cloudAddressBookId.empty()) {
+        // Delete Contact and Navigation Address books
+        for (auto& addressBookType : CLOUD_ADDRESS_BOOK_TYPES) {
+            std::string cloudAddressBookId;
             ThrowIfNot(
-                m_addressBookCloudUploaderRESTAgent->deleteCloudAddressBook(cloudAddressBookId),
-                "deleteCloudAddressBookFailed");
+                m_addressBookCloudUploaderRESTAgent->getCloudAddressBookId(dsn, addressBookType, cloudAddressBookId),
+                "getCloudAddressBookIdFailed");
+
+            // Keep the cloud address book described by the persisted upload index, whether or not the address book
+            // it was uploaded from has been added yet. When that address book is added again, only its changed
+            // entries are uploaded, and a different address book replaces the cloud address book.
+            if (m_localStorage != nullptr && isIndexedCloudAddressBook(addressBookType, cloudAddressBookId)) {
+                AACE_INFO(LX(TAG, "cleanAllCloudAddressBooks")
+                              .m("keepingIndexedAddressBook")
+                              .d("addressBookType", addressBookType));
+                continue;
+            }
+
+            // The cloud address book is an orphan that the upload index does not describe
+            if (!cloudAddressBookId.empty()) {
+                ThrowIfNot(
+                    m_addressBookCloudUploaderRESTAgent->deleteCloudAddressBook(cloudAddressBookId),
+                    "deleteCloudAddressBookFailed");
+            }
+
+            if (m_localStorage != nullptr) {
+                clearUploadIndex(addressBookType);
+            }
+        }
+
+        return true;
+
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "cleanAllCloudAddressBooks").d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AddressBookCloudUploader::prepareUploadSession(UploadSession& session) {
+    try {
+        if (!session.incremental) {
+            if (m_localStorage != nullptr) {
+                clearUploadIndex(session.addressBookType);
+            }
+
+            session.cloudAddressBookId = prepareForUpload(session.addressBookEntity);
+            ThrowIf(session.cloudAddressBookId.empty(), "prepareUploadFailed");
+
+            if (m_localStorage != nullptr) {
+                ThrowIfNot(
+                    saveUploadState(
+                        session.addressBookType, session.cloudAddressBookId, session.addressBookEntity->getSourceId()),
+                    "saveUploadStateFailed");
+            }
+
+            return true;
         }
 
-        // Delete Navigation Address book
-        cloudAddressBookId = "";
+        ThrowIfNot(m_addressBookCloudUploaderRESTAgent->isAccountProvisioned(), "accountNotProvisioned");
+
+        auto dsn = m_deviceInfo->getDeviceSerialNumber();  // Use DSN as addressBookSourceId.
+
+        std::string cloudAddressBookId;
         ThrowIfNot(
             m_addressBookCloudUploaderRESTAgent->getCloudAddressBookId(
-                dsn, "automotivePostalAddress", cloudAddressBookId),
+                dsn, session.addressBookType, cloudAddressBookId),
             "getCloudAddressBookIdFailed");
-        if (!cloudAddressBookId.empty()) {
+
+        // The index is only valid for the cloud address book it was uploaded to, and for the address book it was
+        // uploaded from. A different phone replaces the cloud address book, and so does every upload once the
+        // service rejected a request to delete a single entry.
+        std::string uploadedAddressBookId;
+        std::string uploadedSourceId;
+        loadUploadState(session.addressBookType, uploadedAddressBookId, uploadedSourceId);
+        session.incremental = !cloudAddressBookId.empty() && cloudAddressBookId == uploadedAddressBookId &&
+                              uploadedSourceId == session.addressBookEntity->getSourceId() &&
+                              m_addressBookCloudUploaderRESTAgent->isEntryDeleteSupported();
+
+        // Otherwise replace the cloud address book.
+        if (!session.incremental) {
+            clearUploadIndex(session.addressBookType);
+
+            if (!cloudAddressBookId.empty()) {
+                ThrowIfNot(
+                    m_addressBookCloudUploaderRESTAgent->deleteCloudAddressBook(cloudAddressBookId),
+                    "deleteCloudAddressBookFailed");
+            }
+
+            cloudAddressBookId = createAddressBook(session.addressBookEntity);
+            ThrowIf(cloudAddressBookId.empty(), "addressBookCreateFailed");
+
             ThrowIfNot(
-                m_addressBookCloudUploaderRESTAgent->deleteCloudAddressBook(cloudAddressBookId),
-                "deleteCloudAddressBookFailed");
+                saveUploadState(session.addressBookType, cloudAddressBookId, session.addressBookEntity->getSourceId()),
+                "saveUploadStateFailed");
+        } else {
+            session.uploadIndex = loadUploadIndex(session.addressBookType);
+            session.maxDeletedEntries = std::min(
+                MAX_INCREMENTAL_DELETED_ENTRIES,
+                static_cast<size_t>(session.uploadIndex.size() * MAX_INCREMENTAL_DELETED_ENTRIES_RATIO));
         }
 
+        session.cloudAddressBookId = cloudAddressBookId;
+
         return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(
+            LX(TAG, "prepareUploadSession").d("addressBookType", session.addressBookType).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AddressBookCloudUploader::uploadBatch(UploadSession& session, std::shared_ptr<rapidjson::Document> batch) {
+    try {
+        auto indexTable = UPLOAD_INDEX_TABLE_PREFIX + session.addressBookType;
+        auto& entries = (*batch)["entries"];
+
+        // Skip the entries that did not change since they were uploaded. The changed entries are uploaded once
+        // their previous version has been deleted.
+        std::vector<std::pair<std::string, std::string>> entryHashes;
+        if (m_localStorage != nullptr) {
+            for (auto it = entries.Begin(); it != entries.End();) {
+                std::string entryId = (*it)["entrySourceId"].GetString();
+                auto hash = computeEntryHash(*it);
+
+                auto indexed = session.uploadIndex.find(entryId);
+                if (indexed != session.uploadIndex.end()) {
+                    if (indexed->second != hash) {
+                        std::lock_guard<std::mutex> lock(session.changedEntriesMutex);
+                        if (session.changedEntries == nullptr) {
+                            session.changedEntries = std::make_shared<rapidjson::Document>();
+                            session.changedEntries->SetObject();
+                            rapidjson::Value changedEntries(rapidjson::kArrayType);
+                            session.changedEntries->AddMember(
+                                "entries", changedEntries, session.changedEntries->GetAllocator());
+                        }
+
+                        auto& allocator = session.changedEntries->GetAllocator();
+                        auto& changedEntries = (*session.changedEntries)["entries"];
+                        rapidjson::Value changedEntry(*it, allocator);
+                        changedEntries.PushBack(changedEntry, allocator);
+
+                        if (changedEntries.Size() > session.maxDeletedEntries) {
+                            session.replace = true;
+                            Throw("tooManyChangedEntries");
+                        }
+                    }
+                    it = entries.Erase(it);
+                    continue;
+                }
+
+                entryHashes.emplace_back(entryId, hash);
+                ++it;
+            }
+        }
+
+        ReturnIf(entries.Empty(), true);
+
+        double uploadStartTimer = getCurrentTimeInMs();
 
+        std::queue<std::string> failedEntries;
+        ThrowIfNot(upload(session.cloudAddressBookId, batch, failedEntries), "uploadDocumentFailed");
+
+        session.numberOfUploadedEntries += entries.Size();
+        {
+            std::lock_guard<std::mutex> lock(session.uploadDurationMutex);
+            session.uploadDuration += getCurrentTimeInMs() - uploadStartTimer;
+            session.numberOfUploadedBatches++;
+        }
+
+        // Record the uploaded entries, so they are not uploaded again until they change.
+        if (m_localStorage != nullptr) {
+            std::unordered_set<std::string> failed;
+            for (; !failedEntries.empty(); failedEntries.pop()) {
+                failed.insert(failedEntries.front());
+            }
+
+            for (auto& entryHash : entryHashes) {
+                if (failed.count(entryHash.first) == 0) {
+                    m_localStorage->put(indexTable, entryHash.first, entryHash.second);
+                }
+            }
+        }
+
+        return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "cleanAllCloudAddressBooks").d("reason", ex.what()));
+        AACE_ERROR(LX(TAG, "uploadBatch").d("addressBookType", session.addressBookType).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AddressBookCloudUploader::applyEntryChanges(UploadSession& session) {
+    try {
+        auto indexTable = UPLOAD_INDEX_TABLE_PREFIX + session.addressBookType;
+
+        // The removed entries, and the previous version of the changed entries, are deleted one by one.
+        std::vector<std::string> deletedEntryIds;
+        for (auto& it : session.uploadIndex) {
+            if (session.entryIds.count(it.first) == 0) {
+                deletedEntryIds.push_back(it.first);
+            }
+        }
+        if (session.changedEntries != nullptr) {
+            for (auto& entry : (*session.changedEntries)["entries"].GetArray()) {
+                deletedEntryIds.push_back(entry["entrySourceId"].GetString());
+            }
+        }
+
+        // Replacing the cloud address book takes fewer requests when many entries changed.
+        ThrowIf(deletedEntryIds.size() > session.maxDeletedEntries, "tooManyDeletedEntries");
+
+        for (auto& entryId : deletedEntryIds) {
+            ThrowIfNot(
+                m_addressBookCloudUploaderRESTAgent->deleteCloudAddressBookEntry(session.cloudAddressBookId, entryId),
+                "deleteCloudAddressBookEntryFailed");
+            m_localStorage->removeKey(indexTable, entryId);
+            session.uploadIndex.erase(entryId);
+        }
+
+        // The changed entries are no longer in the index, so they are uploaded as new entries.
+        if (session.changedEntries != nullptr) {
+            ThrowIfNot(uploadBatch(session, session.changedEntries), "uploadChangedEntriesFailed");
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "applyEntryChanges").d("addressBookType", session.addressBookType).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AddressBookCloudUploader::loadUploadState(
+    const std::string& addressBookType,
+    std::string& cloudAddressBookId,
+    std::string& addressBookSourceId) {
+    try {
+        auto state = m_localStorage->get(UPLOAD_STATE_TABLE, addressBookType, "");
+        ReturnIf(state.empty(), false);
+
+        auto stateJson = json::parse(state);
+        cloudAddressBookId = stateJson.at("cloudAddressBookId").get<std::string>();
+        addressBookSourceId = stateJson.at("addressBookSourceId").get<std::string>();
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG, "loadUploadState").d("addressBookType", addressBookType).d("reason", ex.what()));
         return false;
     }
 }
 
+bool AddressBookCloudUploader::saveUploadState(
+    const std::string& addressBookType,
+    const std::string& cloudAddressBookId,
+    const std::string& addressBookSourceId) {
+    json stateJson = {{"cloudAddressBookId", cloudAddressBookId}, {"addressBookSourceId", addressBookSourceId}};
+    return m_localStorage->put(UPLOAD_STATE_TABLE, addressBookType, stateJson.dump());
+}
+
+bool AddressBookCloudUploader::removeUploadedAddressBook(std::shared_ptr<AddressBookEntity> addressBookEntity) {
+    std::string cloudAddressBookId;
+    std::string addressBookSourceId;
+    auto addressBookType = addressBookEntity->toJSONAddressBookType();
+    ReturnIfNot(loadUploadState(addressBookType, cloudAddressBookId, addressBookSourceId), true);
+    ReturnIf(addressBookSourceId != addressBookEntity->getSourceId(), true);
+
+    ReturnIfNot(deleteAddressBook(addressBookEntity), false);
+    clearUploadIndex(addressBookType);
+
+    return true;
+}
+
+bool AddressBookCloudUploader::isIndexedCloudAddressBook(
+    const std::string& addressBookType,
+    const std::string& cloudAddressBookId) {
+    ReturnIf(cloudAddressBookId.empty(), false);
+
+    std::string uploadedAddressBookId;
+    std::string addressBookSourceId;
+    ReturnIfNot(loadUploadState(addressBookType, uploadedAddressBookId, addressBookSourceId), false);
+
+    return uploadedAddressBookId == cloudAddressBookId;
+}
+
+std::unordered_map<std::string, std::string> AddressBookCloudUploader::loadUploadIndex(
+    const std::string& addressBookType) {
+    std::unordered_map<std::string, std::string> uploadIndex;
+
+    auto indexTable = UPLOAD_INDEX_TABLE_PREFIX + addressBookType;
+    if (m_localStorage->containsTable(indexTable)) {
+        for (auto& it : m_localStorage->list(indexTable)) {
+            uploadIndex.insert(it);
+        }
+    }
+
+    return uploadIndex;
+}
+
+void AddressBookCloudUploader::clearUploadIndex(const std::string& addressBookType) {
+    auto indexTable = UPLOAD_INDEX_TABLE_PREFIX + addressBookType;
+    if (m_localStorage->containsTable(indexTable)) {
+        m_localStorage->removeTable(indexTable);
+    }
+    if (m_localStorage->containsKey(UPLOAD_STATE_TABLE, addressBookType)) {
+        m_localStorage->removeKey(UPLOAD_STATE_TABLE, addressBookType);
+    }
+}
+
+std::string AddressBookCloudUploader::computeEntryHash(const rapidjson::Value& entry) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    entry.Accept(writer);
+
+    // 64 bit FNV-1a hash of the serialized entry
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < buffer.GetSize(); i++) {
+        hash ^= static_cast<unsigned char>(buffer.GetString()[i]);
+        hash *= 1099511628211ULL;
+    }
+
+    char hex[17];
+    snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+
+    return hex;
+}
+
 }  // namespace addressBook
 }  // namespace engine
 }  // namespace aace
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <cctype>
+
 #include <AACE/Engine/Core/EngineMacros.h>
 #include <AACE/Engine/AddressBook/AddressBookCloudUploaderRESTAgent.h>
 
@@ -71,6 +73,10 @@ static const std::chrono::seconds DEFAULT_HTTP_TIMEOUT = std::chrono::seconds(60
 /// Default value for the HTTP retry on Network Error.
 static const int HTTP_RETRY_COUNT = 3;
 
+/// HTTP response codes of a request the service does not support
+static const long HTTP_METHOD_NOT_ALLOWED = 405;
+static const long HTTP_NOT_IMPLEMENTED = 501;
+
 /// REST URL to upload the address book
 static const std::string DEFAULT_ACMS_ENDPOINT = "https://alexa-comms-mobile-service-na.amazon.com";
 
@@ -89,6 +95,22 @@ static const std::string ENTRIES_PATH = "entries";
 /// Forward slash separator used in URL
 static const std::string FORWARD_SLASH = "/";
 
+/// Percent-encodes a value used as a URL path segment
+static std::string encodeURLPathSegment(const std::string& value) {
+    static const char* HEX_DIGITS = "0123456789ABCDEF";
+    std::string encoded;
+    for (unsigned char c : value) {
+        if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+            encoded += static_cast<char>(c);
+        } else {
+            encoded += '%';
+            encoded += HEX_DIGITS[c >> 4];
+            encoded += HEX_DIGITS[c & 0x0F];
+        }
+    }
+    return encoded;
+}
+
 /// Path suffix for URL used in ACMS Get IndentityV2 Request
 static const std::string GET_INDENTITY_V2_QUERY = "/identities?includeUserName=false";
 
@@ -534,6 +556,48 @@ bool AddressBookCloudUploaderRESTAgent::deleteCloudAddressBook(const std::string
     }
 }
 
+bool AddressBookCloudUploaderRESTAgent::deleteCloudAddressBookEntry(
+    const std::string& addressBookId,
+    const std::string& entrySourceId) {
+    AddressBookCloudUploaderRESTAgent::HTTPResponse httpResponse;
+    bool validFlag = false;
+
+    auto httpHeaderData = buildCommonHTTPHeader();
+    try {
+        auto url = m_acmsEndpoint + FORWARD_SLASH + USERS_PATH + FORWARD_SLASH + getPceId() + FORWARD_SLASH +
+                   ADDRESSBOOK_PATH + FORWARD_SLASH + addressBookId + FORWARD_SLASH + ENTRIES_PATH + FORWARD_SLASH +
+                   encodeURLPathSegment(entrySourceId);
+        for (int retry = 0; retry < HTTP_RETRY_COUNT; retry++) {
+            httpResponse = doDelete(url, httpHeaderData);
+            if (parseCommonHTTPResponse(httpResponse)) {
+                validFlag = true;
+                break;
+            }
+            // Entries are not deleted one by one after the service rejects it, so cloud address books are replaced
+            // instead.
+            if (httpResponse.code == HTTP_METHOD_NOT_ALLOWED || httpResponse.code == HTTP_NOT_IMPLEMENTED) {
+                AACE_WARN(LX(TAG, "deleteCloudAddressBookEntry").d("reason", "entryDeleteNotSupported"));
+                m_entryDeleteSupported = false;
+                break;
+            }
+            // Client errors are not retried. The caller replaces the cloud address book instead.
+            if (httpResponse.code >= HTTPResponseCode::BAD_REQUEST &&
+                httpResponse.code < HTTPResponseCode::SERVER_INTERNAL_ERROR) {
+                break;
+            }
+        }
+        ThrowIfNot(validFlag, "httpDoDeleteFailed" + getHTTPErrorString(httpResponse));
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "deleteCloudAddressBookEntry").d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool AddressBookCloudUploaderRESTAgent::isEntryDeleteSupported() {
+    return m_entryDeleteSupported;
+}
+
 std::string AddressBookCloudUploaderRESTAgent::buildFailedEntriesJson(std::queue<std::string>& failedList) {
     rapidjson::Document document;
     document.SetObject();
@@ -113,8 +113,19 @@ bool AddressBookEngineService::registerPlatformInterfaceType(
             getContext()->getServiceInterface<aace::engine::alexa::AlexaEndpointInterface>("aace.alexa");
         ThrowIfNull(alexaEndpoints, "alexaEndpointsInvalid");
 
+        // the upload index is kept in local storage, so only the changed entries are uploaded
+        auto localStorage =
+            getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>("aace.storage");
+        ThrowIfNull(localStorage, "invalidLocalStorage");
+
         m_addressBookCloudUploader = aace::engine::addressBook::AddressBookCloudUploader::create(
-            m_addressBookEngineImpl, authDelegate, deviceInfo, networkStatus, networkObserver, alexaEndpoints);
+            m_addressBookEngineImpl,
+            authDelegate,
+            deviceInfo,
+            networkStatus,
+            networkObserver,
+            alexaEndpoints,
+            localStorage);
         ThrowIfNull(m_addressBookCloudUploader, "createAddressBookCloudUploaderFailed");
 
         // set the engine interface reference
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <AACE/Engine/AddressBook/BatchUploadPipeline.h>
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using aace::engine::addressBook::BatchUploadPipeline;
+
+/// How long a test waits for an upload to start.
+static const std::chrono::seconds TEST_TIMEOUT(5);
+
+/// The number of concurrent uploads used by the tests.
+static const size_t MAX_CONCURRENT_UPLOADS = 2;
+
+/// The number of batches queued by the tests before adding a batch blocks.
+static const size_t MAX_QUEUED_BATCHES = 2;
+
+/**
+ * Records the batches passed to the upload function, and holds the uploads until they are released.
+ */
+class TestUploader {
+public:
+    bool upload(int batch) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_started.push_back(batch);
+        m_active++;
+        m_trigger.notify_all();
+
+        m_trigger.wait_for(lock, TEST_TIMEOUT, [this]() { return m_released; });
+        m_active--;
+        return batch != m_failingBatch;
+    }
+
+    void hold() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_released = false;
+    }
+
+    void release() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_released = true;
+        m_trigger.notify_all();
+    }
+
+    void failBatch(int batch) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_failingBatch = batch;
+    }
+
+    bool waitForActiveUploads(int count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_trigger.wait_for(lock, TEST_TIMEOUT, [this, count]() { return m_active == count; });
+    }
+
+    std::vector<int> getStarted() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_started;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_trigger;
+    std::vector<int> m_started;
+    int m_active = 0;
+    bool m_released = true;
+    int m_failingBatch = -1;
+};
+
+class BatchUploadPipelineTest : public ::testing::Test {
+protected:
+    std::unique_ptr<BatchUploadPipeline<int>> createPipeline(size_t maxConcurrentUploads = MAX_CONCURRENT_UPLOADS) {
+        return std::unique_ptr<BatchUploadPipeline<int>>(new BatchUploadPipeline<int>(
+            maxConcurrentUploads, MAX_QUEUED_BATCHES, [this](int batch) { return m_uploader.upload(batch); }));
+    }
+
+    TestUploader m_uploader;
+};
+
+/**
+ * Test that the batches are uploaded in the order they were added by a single upload thread.
+ */
+TEST_F(BatchUploadPipelineTest, uploadsInOrder) {
+    auto pipeline = createPipeline(1);
+
+    for (int j = 0; j < 10; j++) {
+        ASSERT_TRUE(pipeline->push(j));
+    }
+    EXPECT_TRUE(pipeline->finish());
+
+    std::vector<int> expected = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(expected, m_uploader.getStarted());
+}
+
+/**
+ * Test that every batch is uploaded exactly once by concurrent upload threads, which take the batches in the
+ * order they were added.
+ */
+TEST_F(BatchUploadPipelineTest, uploadsEveryBatchOnceConcurrently) {
+    auto pipeline = createPipeline();
+    m_uploader.hold();
+
+    // the first two batches are taken in order before either upload completes
+    ASSERT_TRUE(pipeline->push(0));
+    ASSERT_TRUE(m_uploader.waitForActiveUploads(1));
+    ASSERT_TRUE(pipeline->push(1));
+    ASSERT_TRUE(m_uploader.waitForActiveUploads(2));
+    m_uploader.release();
+
+    for (int j = 2; j < 10; j++) {
+        ASSERT_TRUE(pipeline->push(j));
+    }
+    EXPECT_TRUE(pipeline->finish());
+
+    auto started = m_uploader.getStarted();
+    EXPECT_EQ(0, started[0]);
+    EXPECT_EQ(1, started[1]);
+
+    std::sort(started.begin(), started.end());
+    std::vector<int> expected = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(expected, started);
+}
+
+/**
+ * Test that no more than the maximum number of batches are uploaded concurrently, and that adding a batch
+ * blocks while the queue is full.
+ */
+TEST_F(BatchUploadPipelineTest, addingBlocksWhileQueueIsFull) {
+    auto pipeline = createPipeline();
+    m_uploader.hold();
+
+    // two batches are uploading, and two are queued
+    for (int j = 0; j < 4; j++) {
+        ASSERT_TRUE(pipeline->push(j));
+        if (j < 2) {
+            ASSERT_TRUE(m_uploader.waitForActiveUploads(j + 1));
+        }
+    }
+
+    auto pushed = std::async(std::launch::async, [&pipeline]() { return pipeline->push(4); });
+    EXPECT_EQ(std::future_status::timeout, pushed.wait_for(std::chrono::milliseconds(100)));
+    EXPECT_EQ(2u, m_uploader.getStarted().size());
+
+    m_uploader.release();
+    EXPECT_TRUE(pushed.get());
+    EXPECT_TRUE(pipeline->finish());
+    EXPECT_EQ(5u, m_uploader.getStarted().size());
+}
+
+/**
+ * Test that a failed upload drops the queued batches, fails the next batches added, and is reported by
+ * @c finish().
+ */
+TEST_F(BatchUploadPipelineTest, failureIsPropagated) {
+    auto pipeline = createPipeline();
+    m_uploader.hold();
+    m_uploader.failBatch(0);
+
+    for (int j = 0; j < 4; j++) {
+        ASSERT_TRUE(pipeline->push(j));
+        if (j < 2) {
+            ASSERT_TRUE(m_uploader.waitForActiveUploads(j + 1));
+        }
+    }
+
+    m_uploader.release();
+
+    // adding fails once the failure is observed, which unblocks a producer waiting for space
+    bool pushed = true;
+    for (int j = 4; j < 100 && pushed; j++) {
+        pushed = pipeline->push(j);
+    }
+    EXPECT_FALSE(pushed);
+    EXPECT_FALSE(pipeline->finish());
+
+    // the batches queued after the failure are not uploaded
+    auto started = m_uploader.getStarted();
+    EXPECT_LT(started.size(), 100u);
+    EXPECT_EQ(0, started[0]);
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
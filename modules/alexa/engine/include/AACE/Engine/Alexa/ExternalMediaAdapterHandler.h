@@ -16,6 +16,7 @@
 #ifndef AACE_ENGINE_ALEXA_EXTERNAL_MEDIA_ADAPTER_HANDLER_H
 #define AACE_ENGINE_ALEXA_EXTERNAL_MEDIA_ADAPTER_HANDLER_H
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -67,6 +68,12 @@ protected:
         std::function<void(rapidjson::Value::Object&, rapidjson::Value::AllocatorType&)> createPayload =
             [](rapidjson::Value::Object& v, rapidjson::Value::AllocatorType& a) {});
 
+    /**
+     * Marks the cached state of a player as changed, so the state is requested from the adapter
+     * implementation the next time it is needed.
+     */
+    void adapterStateChanged(const std::string& localPlayerId);
+
     void reportDiscoveredPlayers(
         const std::vector<aace::alexa::ExternalMediaAdapter::DiscoveredPlayerInfo>& discoveredPlayers);
     bool removeDiscoveredPlayer(const std::string& localPlayerId);
@@ -140,6 +147,9 @@ public:
         alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface::SpeakerSettings* settings) const override;
     alexaClientSDK::avsCommon::sdkInterfaces::ChannelVolumeInterface::Type getSpeakerType() const override;
 
+private:
+    bool getCachedAdapterState(const std::string& localPlayerId, AdapterState& state);
+
 private:
     std::weak_ptr<DiscoveredPlayerSenderInterface> m_discoveredPlayerSender;
     std::weak_ptr<FocusHandlerInterface> m_focusHandler;
@@ -150,6 +160,22 @@ private:
     bool m_muted;
     int8_t m_volume;
 
+    /**
+     * The last state reported by each player, keyed by local player id. The change count is
+     * incremented each time the player reports a change, so a state that is requested while the
+     * player changes is not cached. The time the state was reported is used to advance the track
+     * offset of a playing player.
+     */
+    struct CachedAdapterState {
+        AdapterState state;
+        std::chrono::steady_clock::time_point time;
+        bool valid = false;
+        uint64_t changeCount = 0;
+    };
+    std::unordered_map<std::string, CachedAdapterState> m_adapterStateCache;
+    uint64_t m_adapterStateVersion = 0;
+    std::mutex m_adapterStateMutex;
+
     /**
      * Serializes generic access. Used for delaying focus state change.
      */
@@ -402,6 +402,10 @@ public:
 
     /// Variable to hold the playback state.
     AdapterPlaybackState playbackState;
+
+    /// Identifies a cached state, which is unchanged as long as the version is unchanged, or 0 if the state is not
+    /// cached.
+    uint64_t version = 0;
 };
 
 /**
@@ -304,6 +304,31 @@ private:
     // adapterHandler specific code
     std::string providePlaybackState(std::vector<aace::engine::alexa::AdapterState> adapterStates);
 
+    /**
+     * The session and playback state of an adapter handler player, serialized for the context.
+     */
+    struct SerializedPlayerState {
+        uint64_t version = 0;
+        std::string sessionState;
+        std::string playbackState;
+    };
+
+    /**
+     * Returns the serialized state of an adapter handler player. The state is serialized again only if
+     * the player's state version has changed since it was last serialized.
+     *
+     * @note This function must be called from @c m_executor.
+     */
+    const SerializedPlayerState& getSerializedPlayerState(const aace::engine::alexa::AdapterState& adapterState);
+
+    /**
+     * Removes the serialized state of each adapter handler player that is not in @c adapterStates, such as a
+     * player that was removed or logged out.
+     *
+     * @note This function must be called from @c m_executor.
+     */
+    void removeSerializedPlayerStates(const std::vector<aace::engine::alexa::AdapterState>& adapterStates);
+
     /**
      * This function deserializes a @c Directive's payload into a @c rapidjson::Document.
      *
@@ -584,6 +609,9 @@ private:
     /// A map of cloud assigned @c playerId to localPlayerId. Unauthorized adapters will not be in this map.
     std::unordered_map<std::string, std::string> m_authorizedAdapters;
 
+    /// The serialized state of each adapter handler player, keyed by @c playerId. Only accessed from @c m_executor.
+    std::unordered_map<std::string, SerializedPlayerState> m_serializedPlayerStates;
+
     /// The id of the player which currently has focus.  Access to @c m_playerInFocus is protected by @c
     /// m_inFocusAdapterMutex.
     /// TODO: Consolidate m_playerInFocus and m_adapterInFocus.
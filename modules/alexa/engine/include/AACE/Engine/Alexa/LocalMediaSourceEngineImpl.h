@@ -17,7 +17,9 @@
 #define AACE_ENGINE_ALEXA_LOCAL_MEDIA_SOURCE_ENGINE_IMPL_H
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "ExternalMediaAdapterInterface.h"
 #include "ExternalMediaPlayerInterface.h"
@@ -100,12 +102,20 @@ protected:
 
     void doShutdown() override;
 
+private:
+    std::string getPlayerCookie(const std::vector<ContentSelector>& supportedContentSelectors);
+
 private:
     std::shared_ptr<aace::alexa::LocalMediaSource> m_platformLocalMediaSource;
     std::weak_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> m_messageSender;
 
     std::string m_localPlayerId;
     std::unordered_map<std::string, ContentSelector> m_contentSelectorNameMap;
+
+    // the player cookie is serialized again only when the supported content selectors change
+    std::string m_playerCookie;
+    std::vector<ContentSelector> m_playerCookieContentSelectors;
+    std::mutex m_playerCookieMutex;
 };
 
 }  // namespace alexa
@@ -16,6 +16,7 @@
 #ifndef AACE_ENGINE_ALEXA_SPEECH_RECOGNIZER_ENGINE_IMPL_H
 #define AACE_ENGINE_ALEXA_SPEECH_RECOGNIZER_ENGINE_IMPL_H
 
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -166,9 +167,6 @@ private:
 
     bool initializeAudioInputStream();
 
-    //void setExpectingAudioState( bool state );
-    bool waitForExpectingAudioState(bool state, const std::chrono::seconds duration = std::chrono::seconds(3));
-
     bool startAudioInput();
     bool stopAudioInput();
     bool isExpectingAudio();
@@ -183,8 +181,8 @@ private:
     std::unique_ptr<alexaClientSDK::avsCommon::avs::AudioInputStream::Writer> m_audioInputWriter;
 
     std::shared_ptr<aace::engine::audio::AudioInputChannelInterface> m_audioInputChannel;
-    aace::engine::audio::AudioInputChannelInterface::ChannelId m_currentChannelId =
-        aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL;
+    std::atomic<aace::engine::audio::AudioInputChannelInterface::ChannelId> m_currentChannelId{
+        aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL};
 
     unsigned int m_wordSize;
 
@@ -199,10 +197,6 @@ private:
     // the aip state
     AudioInputProcessorObserverInterface::State m_state;
 
-    // mutex for blocking
-    std::mutex m_expectingAudioMutex;
-    std::condition_variable m_expectingAudioState_cv;
-
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::DirectiveSequencerInterface> m_directiveSequencer;
 
     std::shared_ptr<alexaClientSDK::avsCommon::avs::DialogUXStateAggregator> m_dialogUXStateAggregator;
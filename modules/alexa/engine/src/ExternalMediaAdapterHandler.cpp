@@ -15,6 +15,7 @@
 
 #include <AVSCommon/AVS/EventBuilder.h>
 
+#include "AACE/Engine/Alexa/ExternalMediaAdapterConstants.h"
 #include "AACE/Engine/Alexa/ExternalMediaAdapterHandler.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 
@@ -75,6 +76,8 @@ bool ExternalMediaAdapterHandler::setFocus(const std::string& localPlayerId, boo
         auto playerInfo = m_playerInfoMap[localPlayerId];
         auto playerId = playerInfo.playerId;
 
+        adapterStateChanged(localPlayerId);
+
         auto focusHandler_lock = m_focusHandler.lock();
         ThrowIfNull(focusHandler_lock, "invalidFocusHandler");
 
@@ -136,6 +139,8 @@ std::vector<PlayerInfo> ExternalMediaAdapterHandler::authorizeDiscoveredPlayers(
 
                 // add an entry to the alexa to local player id map
                 m_alexaToLocalPlayerIdMap[next.playerId] = next.localPlayerId;
+
+                adapterStateChanged(next.localPlayerId);
             }
         }
 
@@ -160,6 +165,9 @@ bool ExternalMediaAdapterHandler::login(
         auto it = m_alexaToLocalPlayerIdMap.find(playerId);
         ThrowIf(it == m_alexaToLocalPlayerIdMap.end(), "invalidPlayerId");
 
+        // the directive is expected to change the player state
+        adapterStateChanged(it->second);
+
         // call the platform media adapter
         ThrowIfNot(
             handleLogin(it->second, accessToken, userName, forceLogin, tokenRefreshInterval), "handleLoginFailed");
@@ -180,6 +188,9 @@ bool ExternalMediaAdapterHandler::logout(const std::string& playerId) {
         auto it = m_alexaToLocalPlayerIdMap.find(playerId);
         ThrowIf(it == m_alexaToLocalPlayerIdMap.end(), "invalidPlayerId");
 
+        // the directive is expected to change the player state
+        adapterStateChanged(it->second);
+
         // call the platform media adapter
         ThrowIfNot(handleLogout(it->second), "handleLogoutFailed");
 
@@ -219,6 +230,9 @@ bool ExternalMediaAdapterHandler::play(
         auto it = m_alexaToLocalPlayerIdMap.find(playerId);
         ThrowIf(it == m_alexaToLocalPlayerIdMap.end(), "invalidPlayerId");
 
+        // the directive is expected to change the player state
+        adapterStateChanged(it->second);
+
         // get the local player id
         auto localPlayerId = it->second;
 
@@ -256,6 +270,9 @@ bool ExternalMediaAdapterHandler::playControl(
         auto it = m_alexaToLocalPlayerIdMap.find(playerId);
         ThrowIf(it == m_alexaToLocalPlayerIdMap.end(), "invalidPlayerId");
 
+        // the directive is expected to change the player state
+        adapterStateChanged(it->second);
+
         // convert RequestType to PlayControlType
         using RequestType = aace::engine::alexa::RequestType;
         using PlayControlType = aace::alexa::ExternalMediaAdapter::PlayControlType;
@@ -331,6 +348,9 @@ bool ExternalMediaAdapterHandler::seek(const std::string& playerId, std::chrono:
         auto it = m_alexaToLocalPlayerIdMap.find(playerId);
         ThrowIf(it == m_alexaToLocalPlayerIdMap.end(), "invalidPlayerId");
 
+        // the directive is expected to change the player state
+        adapterStateChanged(it->second);
+
         // call the platform media adapter
         ThrowIfNot(handleSeek(it->second, offset), "handleSeekFailed");
 
@@ -346,6 +366,9 @@ bool ExternalMediaAdapterHandler::adjustSeek(const std::string& playerId, std::c
         auto it = m_alexaToLocalPlayerIdMap.find(playerId);
         ThrowIf(it == m_alexaToLocalPlayerIdMap.end(), "invalidPlayerId");
 
+        // the directive is expected to change the player state
+        adapterStateChanged(it->second);
+
         // call the platform media adapter
         ThrowIfNot(handleAdjustSeek(it->second, deltaOffset), "handleAdjustSeekFailed");
 
@@ -377,7 +400,7 @@ std::vector<aace::engine::alexa::AdapterState> ExternalMediaAdapterHandler::getA
 
                 if (all) {
                     // get the player state from the adapter implementation
-                    ThrowIfNot(handleGetAdapterState(playerInfo.localPlayerId, state), "handleGetAdapterStateFailed");
+                    ThrowIfNot(getCachedAdapterState(playerInfo.localPlayerId, state), "handleGetAdapterStateFailed");
                 }
 
                 adapterStateList.push_back(state);
@@ -404,6 +427,57 @@ std::chrono::milliseconds ExternalMediaAdapterHandler::getOffset(const std::stri
     }
 }
 
+void ExternalMediaAdapterHandler::adapterStateChanged(const std::string& localPlayerId) {
+    std::lock_guard<std::mutex> lock(m_adapterStateMutex);
+    auto& cached = m_adapterStateCache[localPlayerId];
+    cached.valid = false;
+    cached.changeCount++;
+}
+
+bool ExternalMediaAdapterHandler::getCachedAdapterState(const std::string& localPlayerId, AdapterState& state) {
+    uint64_t changeCount;
+    {
+        std::lock_guard<std::mutex> lock(m_adapterStateMutex);
+        auto& cached = m_adapterStateCache[localPlayerId];
+
+        if (cached.valid) {
+            state = cached.state;
+
+            // the track offset of a playing player advances without an event, so it is extrapolated from the
+            // time the state was cached, and the state is serialized again
+            if (state.playbackState.state == PLAYING) {
+                auto& playbackState = state.playbackState;
+                playbackState.trackOffset += std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - cached.time);
+                if (playbackState.duration.count() > 0 && playbackState.trackOffset > playbackState.duration) {
+                    playbackState.trackOffset = playbackState.duration;
+                }
+                state.version = 0;
+            }
+
+            return true;
+        }
+
+        changeCount = cached.changeCount;
+    }
+
+    // get the player state from the adapter implementation
+    ReturnIfNot(handleGetAdapterState(localPlayerId, state), false);
+
+    std::lock_guard<std::mutex> lock(m_adapterStateMutex);
+    auto& cached = m_adapterStateCache[localPlayerId];
+    state.version = ++m_adapterStateVersion;
+
+    // only cache the state if the player did not report a change while it was requested
+    if (cached.changeCount == changeCount) {
+        cached.state = state;
+        cached.time = std::chrono::steady_clock::now();
+        cached.valid = true;
+    }
+
+    return true;
+}
+
 std::string ExternalMediaAdapterHandler::createExternalMediaPlayerEvent(
     const std::string& localPlayerId,
     const std::string& event,
@@ -413,6 +487,9 @@ std::string ExternalMediaAdapterHandler::createExternalMediaPlayerEvent(
         ThrowIfNot(validatePlayer(localPlayerId), "invalidPlayerInfo");
         auto playerInfo = m_playerInfoMap[localPlayerId];
 
+        // events are sent when the player state changes
+        adapterStateChanged(localPlayerId);
+
         // create the event payload
         rapidjson::Document document(rapidjson::kObjectType);
 
@@ -538,6 +615,11 @@ bool ExternalMediaAdapterHandler::removeDiscoveredPlayer(const std::string& loca
         // remove the player info map entry
         m_playerInfoMap.erase(it);
 
+        {
+            std::lock_guard<std::mutex> lock(m_adapterStateMutex);
+            m_adapterStateCache.erase(localPlayerId);
+        }
+
         auto m_discoveredPlayerSender_lock = m_discoveredPlayerSender.lock();
         ThrowIfNull(m_discoveredPlayerSender_lock, "invalidDiscoveredPlayerSender");
 
@@ -14,6 +14,7 @@
  */
 
 /// @file ExternalMediaPlayer.cpp
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -477,6 +478,8 @@ void ExternalMediaPlayer::removeAdapterHandler(
         if (m_adapterHandlers.erase(adapterHandler) == 0) {
             AACE_WARN(LX(TAG, "removeAdapterHandlerInExecutor").m("Nonexistent adapter handler."));
         }
+        // the players of the remaining adapter handlers are serialized again with the next context
+        m_serializedPlayerStates.clear();
     });
 }
 
@@ -1151,6 +1154,7 @@ void ExternalMediaPlayer::handleLogout(std::shared_ptr<DirectiveInfo> info, Requ
             for (auto adapterHandler : m_adapterHandlers) {
                 adapterHandler->logout(playerId);
             }
+            m_serializedPlayerStates.erase(playerId);
             setHandlingCompleted(info);
         });
         return;
@@ -1636,6 +1640,7 @@ void ExternalMediaPlayer::doShutdown() {
 
     // adapter handler specific code
     m_adapterHandlers.clear();
+    m_serializedPlayerStates.clear();
     m_externalMediaAdapterRegistration.reset();
     m_focusManager.reset();
     m_adapterInFocus.reset();
@@ -1737,6 +1742,8 @@ void ExternalMediaPlayer::executeProvideState(
         adapterStates.insert(adapterStates.end(), handlerAdapterStates.begin(), handlerAdapterStates.end());
     }
 
+    removeSerializedPlayerStates(adapterStates);
+
     if (stateProviderName == SESSION_STATE) {
         // begin adapter handler specific code
         state = provideSessionState(adapterStates);
@@ -1766,6 +1773,47 @@ void ExternalMediaPlayer::executeProvideState(
     }
 }
 
+/**
+ * Serializes a context state object followed by a players array, which contains the @c players values and then the
+ * pre-serialized @c serializedPlayers objects.
+ */
+static bool serializeStateWithPlayers(
+    const rapidjson::Document& state,
+    const rapidjson::Value& players,
+    const std::vector<const std::string*>& serializedPlayers,
+    std::string& result) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+    writer.StartObject();
+    for (auto it = state.MemberBegin(); it != state.MemberEnd(); it++) {
+        writer.Key(it->name.GetString(), it->name.GetStringLength());
+        if (!it->value.Accept(writer)) {
+            return false;
+        }
+    }
+
+    writer.Key(PLAYERS);
+    writer.StartArray();
+    for (auto it = players.Begin(); it != players.End(); it++) {
+        if (!it->Accept(writer)) {
+            return false;
+        }
+    }
+    for (auto next : serializedPlayers) {
+        writer.RawValue(next->c_str(), next->length(), rapidjson::kObjectType);
+    }
+    writer.EndArray();
+
+    if (!writer.EndObject()) {
+        return false;
+    }
+
+    result = buffer.GetString();
+
+    return true;
+}
+
 // adapter handler specific code
 std::string ExternalMediaPlayer::provideSessionState(std::vector<aace::engine::alexa::AdapterState> adapterStates) {
     rapidjson::Document state(rapidjson::kObjectType);
@@ -1796,21 +1844,18 @@ std::string ExternalMediaPlayer::provideSessionState(std::vector<aace::engine::a
     }
 
     // adapter handler specific code
-    for (auto adapterState : adapterStates) {
-        rapidjson::Value playerJson = buildSessionState(adapterState.sessionState, stateAlloc);
-        players.PushBack(playerJson, stateAlloc);
+    std::vector<const std::string*> serializedPlayers;
+    for (const auto& adapterState : adapterStates) {
+        serializedPlayers.push_back(&getSerializedPlayerState(adapterState).sessionState);
     }
 
-    state.AddMember(rapidjson::StringRef(PLAYERS), players, stateAlloc);
-
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    if (!state.Accept(writer)) {
+    std::string result;
+    if (!serializeStateWithPlayers(state, players, serializedPlayers, result)) {
         AACE_ERROR(LX(TAG, "provideSessionStateFailed").d("reason", "writerRefusedJsonObject"));
         return "";
     }
 
-    return buffer.GetString();
+    return result;
 }
 
 // adapter handler playback states
@@ -1849,23 +1894,64 @@ std::string ExternalMediaPlayer::providePlaybackState(std::vector<aace::engine::
     notifyRenderPlayerInfoCardsObservers();
 
     // adapter handlers
-    for (auto adapterState : adapterStates) {
-        rapidjson::Value playerJson =
-            buildPlaybackState(adapterState.sessionState.playerId, adapterState.playbackState, stateAlloc);
-        players.PushBack(playerJson, stateAlloc);
+    std::vector<const std::string*> serializedPlayers;
+    for (const auto& adapterState : adapterStates) {
+        serializedPlayers.push_back(&getSerializedPlayerState(adapterState).playbackState);
     }
 
-    state.AddMember(PLAYERS, players, stateAlloc);
-
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-
-    if (!state.Accept(writer)) {
+    std::string result;
+    if (!serializeStateWithPlayers(state, players, serializedPlayers, result)) {
         AACE_ERROR(LX(TAG, "providePlaybackState").d("reason", "writerRefusedJsonObject"));
         return "";
     }
 
-    return buffer.GetString();
+    return result;
+}
+
+const ExternalMediaPlayer::SerializedPlayerState& ExternalMediaPlayer::getSerializedPlayerState(
+    const aace::engine::alexa::AdapterState& adapterState) {
+    auto& serialized = m_serializedPlayerStates[adapterState.sessionState.playerId];
+
+    // a state that is not cached by the adapter handler is always serialized
+    if (adapterState.version == 0 || adapterState.version != serialized.version) {
+        rapidjson::Document document;
+        rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
+
+        rapidjson::Value sessionJson = buildSessionState(adapterState.sessionState, allocator);
+        rapidjson::Value playbackJson =
+            buildPlaybackState(adapterState.sessionState.playerId, adapterState.playbackState, allocator);
+
+        rapidjson::StringBuffer sessionBuffer;
+        rapidjson::Writer<rapidjson::StringBuffer> sessionWriter(sessionBuffer);
+        sessionJson.Accept(sessionWriter);
+
+        rapidjson::StringBuffer playbackBuffer;
+        rapidjson::Writer<rapidjson::StringBuffer> playbackWriter(playbackBuffer);
+        playbackJson.Accept(playbackWriter);
+
+        serialized.version = adapterState.version;
+        serialized.sessionState = sessionBuffer.GetString();
+        serialized.playbackState = playbackBuffer.GetString();
+    }
+
+    return serialized;
+}
+
+void ExternalMediaPlayer::removeSerializedPlayerStates(
+    const std::vector<aace::engine::alexa::AdapterState>& adapterStates) {
+    // the states include only the authorized players, so a player that was removed or logged out is not included
+    std::unordered_set<std::string> playerIds;
+    for (const auto& adapterState : adapterStates) {
+        playerIds.insert(adapterState.sessionState.playerId);
+    }
+
+    for (auto it = m_serializedPlayerStates.begin(); it != m_serializedPlayerStates.end();) {
+        if (playerIds.count(it->first) == 0) {
+            it = m_serializedPlayerStates.erase(it);
+        } else {
+            ++it;
+        }
+    }
 }
 
 void ExternalMediaPlayer::createAdapters(
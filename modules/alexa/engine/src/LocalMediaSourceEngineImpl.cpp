@@ -35,12 +35,8 @@ static const std::string TAG("aace.alexa.LocalMediaSourceEngineImpl");
 
 static const std::string CONTENT_SELECTOR_SEPARATOR = ":";
 
-static const std::string DEFAULT_PLAYERCOOKIE_PAYLOAD = R"(
-    {
-        "cookieVersion": "1.0",
-        "capabilities": {}
-    }
-)";
+// player cookie version
+static const char* PLAYER_COOKIE_VERSION = "1.0";
 
 /// Program Name for Metrics
 static const std::string METRIC_PROGRAM_NAME_SUFFIX = "LocalMediaSourceEngineImpl";
@@ -307,30 +303,7 @@ bool LocalMediaSourceEngineImpl::handleGetAdapterState(
         state.sessionState.tokenRefreshInterval = platformState.sessionState.tokenRefreshInterval;
 
         // construct playercookie payload
-        rapidjson::Document document;
-        document.Parse<0>(DEFAULT_PLAYERCOOKIE_PAYLOAD.c_str());
-        rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-        for (auto next : platformState.sessionState.supportedContentSelectors) {
-            switch (next) {
-                case aace::alexa::LocalMediaSource::ContentSelector::FREQUENCY:
-                    document["capabilities"].AddMember("playFrequency", "1.0", allocator);
-                    break;
-                case aace::alexa::LocalMediaSource::ContentSelector::CHANNEL:
-                    document["capabilities"].AddMember("playChannel", "1.0", allocator);
-                    break;
-                case aace::alexa::LocalMediaSource::ContentSelector::PRESET:
-                    document["capabilities"].AddMember("playPreset", "1.0", allocator);
-                    break;
-            }
-        }
-
-        // add dynamic pluggable capability clearlist payload
-        document["capabilities"].AddMember("enableIsLaunched", "1.0", allocator);
-
-        rapidjson::StringBuffer strbuf;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
-        document.Accept(writer);
-        state.sessionState.playerCookie = strbuf.GetString();
+        state.sessionState.playerCookie = getPlayerCookie(platformState.sessionState.supportedContentSelectors);
 
         // playback state
         state.playbackState.playerId = getPlayerId(platformSource);
@@ -430,6 +403,49 @@ bool LocalMediaSourceEngineImpl::handleGetAdapterState(
     }
 }
 
+std::string LocalMediaSourceEngineImpl::getPlayerCookie(
+    const std::vector<ContentSelector>& supportedContentSelectors) {
+    std::lock_guard<std::mutex> lock(m_playerCookieMutex);
+
+    if (m_playerCookie.empty() || supportedContentSelectors != m_playerCookieContentSelectors) {
+        rapidjson::StringBuffer strbuf;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+
+        writer.StartObject();
+        writer.Key("cookieVersion");
+        writer.String(PLAYER_COOKIE_VERSION);
+        writer.Key("capabilities");
+        writer.StartObject();
+        for (auto next : supportedContentSelectors) {
+            switch (next) {
+                case aace::alexa::LocalMediaSource::ContentSelector::FREQUENCY:
+                    writer.Key("playFrequency");
+                    writer.String("1.0");
+                    break;
+                case aace::alexa::LocalMediaSource::ContentSelector::CHANNEL:
+                    writer.Key("playChannel");
+                    writer.String("1.0");
+                    break;
+                case aace::alexa::LocalMediaSource::ContentSelector::PRESET:
+                    writer.Key("playPreset");
+                    writer.String("1.0");
+                    break;
+            }
+        }
+
+        // add dynamic pluggable capability clearlist payload
+        writer.Key("enableIsLaunched");
+        writer.String("1.0");
+        writer.EndObject();
+        writer.EndObject();
+
+        m_playerCookie = strbuf.GetString();
+        m_playerCookieContentSelectors = supportedContentSelectors;
+    }
+
+    return m_playerCookie;
+}
+
 std::chrono::milliseconds LocalMediaSourceEngineImpl::handleGetOffset(const std::string& localPlayerId) {
     return std::chrono::milliseconds::zero();
 }
@@ -330,12 +330,6 @@ bool SpeechRecognizerEngineImpl::initializeAudioInputStream() {
     }
 }
 
-bool SpeechRecognizerEngineImpl::waitForExpectingAudioState(bool state, const std::chrono::seconds duration) {
-    std::unique_lock<std::mutex> lock(m_expectingAudioMutex);
-
-    return m_expectingAudioState_cv.wait_for(lock, duration, [this, state]() { return state == isExpectingAudio(); });
-}
-
 bool SpeechRecognizerEngineImpl::startAudioInput() {
     try {
         // if we are already expecting audio then don't attempt to start the audio
@@ -348,7 +342,7 @@ bool SpeechRecognizerEngineImpl::startAudioInput() {
         // and error then we reset the expecting audio state and throw an exception
         std::weak_ptr<SpeechRecognizerEngineImpl> wp = shared_from_this();
 
-        m_currentChannelId = m_audioInputChannel->start([wp](const int16_t* data, const size_t size) {
+        auto channelId = m_audioInputChannel->start([wp](const int16_t* data, const size_t size) {
             if (auto sp = wp.lock()) {
                 sp->write(data, size);
             } else {
@@ -358,15 +352,14 @@ bool SpeechRecognizerEngineImpl::startAudioInput() {
 
         // throw an exception if we failed to start the audio input channel
         ThrowIf(
-            m_currentChannelId == aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL,
+            channelId == aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL,
             "audioInputChannelStartFailed");
 
-        // notify mutext that the expecting audio state has changed
-        m_expectingAudioState_cv.notify_all();
+        m_currentChannelId = channelId;
 
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "startAudioInput").d("reason", ex.what()).d("id", m_currentChannelId));
+        AACE_ERROR(LX(TAG, "startAudioInput").d("reason", ex.what()).d("id", m_currentChannelId.load()));
         return false;
     }
 }
@@ -378,15 +371,12 @@ bool SpeechRecognizerEngineImpl::stopAudioInput() {
             "invalidAudioChannelId");
         ThrowIfNot(m_audioInputChannel->stop(m_currentChannelId), "audioInputChannelStopFailed");
 
-        // notify mutext that the expecting audio state has changed
-        m_expectingAudioState_cv.notify_all();
-
         // reset the channel id
         m_currentChannelId = aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL;
 
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "stopAudioInput").d("reason", ex.what()).d("id", m_currentChannelId));
+        AACE_ERROR(LX(TAG, "stopAudioInput").d("reason", ex.what()).d("id", m_currentChannelId.load()));
         m_currentChannelId = aace::engine::audio::AudioInputChannelInterface::INVALID_CHANNEL;
         return false;
     }
@@ -481,7 +471,7 @@ bool SpeechRecognizerEngineImpl::onStartCapture(
                        .d("reason", ex.what())
                        .d("initiator", initiator)
                        .d("state", m_state)
-                       .d("id", m_currentChannelId));
+                       .d("id", m_currentChannelId.load()));
         return false;
     }
 }
@@ -492,22 +482,24 @@ bool SpeechRecognizerEngineImpl::onStopCapture() {
         ThrowIfNot(m_audioInputProcessor->stopCapture().get(), "stopCaptureFailed");
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "onStopCapture").d("reason", ex.what()).d("id", m_currentChannelId));
+        AACE_ERROR(LX(TAG, "onStopCapture").d("reason", ex.what()).d("id", m_currentChannelId.load()));
         return false;
     }
 }
 
 ssize_t SpeechRecognizerEngineImpl::write(const int16_t* data, const size_t size) {
     try {
-        ThrowIfNot(waitForExpectingAudioState(true), "audioNotExpected");
+        // the audio input channel only delivers audio between start() and stop(), so the frames written
+        // before start() returns and the channel id is published are also expected
         ThrowIfNull(m_audioInputWriter, "nullAudioInputWriter");
 
+        // the buffer may contain several frames, which are written to the stream in a single call
         ssize_t result = m_audioInputWriter->write(data, size);
         ThrowIf(result < 0, "errorWritingData");
 
         return result;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "write").d("reason", ex.what()).d("id", m_currentChannelId));
+        AACE_ERROR(LX(TAG, "write").d("reason", ex.what()).d("id", m_currentChannelId.load()));
         return -1;
     }
 }
@@ -603,7 +595,7 @@ bool SpeechRecognizerEngineImpl::startCapture(
 
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "startCapture").d("reason", ex.what()).d("id", m_currentChannelId));
+        AACE_ERROR(LX(TAG, "startCapture").d("reason", ex.what()).d("id", m_currentChannelId.load()));
         m_audioInputProcessor->resetState();
         return false;
     }
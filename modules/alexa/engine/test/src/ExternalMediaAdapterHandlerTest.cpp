@@ -0,0 +1,228 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AACE/Engine/Alexa/DiscoveredPlayerSenderInterface.h"
+#include "AACE/Engine/Alexa/ExternalMediaAdapterConstants.h"
+#include "AACE/Engine/Alexa/ExternalMediaAdapterHandler.h"
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using aace::alexa::ExternalMediaAdapter;
+using aace::engine::alexa::AdapterState;
+using aace::engine::alexa::PlayerInfo;
+
+/// The local player id of the test player
+static const std::string LOCAL_PLAYER_ID = "com.example.player";
+
+/// The cloud assigned player id of the test player
+static const std::string PLAYER_ID = "examplePlayerId";
+
+/// Discovered player sender that accepts every player
+class TestDiscoveredPlayerSender : public aace::engine::alexa::DiscoveredPlayerSenderInterface {
+public:
+    void reportDiscoveredPlayers(const std::vector<ExternalMediaAdapter::DiscoveredPlayerInfo>&) override {
+    }
+
+    void removeDiscoveredPlayer(const std::string&) override {
+    }
+};
+
+/// Adapter handler that reports a configurable player state, and counts the state requests
+class TestAdapterHandler : public aace::engine::alexa::ExternalMediaAdapterHandler {
+public:
+    TestAdapterHandler(std::shared_ptr<TestDiscoveredPlayerSender> discoveredPlayerSender) :
+            ExternalMediaAdapterHandler(discoveredPlayerSender, nullptr) {
+    }
+
+    void addPlayer() {
+        ExternalMediaAdapter::DiscoveredPlayerInfo info;
+        info.localPlayerId = LOCAL_PLAYER_ID;
+        info.spiVersion = "1.0";
+        reportDiscoveredPlayers({info});
+
+        PlayerInfo playerInfo(LOCAL_PLAYER_ID, "1.0", true);
+        playerInfo.playerId = PLAYER_ID;
+        authorizeDiscoveredPlayers({playerInfo});
+    }
+
+    bool removePlayer() {
+        return removeDiscoveredPlayer(LOCAL_PLAYER_ID);
+    }
+
+    void reportChange() {
+        adapterStateChanged(LOCAL_PLAYER_ID);
+    }
+
+    int stateRequests = 0;
+    std::string state = aace::engine::alexa::PLAYING;
+    std::chrono::milliseconds trackOffset{1000};
+    std::chrono::milliseconds duration{0};
+
+protected:
+    bool handleAuthorization(const std::vector<ExternalMediaAdapter::AuthorizedPlayerInfo>&) override {
+        return true;
+    }
+    bool handleLogin(const std::string&, const std::string&, const std::string&, bool, std::chrono::milliseconds)
+        override {
+        return true;
+    }
+    bool handleLogout(const std::string&) override {
+        return true;
+    }
+    bool handlePlay(
+        const std::string&,
+        const std::string&,
+        int64_t,
+        std::chrono::milliseconds,
+        bool,
+        ExternalMediaAdapter::Navigation,
+        const std::string&,
+        const std::string&) override {
+        return true;
+    }
+    bool handlePlayControl(const std::string&, ExternalMediaAdapter::PlayControlType) override {
+        return true;
+    }
+    bool handleSeek(const std::string&, std::chrono::milliseconds) override {
+        return true;
+    }
+    bool handleAdjustSeek(const std::string&, std::chrono::milliseconds) override {
+        return true;
+    }
+    bool handleGetAdapterState(const std::string&, AdapterState& adapterState) override {
+        stateRequests++;
+        adapterState.playbackState.state = state;
+        adapterState.playbackState.trackOffset = trackOffset;
+        adapterState.playbackState.duration = duration;
+        return true;
+    }
+    std::chrono::milliseconds handleGetOffset(const std::string&) override {
+        return trackOffset;
+    }
+    bool handleSetVolume(int8_t) override {
+        return true;
+    }
+    bool handleSetMute(bool) override {
+        return true;
+    }
+};
+
+class ExternalMediaAdapterHandlerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_discoveredPlayerSender = std::make_shared<TestDiscoveredPlayerSender>();
+        m_adapterHandler = std::make_shared<TestAdapterHandler>(m_discoveredPlayerSender);
+        m_adapterHandler->addPlayer();
+    }
+
+    void TearDown() override {
+        m_adapterHandler->shutdown();
+    }
+
+protected:
+    AdapterState getState() {
+        auto states = m_adapterHandler->getAdapterStates(true);
+        EXPECT_EQ(1u, states.size());
+        return states.empty() ? AdapterState() : states[0];
+    }
+
+    std::shared_ptr<TestDiscoveredPlayerSender> m_discoveredPlayerSender;
+    std::shared_ptr<TestAdapterHandler> m_adapterHandler;
+};
+
+/**
+ * Test that the state of a player that is not playing is requested again only after the player reports a change,
+ * and keeps its version until then.
+ */
+TEST_F(ExternalMediaAdapterHandlerTest, pausedStateIsCachedUntilChanged) {
+    m_adapterHandler->state = aace::engine::alexa::PAUSED;
+
+    auto first = getState();
+    auto second = getState();
+    EXPECT_EQ(1, m_adapterHandler->stateRequests);
+    EXPECT_NE(0u, first.version);
+    EXPECT_EQ(first.version, second.version);
+    EXPECT_EQ(std::chrono::milliseconds(1000), second.playbackState.trackOffset);
+
+    m_adapterHandler->reportChange();
+    auto third = getState();
+    EXPECT_EQ(2, m_adapterHandler->stateRequests);
+    EXPECT_NE(first.version, third.version);
+}
+
+/**
+ * Test that the cached state of a playing player is served with the track offset advanced by the time since it was
+ * requested, and is serialized again each time.
+ */
+TEST_F(ExternalMediaAdapterHandlerTest, playingOffsetIsExtrapolated) {
+    auto first = getState();
+    EXPECT_EQ(1, m_adapterHandler->stateRequests);
+    EXPECT_EQ(std::chrono::milliseconds(1000), first.playbackState.trackOffset);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto second = getState();
+    EXPECT_EQ(1, m_adapterHandler->stateRequests);
+    EXPECT_GE(second.playbackState.trackOffset, std::chrono::milliseconds(1100));
+    EXPECT_LT(second.playbackState.trackOffset, std::chrono::milliseconds(6000));
+    EXPECT_EQ(0u, second.version);
+
+    // a seek reported by the player is requested from the adapter
+    m_adapterHandler->trackOffset = std::chrono::milliseconds(50);
+    m_adapterHandler->reportChange();
+    auto third = getState();
+    EXPECT_EQ(2, m_adapterHandler->stateRequests);
+    EXPECT_EQ(std::chrono::milliseconds(50), third.playbackState.trackOffset);
+}
+
+/**
+ * Test that the extrapolated track offset does not pass the end of the track.
+ */
+TEST_F(ExternalMediaAdapterHandlerTest, playingOffsetStopsAtDuration) {
+    m_adapterHandler->duration = std::chrono::milliseconds(1010);
+
+    getState();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(std::chrono::milliseconds(1010), getState().playbackState.trackOffset);
+    EXPECT_EQ(1, m_adapterHandler->stateRequests);
+}
+
+/**
+ * Test that the cached state of a removed player is discarded, and its state is not reported.
+ */
+TEST_F(ExternalMediaAdapterHandlerTest, removedPlayerStateIsDiscarded) {
+    getState();
+    ASSERT_TRUE(m_adapterHandler->removePlayer());
+    EXPECT_TRUE(m_adapterHandler->getAdapterStates(true).empty());
+
+    m_adapterHandler->addPlayer();
+    getState();
+    EXPECT_EQ(2, m_adapterHandler->stateRequests);
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -16,7 +16,10 @@
 #ifndef AACE_ENGINE_CAR_CONTROL_ASSET_STORE_H
 #define AACE_ENGINE_CAR_CONTROL_ASSET_STORE_H
 
+#include <cstddef>
+#include <cstdint>
 #include <istream>
+#include <iterator>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -31,12 +34,77 @@ namespace carControl {
  * locale pairs associated with each asset definition in the file.
  * Friendly name / locale pairs of assets may be retrieved by asset ID when
  * constructing a discovery message with assets expanded to text.
+ *
+ * Each distinct asset ID, friendly name, and locale string is stored once.
+ * The friendly names of an asset are a span of string ID pairs in a single
+ * array shared by all assets, and are returned as a @c FriendlyNames view
+ * that refers to the AssetStore rather than copying the strings.
  */
 class AssetStore {
 public:
     /// Alias for readability. Pair of friendly name literal text to its locale
     using NameLocalePair = std::pair<std::string, std::string>;
 
+    /// Alias for readability. Pair of friendly name and locale string references
+    using NameLocaleRef = std::pair<const std::string&, const std::string&>;
+
+    /**
+     * A read-only view of the friendly name / locale pairs of an asset. The view
+     * is valid until the AssetStore is modified or cleared.
+     */
+    class FriendlyNames {
+    public:
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = NameLocaleRef;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = NameLocaleRef;
+
+            Iterator(const AssetStore* store, size_t index) : m_store(store), m_index(index) {
+            }
+            NameLocaleRef operator*() const {
+                return m_store->getNameLocale(m_index);
+            }
+            Iterator& operator++() {
+                m_index++;
+                return *this;
+            }
+            bool operator==(const Iterator& other) const {
+                return m_index == other.m_index;
+            }
+            bool operator!=(const Iterator& other) const {
+                return m_index != other.m_index;
+            }
+
+        private:
+            const AssetStore* m_store;
+            size_t m_index;
+        };
+
+        FriendlyNames(const AssetStore* store, size_t offset, size_t count) :
+                m_store(store), m_offset(offset), m_count(count) {
+        }
+        Iterator begin() const {
+            return Iterator(m_store, m_offset);
+        }
+        Iterator end() const {
+            return Iterator(m_store, m_offset + m_count);
+        }
+        size_t size() const {
+            return m_count;
+        }
+        bool empty() const {
+            return m_count == 0;
+        }
+
+    private:
+        const AssetStore* m_store;
+        size_t m_offset;
+        size_t m_count;
+    };
+
     /// Destructor
     ~AssetStore();
 
@@ -51,21 +119,44 @@ public:
      */
     bool addAssets(const std::string& path);
 
+    /**
+     * Add the friendly name / locale pairs of a single asset to the AssetStore.
+     * An asset that is already present in the AssetStore is not replaced.
+     *
+     * @param assetId The ID of the asset
+     * @param names The friendly name / locale pairs of the asset
+     */
+    void addAsset(const std::string& assetId, const std::vector<NameLocalePair>& names);
+
     /**
      * Get the literal friendly names and locales associated with the given 
      * asset ID.
      *
      * @param The ID of the asset
-     * @return A list of pairs of friendly name and locale strings for the asset
+     * @return A view of the friendly name and locale string pairs for the asset,
+     * which is empty if the asset is not in the AssetStore
      */
-    const std::vector<NameLocalePair>& getFriendlyNames(const std::string& assetId) const;
+    FriendlyNames getFriendlyNames(const std::string& assetId) const;
 
     /**
-     * Clear the contents of the AssetStore
+     * Get the IDs of all of the assets in the AssetStore.
+     *
+     * @return The list of asset IDs
+     */
+    std::vector<std::string> getAssetIds() const;
+
+    /**
+     * Clear the contents of the AssetStore and release its memory
      */
     void clear();
 
 private:
+    /// A span of friendly name / locale string ID pairs in @c m_names
+    struct NameSpan {
+        uint32_t offset;
+        uint32_t count;
+    };
+
     /**
      * Ingest the assets from the istream and populate the AssetStore with the
      * friendly name text / locale pairs. The contents of the stream must 
@@ -78,17 +169,38 @@ private:
     bool addAssets(std::istream& stream);
 
     /**
-     * A map of asset ID to a list of friendly name text / locale pairs used to
-     * describe the asset. It contains an entry for all assets ingested by the
-     * AssetStore.
+     * Get the ID of a string, adding the string to the string table if it is
+     * not already present.
+     */
+    uint32_t intern(const std::string& value);
+
+    /// Get the friendly name / locale strings at @c index in @c m_names
+    NameLocaleRef getNameLocale(size_t index) const {
+        const auto& name = m_names[index];
+        return NameLocaleRef(*m_strings[name.first], *m_strings[name.second]);
+    }
+
+    /**
+     * The string table. Maps each distinct asset ID, friendly name, and locale
+     * string to its ID.
+     */
+    std::unordered_map<std::string, uint32_t> m_stringIds;
+
+    /// The strings in @c m_stringIds indexed by ID
+    std::vector<const std::string*> m_strings;
+
+    /**
+     * The friendly name / locale string ID pairs of all assets. The names of
+     * each asset are a contiguous span in the list.
      */
-    std::unordered_map<std::string, std::vector<NameLocalePair>> m_assets;
+    std::vector<std::pair<uint32_t, uint32_t>> m_names;
 
     /**
-     * An empty list to be returned from @c getFriendlyNames() if the specified ID
-     * isn't present in the AssetStore
+     * A map of asset ID string ID to the span of friendly name text / locale
+     * pairs used to describe the asset. It contains an entry for all assets
+     * ingested by the AssetStore.
      */
-    std::vector<NameLocalePair> m_empty;
+    std::unordered_map<uint32_t, NameSpan> m_assets;
 };
 
 }  // namespace carControl
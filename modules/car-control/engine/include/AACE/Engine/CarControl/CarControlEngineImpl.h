@@ -18,8 +18,14 @@
 
 #include <AVSCommon/Utils/RequiresShutdown.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "AACE/CarControl/CarControl.h"
 #include "AACE/Engine/CarControl/CarControlServiceInterface.h"
@@ -56,13 +62,57 @@ public:
     bool adjustModeControllerValue(const std::string& endpointId, const std::string& instance, int delta) override;
     bool getModeControllerValue(const std::string& endpointId, const std::string& instance, std::string& value)
         override;
+
+    bool setControllerValues(
+        const std::vector<aace::carControl::CarControl::ControllerValue>& values,
+        std::vector<bool>& results) override;
     /// @}
 
 protected:
     void doShutdown() override;
 
+private:
+    using ControllerValue = aace::carControl::CarControl::ControllerValue;
+
+    /// A controller value waiting to be sent to the platform implementation in a batch.
+    struct PendingValue;
+
+    /**
+     * Queues controller values and blocks until they have been applied by the platform implementation.
+     * Values queued concurrently by other threads, for example the controllers of each endpoint targeted by
+     * a zone-wide directive, are sent to the platform implementation in the same batch. If the platform
+     * implementation does not support batches, the values are passed to it directly on the calling thread.
+     */
+    bool executeControllerValues(const std::vector<ControllerValue>& values, std::vector<bool>& results);
+    bool executeControllerValue(const ControllerValue& value);
+
+    /**
+     * Removes the queued values that can be sent in the next batch, skipping values for endpoints that
+     * already have a batch in flight. Must be called with @c m_mutex held.
+     */
+    std::vector<std::shared_ptr<PendingValue>> claimPendingValues();
+
+    /// Returns @c true if one of @c values can be claimed. Must be called with @c m_mutex held.
+    bool isClaimable(const std::vector<std::shared_ptr<PendingValue>>& values);
+
 private:
     std::shared_ptr<aace::carControl::CarControl> m_platformInterface;
+
+    /// Serializes access to the batch state and the platform interface reference.
+    std::mutex m_mutex;
+    std::condition_variable m_trigger;
+
+    /// Values waiting to be claimed for a batch, in the order they were queued.
+    std::deque<std::shared_ptr<PendingValue>> m_pendingValues;
+
+    /// Number of values in flight for each endpoint, which keeps the values for an endpoint in order.
+    std::unordered_map<std::string, int> m_inFlightEndpoints;
+
+    /// Whether a thread is waiting for concurrent values to join the next batch.
+    bool m_collectingBatch = false;
+
+    /// When a value was last queued, which tells whether values are arriving in a burst.
+    std::chrono::steady_clock::time_point m_lastQueuedTime;
 };
 
 }  // namespace carControl
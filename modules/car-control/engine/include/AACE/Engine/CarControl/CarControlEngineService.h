@@ -78,6 +78,21 @@ private:
      */
     void translateConfigForZones(json& jconfiguration);
 
+    /**
+     * Load the configuration and assets from the compiled snapshot written by a previous @c configure() call.
+     * The snapshot is used only if it was written for the same configuration text and the asset files it
+     * was compiled from are unchanged.
+     *
+     * @param [in] localStorage The local storage containing the path of the snapshot
+     * @param [in] configurationHash The hash of the configuration text
+     * @param [out] jconfiguration The translated configuration
+     * @return @c true if the snapshot was loaded
+     */
+    bool loadConfigurationSnapshot(
+        std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+        uint64_t configurationHash,
+        json& jconfiguration);
+
     template <class T>
     bool registerPlatformInterfaceType(std::shared_ptr<aace::core::PlatformInterface> platformInterface) {
         std::shared_ptr<T> typedPlatformInterface = std::dynamic_pointer_cast<T>(platformInterface);
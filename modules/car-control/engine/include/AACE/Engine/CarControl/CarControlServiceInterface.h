@@ -17,6 +17,9 @@
 #define AACE_ENGINE_CAR_CONTROL_CAR_CONTROL_SERVICE_INTERFACE_H
 
 #include <string>
+#include <vector>
+
+#include "AACE/CarControl/CarControl.h"
 
 namespace aace {
 namespace engine {
@@ -143,6 +146,18 @@ public:
         const std::string& endpointId,
         const std::string& instance,
         std::string& value) = 0;
+
+    /**
+     * Set the values of several controllers in a single request to the platform implementation. Values for the
+     * same endpoint are applied in the order given.
+     *
+     * @param [in] values The controller values to set.
+     * @param [out] results Set to the result of each value, in the same order as @c values.
+     * @return @c true if every value was set successfully.
+     */
+    virtual bool setControllerValues(
+        const std::vector<aace::carControl::CarControl::ControllerValue>& values,
+        std::vector<bool>& results) = 0;
 };
 
 }  // namespace carControl
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CAR_CONTROL_CONFIGURATION_SNAPSHOT_H
+#define AACE_ENGINE_CAR_CONTROL_CONFIGURATION_SNAPSHOT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "AACE/Engine/CarControl/AssetStore.h"
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/**
+ * A compiled, versioned binary snapshot of the "aace.carControl" configuration and the assets it uses.
+ * The snapshot contains the configuration after zone translation and the friendly name / locale pairs
+ * of every asset, with each string stored once in a string table.
+ *
+ * A snapshot is keyed by a hash of the configuration text. It also records the paths and a hash of the
+ * contents of the asset files, so a snapshot is used only if neither the configuration nor the assets
+ * have changed since it was written. The snapshot file is mapped into memory when it is opened.
+ */
+class ConfigurationSnapshot {
+public:
+    /// The initial value of a hash computed with @c computeHash()
+    static const uint64_t INITIAL_HASH = 0xcbf29ce484222325ULL;
+
+    /**
+     * Computes a 64-bit FNV-1a hash of @c data.
+     *
+     * @param data The data to hash
+     * @param size The size of @c data in bytes
+     * @param hash The hash to continue from, which allows hashing data in several parts
+     * @return The hash
+     */
+    static uint64_t computeHash(const char* data, size_t size, uint64_t hash = INITIAL_HASH);
+
+    /**
+     * Computes a hash of the contents of the files at the given paths, in order.
+     *
+     * @param paths The paths of the files to hash
+     * @param [out] hash The hash of the file contents
+     * @return @c true if all of the files were read
+     */
+    static bool computeFilesHash(const std::vector<std::string>& paths, uint64_t& hash);
+
+    /**
+     * Writes a snapshot file. The snapshot is written to a temporary file that replaces @c path when
+     * it is complete, so a partially written snapshot is never opened.
+     *
+     * @param path The path of the snapshot file
+     * @param configurationHash The hash of the configuration text
+     * @param assetPaths The paths of the asset files used by the configuration
+     * @param assetsHash The hash of the contents of the asset files
+     * @param assetStore The @c AssetStore containing the assets ingested from @c assetPaths
+     * @param configuration The configuration after zone translation
+     * @param zonesCapabilityConfig The ZoneDefinitions capability configuration generated by zone translation
+     * @return @c true if the snapshot was written
+     */
+    static bool write(
+        const std::string& path,
+        uint64_t configurationHash,
+        const std::vector<std::string>& assetPaths,
+        uint64_t assetsHash,
+        const AssetStore& assetStore,
+        const nlohmann::json& configuration,
+        const nlohmann::json& zonesCapabilityConfig);
+
+    /**
+     * Maps the snapshot file at @c path.
+     *
+     * @param path The path of the snapshot file
+     * @param configurationHash The hash of the current configuration text
+     * @return The snapshot, or @c nullptr if the file does not exist, has a different format version,
+     *         or was written for a different configuration
+     */
+    static std::unique_ptr<ConfigurationSnapshot> open(const std::string& path, uint64_t configurationHash);
+
+    /**
+     * ConfigurationSnapshot destructor
+     */
+    ~ConfigurationSnapshot();
+
+    /**
+     * Get the paths of the asset files used when the snapshot was written.
+     */
+    const std::vector<std::string>& getAssetPaths() const;
+
+    /**
+     * Get the hash of the contents of the asset files when the snapshot was written.
+     */
+    uint64_t getAssetsHash() const;
+
+    /**
+     * Add the assets in the snapshot to an @c AssetStore.
+     *
+     * @param assetStore The @c AssetStore to populate
+     * @return @c true if successful
+     */
+    bool loadAssets(AssetStore& assetStore) const;
+
+    /**
+     * Get the configuration in the snapshot.
+     *
+     * @param [out] configuration The configuration after zone translation
+     * @param [out] zonesCapabilityConfig The ZoneDefinitions capability configuration
+     * @return @c true if successful
+     */
+    bool loadConfiguration(nlohmann::json& configuration, nlohmann::json& zonesCapabilityConfig) const;
+
+private:
+    ConfigurationSnapshot() = default;
+
+    bool initialize(const std::string& path, uint64_t configurationHash);
+
+    /// The mapped snapshot file
+    const uint8_t* m_data = nullptr;
+    /// The size of the mapped snapshot file
+    size_t m_size = 0;
+
+    /// The string table
+    std::vector<std::string> m_strings;
+    /// The paths of the asset files
+    std::vector<std::string> m_assetPaths;
+    /// The hash of the contents of the asset files
+    uint64_t m_assetsHash = 0;
+
+    /// The offset of the asset table in the mapped file
+    size_t m_assetTableOffset = 0;
+    /// The offset of the configuration section in the mapped file
+    size_t m_configurationOffset = 0;
+};
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CAR_CONTROL_CONFIGURATION_SNAPSHOT_H
@@ -51,26 +51,34 @@ bool AssetStore::addAssets(std::istream& stream) {
             for (auto& assetItem : assetArray.items()) {
                 // For each asset, add an entry to the asset map
                 // 'names' will hold all synonyms for all locales for all values
-                std::vector<NameLocalePair> names;
-                auto assetObject = assetItem.value();
+                std::vector<std::pair<uint32_t, uint32_t>> names;
+                auto& assetObject = assetItem.value();
                 std::string assetId = assetObject["assetId"];
-                json valuesArray = assetObject["values"];
+                auto& valuesArray = assetObject["values"];
                 for (auto& valueItem : valuesArray.items()) {
-                    json valueObject = valueItem.value();
-                    std::string defaultValue = valueObject["defaultValue"];
-                    json synonyms = valueObject["synonyms"];
+                    auto& valueObject = valueItem.value();
+                    uint32_t defaultValue = intern(valueObject["defaultValue"].get<std::string>());
+                    std::vector<uint32_t> synonyms;
+                    for (auto& synonym : valueObject["synonyms"].items()) {
+                        synonyms.push_back(intern(synonym.value().get<std::string>()));
+                    }
                     std::vector<std::string> locales = valueObject.at("locales");
                     // For every locale, add the defaultValue and each synonym
                     // to the list of names for this assetId
-                    for (auto locale = locales.begin(); locale != locales.end(); ++locale) {
-                        names.push_back({defaultValue, *locale});
-                        for (auto& synonym : synonyms.items()) {
-                            names.push_back({synonym.value(), *locale});
+                    for (auto& locale : locales) {
+                        uint32_t localeId = intern(locale);
+                        names.push_back({defaultValue, localeId});
+                        for (auto synonym : synonyms) {
+                            names.push_back({synonym, localeId});
                         }
                     }
                 }
                 ThrowIf(names.empty(), "noAssetFriendlyNameFor " + assetId);
-                m_assets.emplace(assetId, names);
+                uint32_t id = intern(assetId);
+                if (m_assets.find(id) == m_assets.end()) {
+                    m_assets[id] = {static_cast<uint32_t>(m_names.size()), static_cast<uint32_t>(names.size())};
+                    m_names.insert(m_names.end(), names.begin(), names.end());
+                }
             }
             return true;
         }
@@ -82,20 +90,50 @@ bool AssetStore::addAssets(std::istream& stream) {
     }
 }
 
-const std::vector<AssetStore::NameLocalePair>& AssetStore::getFriendlyNames(const std::string& assetId) const {
-    auto iter = m_assets.find(assetId);
-    if (iter != m_assets.end()) {
-        return iter->second;
-    } else {
-        return m_empty;
+void AssetStore::addAsset(const std::string& assetId, const std::vector<NameLocalePair>& names) {
+    uint32_t id = intern(assetId);
+    if (m_assets.find(id) == m_assets.end()) {
+        m_assets[id] = {static_cast<uint32_t>(m_names.size()), static_cast<uint32_t>(names.size())};
+        for (auto& name : names) {
+            m_names.push_back({intern(name.first), intern(name.second)});
+        }
     }
 }
 
-void AssetStore::clear() {
-    for (auto value : m_assets) {
-        value.second.clear();
+AssetStore::FriendlyNames AssetStore::getFriendlyNames(const std::string& assetId) const {
+    auto id = m_stringIds.find(assetId);
+    if (id != m_stringIds.end()) {
+        auto asset = m_assets.find(id->second);
+        if (asset != m_assets.end()) {
+            return FriendlyNames(this, asset->second.offset, asset->second.count);
+        }
+    }
+    return FriendlyNames(this, 0, 0);
+}
+
+std::vector<std::string> AssetStore::getAssetIds() const {
+    std::vector<std::string> assetIds;
+    assetIds.reserve(m_assets.size());
+    for (auto& asset : m_assets) {
+        assetIds.push_back(*m_strings[asset.first]);
+    }
+    return assetIds;
+}
+
+uint32_t AssetStore::intern(const std::string& value) {
+    auto result = m_stringIds.emplace(value, static_cast<uint32_t>(m_strings.size()));
+    if (result.second) {
+        m_strings.push_back(&result.first->first);
     }
-    m_assets.clear();
+    return result.first->second;
+}
+
+void AssetStore::clear() {
+    // Swap with empty containers to release the memory rather than only the contents
+    std::unordered_map<std::string, uint32_t>().swap(m_stringIds);
+    std::vector<const std::string*>().swap(m_strings);
+    std::vector<std::pair<uint32_t, uint32_t>>().swap(m_names);
+    std::unordered_map<uint32_t, NameSpan>().swap(m_assets);
 }
 
 }  // namespace carControl
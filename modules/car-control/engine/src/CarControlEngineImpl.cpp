@@ -18,6 +18,9 @@
 #include "AACE/Engine/Core/EngineMacros.h"
 #include <AACE/Engine/Utils/Metrics/Metrics.h>
 
+#include <algorithm>
+#include <chrono>
+
 namespace aace {
 namespace engine {
 namespace carControl {
@@ -29,6 +32,15 @@ static const std::string POWER_CONTROLLER_TAG("aace.engine.carControl.PowerContr
 static const std::string RANGE_CONTROLLER_TAG("aace.engine.carControl.RangeController");
 static const std::string TOGGLE_CONTROLLER_TAG("aace.engine.carControl.ToggleController");
 
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.engine.carControl.CarControlEngineImpl");
+
+/// The longest time the first value of a batch waits for values queued concurrently for other endpoints.
+static const std::chrono::milliseconds BATCH_COLLECTION_WINDOW(10);
+
+/// The batch is sent when no value is queued for this long, before the collection window ends.
+static const std::chrono::milliseconds BATCH_COLLECTION_IDLE_GAP(2);
+
 /// Program Name for Metrics
 static const std::string METRIC_PROGRAM_NAME_SUFFIX = "CarControlEngineImpl";
 
@@ -45,6 +57,56 @@ static const std::string METRIC_CAR_CONTROL_GET_RANGECONTROLLER_VALUE = "GetRang
 static const std::string METRIC_CAR_CONTROL_SET_MODECONTROLLER_VALUE = "SetModeControllerValue";
 static const std::string METRIC_CAR_CONTROL_ADJUST_MODECONTROLLER_VALUE = "AdjustModeControllerValue";
 static const std::string METRIC_CAR_CONTROL_GET_MODECONTROLLER_VALUE = "GetModeControllerValue";
+static const std::string METRIC_CAR_CONTROL_SET_CONTROLLER_VALUES = "SetControllerValues";
+
+/// Counter metrics for CarControl Platform APIs
+static CounterMetric s_turnPowerControllerOnCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "turnPowerControllerOn", METRIC_CAR_CONTROL_TURN_POWERCONTROLLER_ON);
+static CounterMetric s_turnPowerControllerOffCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "turnPowerControllerOff", METRIC_CAR_CONTROL_TURN_POWERCONTROLLER_OFF);
+static CounterMetric s_isPowerControllerOnCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "isPowerControllerOn", METRIC_CAR_CONTROL_IS_POWERCONTROLLER_ON);
+static CounterMetric s_turnToggleControllerOnCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "turnToggleControllerOn", METRIC_CAR_CONTROL_TURN_TOGGLECONTROLLER_ON);
+static CounterMetric s_turnToggleControllerOffCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "turnToggleControllerOff", METRIC_CAR_CONTROL_TURN_TOGGLECONTROLLER_OFF);
+static CounterMetric s_isToggleControllerOnCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "isToggleControllerOn", METRIC_CAR_CONTROL_IS_TOGGLECONTROLLER_ON);
+static CounterMetric s_setRangeControllerValueCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "setRangeControllerValue", METRIC_CAR_CONTROL_SET_RANGECONTROLLER_VALUE);
+static CounterMetric s_adjustRangeControllerValueCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "adjustRangeControllerValue", METRIC_CAR_CONTROL_ADJUST_RANGECONTROLLER_VALUE);
+static CounterMetric s_getRangeControllerValueCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "getRangeControllerValue", METRIC_CAR_CONTROL_GET_RANGECONTROLLER_VALUE);
+static CounterMetric s_setModeControllerValueCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "setModeControllerValue", METRIC_CAR_CONTROL_SET_MODECONTROLLER_VALUE);
+static CounterMetric s_adjustModeControllerValueCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "adjustModeControllerValue", METRIC_CAR_CONTROL_ADJUST_MODECONTROLLER_VALUE);
+static CounterMetric s_getModeControllerValueCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "getModeControllerValue", METRIC_CAR_CONTROL_GET_MODECONTROLLER_VALUE);
+static CounterMetric s_setControllerValuesCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "setControllerValues", METRIC_CAR_CONTROL_SET_CONTROLLER_VALUES);
+
+struct CarControlEngineImpl::PendingValue {
+    PendingValue(const ControllerValue& value) : value(value) {
+    }
+
+    ControllerValue value;
+    bool claimed = false;
+    bool done = false;
+    bool success = false;
+};
+
+static aace::carControl::CarControl::ControllerValue createControllerValue(
+    aace::carControl::CarControl::ControllerValue::ControllerType type,
+    const std::string& endpointId,
+    const std::string& controllerId) {
+    aace::carControl::CarControl::ControllerValue value;
+    value.type = type;
+    value.endpointId = endpointId;
+    value.controllerId = controllerId;
+    return value;
+}
 
 std::shared_ptr<CarControlEngineImpl> CarControlEngineImpl::create(
     std::shared_ptr<aace::carControl::CarControl> platformInterface) {
@@ -58,20 +120,22 @@ CarControlEngineImpl::CarControlEngineImpl(std::shared_ptr<aace::carControl::Car
 
 bool CarControlEngineImpl::turnPowerControllerOn(const std::string& endpointId) {
     AACE_DEBUG(LX(POWER_CONTROLLER_TAG).sensitive("endpoint", endpointId).sensitive("name", "TurnOn"));
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "turnPowerControllerOn", METRIC_CAR_CONTROL_TURN_POWERCONTROLLER_ON, 1);
-    return m_platformInterface->turnPowerControllerOn(endpointId);
+    s_turnPowerControllerOnCounter.emit();
+    auto value = createControllerValue(ControllerValue::ControllerType::POWER, endpointId, "");
+    value.turnOn = true;
+    return executeControllerValue(value);
 }
 
 bool CarControlEngineImpl::turnPowerControllerOff(const std::string& endpointId) {
     AACE_DEBUG(LX(POWER_CONTROLLER_TAG).sensitive("endpoint", endpointId).sensitive("name", "TurnOff"));
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "turnPowerControllerOff", METRIC_CAR_CONTROL_TURN_POWERCONTROLLER_OFF, 1);
-    return m_platformInterface->turnPowerControllerOff(endpointId);
+    s_turnPowerControllerOffCounter.emit();
+    auto value = createControllerValue(ControllerValue::ControllerType::POWER, endpointId, "");
+    value.turnOn = false;
+    return executeControllerValue(value);
 }
 
 bool CarControlEngineImpl::isPowerControllerOn(const std::string& endpointId, bool& isOn) {
-    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "isPowerControllerOn", METRIC_CAR_CONTROL_IS_POWERCONTROLLER_ON, 1);
+    s_isPowerControllerOnCounter.emit();
     return m_platformInterface->isPowerControllerOn(endpointId, isOn);
 }
 
@@ -80,9 +144,10 @@ bool CarControlEngineImpl::turnToggleControllerOn(const std::string& endpointId,
                    .sensitive("endpoint", endpointId)
                    .sensitive("name", "TurnOn")
                    .sensitive("instance", instance));
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "turnToggleControllerOn", METRIC_CAR_CONTROL_TURN_TOGGLECONTROLLER_ON, 1);
-    return m_platformInterface->turnToggleControllerOn(endpointId, instance);
+    s_turnToggleControllerOnCounter.emit();
+    auto value = createControllerValue(ControllerValue::ControllerType::TOGGLE, endpointId, instance);
+    value.turnOn = true;
+    return executeControllerValue(value);
 }
 
 bool CarControlEngineImpl::turnToggleControllerOff(const std::string& endpointId, const std::string& instance) {
@@ -90,17 +155,17 @@ bool CarControlEngineImpl::turnToggleControllerOff(const std::string& endpointId
                    .sensitive("endpoint", endpointId)
                    .sensitive("name", "TurnOff")
                    .sensitive("instance", instance));
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "turnToggleControllerOff", METRIC_CAR_CONTROL_TURN_TOGGLECONTROLLER_OFF, 1);
-    return m_platformInterface->turnToggleControllerOff(endpointId, instance);
+    s_turnToggleControllerOffCounter.emit();
+    auto value = createControllerValue(ControllerValue::ControllerType::TOGGLE, endpointId, instance);
+    value.turnOn = false;
+    return executeControllerValue(value);
 }
 
 bool CarControlEngineImpl::isToggleControllerOn(
     const std::string& endpointId,
     const std::string& instance,
     bool& isOn) {
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "isToggleControllerOn", METRIC_CAR_CONTROL_IS_TOGGLECONTROLLER_ON, 1);
+    s_isToggleControllerOnCounter.emit();
     return m_platformInterface->isToggleControllerOn(endpointId, instance, isOn);
 }
 
@@ -113,9 +178,10 @@ bool CarControlEngineImpl::setRangeControllerValue(
                    .sensitive("name", "SetRangeValue")
                    .sensitive("instance", instance)
                    .sensitive("rangeValue", value));
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "setRangeControllerValue", METRIC_CAR_CONTROL_SET_RANGECONTROLLER_VALUE, 1);
-    return m_platformInterface->setRangeControllerValue(endpointId, instance, value);
+    s_setRangeControllerValueCounter.emit();
+    auto rangeValue = createControllerValue(ControllerValue::ControllerType::RANGE, endpointId, instance);
+    rangeValue.rangeValue = value;
+    return executeControllerValue(rangeValue);
 }
 
 bool CarControlEngineImpl::adjustRangeControllerValue(
@@ -127,8 +193,7 @@ bool CarControlEngineImpl::adjustRangeControllerValue(
                    .sensitive("name", "AdjustRangeValue")
                    .sensitive("instance", instance)
                    .sensitive("rangeValueDelta", delta));
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "adjustRangeControllerValue", METRIC_CAR_CONTROL_ADJUST_RANGECONTROLLER_VALUE, 1);
+    s_adjustRangeControllerValueCounter.emit();
     return m_platformInterface->adjustRangeControllerValue(endpointId, instance, delta);
 }
 
@@ -136,8 +201,7 @@ bool CarControlEngineImpl::getRangeControllerValue(
     const std::string& endpointId,
     const std::string& instance,
     double& value) {
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "getRangeControllerValue", METRIC_CAR_CONTROL_GET_RANGECONTROLLER_VALUE, 1);
+    s_getRangeControllerValueCounter.emit();
     return m_platformInterface->getRangeControllerValue(endpointId, instance, value);
 }
 
@@ -150,9 +214,10 @@ bool CarControlEngineImpl::setModeControllerValue(
                    .sensitive("name", "SetMode")
                    .sensitive("instance", instance)
                    .sensitive("mode", value));
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "setModeControllerValue", METRIC_CAR_CONTROL_SET_MODECONTROLLER_VALUE, 1);
-    return m_platformInterface->setModeControllerValue(endpointId, instance, value);
+    s_setModeControllerValueCounter.emit();
+    auto modeValue = createControllerValue(ControllerValue::ControllerType::MODE, endpointId, instance);
+    modeValue.modeValue = value;
+    return executeControllerValue(modeValue);
 }
 
 bool CarControlEngineImpl::adjustModeControllerValue(
@@ -164,8 +229,7 @@ bool CarControlEngineImpl::adjustModeControllerValue(
                    .sensitive("name", "AdjustMode")
                    .sensitive("instance", instance)
                    .sensitive("modeDelta", delta));
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "adjustModeControllerValue", METRIC_CAR_CONTROL_ADJUST_MODECONTROLLER_VALUE, 1);
+    s_adjustModeControllerValueCounter.emit();
     return m_platformInterface->adjustModeControllerValue(endpointId, instance, delta);
 }
 
@@ -173,12 +237,172 @@ bool CarControlEngineImpl::getModeControllerValue(
     const std::string& endpointId,
     const std::string& instance,
     std::string& value) {
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "getModeControllerValue", METRIC_CAR_CONTROL_GET_MODECONTROLLER_VALUE, 1);
+    s_getModeControllerValueCounter.emit();
     return m_platformInterface->getModeControllerValue(endpointId, instance, value);
 }
 
+bool CarControlEngineImpl::setControllerValues(
+    const std::vector<ControllerValue>& values,
+    std::vector<bool>& results) {
+    AACE_DEBUG(LX(TAG).d("count", values.size()));
+    s_setControllerValuesCounter.emit();
+    return executeControllerValues(values, results);
+}
+
+bool CarControlEngineImpl::executeControllerValue(const ControllerValue& value) {
+    std::vector<bool> results;
+    return executeControllerValues({value}, results);
+}
+
+bool CarControlEngineImpl::executeControllerValues(
+    const std::vector<ControllerValue>& values,
+    std::vector<bool>& results) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto platformInterface = m_platformInterface;
+    if (platformInterface == nullptr) {
+        AACE_ERROR(LX(TAG).d("reason", "invalidPlatformInterface"));
+        results.assign(values.size(), false);
+        return false;
+    }
+
+    // without batch support the values are applied on the calling thread, so the controllers of
+    // different endpoints still reach the platform implementation concurrently
+    if (!platformInterface->supportsControllerValueBatches()) {
+        lock.unlock();
+        return platformInterface->setControllerValues(values, results);
+    }
+
+    // a batch is collected only while values arrive in a burst, so a single directive is not delayed
+    auto now = std::chrono::steady_clock::now();
+    bool collect = !m_pendingValues.empty() || !m_inFlightEndpoints.empty() ||
+                   now - m_lastQueuedTime < BATCH_COLLECTION_WINDOW;
+    m_lastQueuedTime = now;
+
+    std::vector<std::shared_ptr<PendingValue>> pendingValues;
+    pendingValues.reserve(values.size());
+
+    for (const auto& value : values) {
+        auto pendingValue = std::make_shared<PendingValue>(value);
+        pendingValues.push_back(pendingValue);
+        m_pendingValues.push_back(pendingValue);
+    }
+
+    // let the thread collecting a batch know that more values are queued
+    if (m_collectingBatch) {
+        m_trigger.notify_all();
+    }
+
+    auto isDone = [&pendingValues]() {
+        return std::all_of(
+            pendingValues.begin(), pendingValues.end(), [](const std::shared_ptr<PendingValue>& pendingValue) {
+                return pendingValue->done;
+            });
+    };
+
+    while (!isDone()) {
+        // wait while another thread collects or sends the batch containing our values, or while
+        // a batch for the same endpoint is in flight
+        if (m_collectingBatch || !isClaimable(pendingValues)) {
+            m_trigger.wait(lock);
+            continue;
+        }
+
+        // give the controllers of other endpoints targeted by the same directive time to queue their values,
+        // until no value is queued for the idle gap or the collection window ends
+        m_collectingBatch = true;
+        auto deadline = std::chrono::steady_clock::now() + BATCH_COLLECTION_WINDOW;
+        auto pendingCount = m_pendingValues.size();
+        while (collect) {
+            auto idleDeadline = std::min(deadline, std::chrono::steady_clock::now() + BATCH_COLLECTION_IDLE_GAP);
+            bool queued = m_trigger.wait_until(
+                lock, idleDeadline, [this, pendingCount]() { return m_pendingValues.size() != pendingCount; });
+            if (!queued || std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+            pendingCount = m_pendingValues.size();
+        }
+
+        auto batch = claimPendingValues();
+        platformInterface = m_platformInterface;
+        m_collectingBatch = false;
+
+        // another thread can start collecting the next batch while this one is in flight
+        m_trigger.notify_all();
+
+        lock.unlock();
+
+        std::vector<ControllerValue> batchValues;
+        batchValues.reserve(batch.size());
+        for (const auto& pendingValue : batch) {
+            batchValues.push_back(pendingValue->value);
+        }
+
+        std::vector<bool> batchResults;
+        if (platformInterface != nullptr) {
+            AACE_DEBUG(LX(TAG).d("batchSize", batchValues.size()));
+            platformInterface->setControllerValues(batchValues, batchResults);
+        } else {
+            AACE_ERROR(LX(TAG).d("reason", "invalidPlatformInterface"));
+        }
+
+        lock.lock();
+
+        for (size_t j = 0; j < batch.size(); j++) {
+            batch[j]->success = j < batchResults.size() && batchResults[j];
+            batch[j]->done = true;
+
+            auto it = m_inFlightEndpoints.find(batch[j]->value.endpointId);
+            if (it != m_inFlightEndpoints.end() && --it->second == 0) {
+                m_inFlightEndpoints.erase(it);
+            }
+        }
+
+        m_trigger.notify_all();
+    }
+
+    results.clear();
+    results.reserve(pendingValues.size());
+    for (const auto& pendingValue : pendingValues) {
+        results.push_back(pendingValue->success);
+    }
+
+    return std::all_of(results.begin(), results.end(), [](bool result) { return result; });
+}
+
+bool CarControlEngineImpl::isClaimable(const std::vector<std::shared_ptr<PendingValue>>& values) {
+    for (const auto& pendingValue : values) {
+        if (!pendingValue->claimed && m_inFlightEndpoints.count(pendingValue->value.endpointId) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<std::shared_ptr<CarControlEngineImpl::PendingValue>> CarControlEngineImpl::claimPendingValues() {
+    std::vector<std::shared_ptr<PendingValue>> batch;
+
+    // endpoints with values in flight before this batch; their queued values stay queued so they are
+    // applied after the values in flight
+    auto blockedEndpoints = m_inFlightEndpoints;
+
+    for (auto it = m_pendingValues.begin(); it != m_pendingValues.end();) {
+        auto& pendingValue = *it;
+        if (blockedEndpoints.count(pendingValue->value.endpointId) != 0) {
+            ++it;
+            continue;
+        }
+        pendingValue->claimed = true;
+        m_inFlightEndpoints[pendingValue->value.endpointId]++;
+        batch.push_back(pendingValue);
+        it = m_pendingValues.erase(it);
+    }
+
+    return batch;
+}
+
 void CarControlEngineImpl::doShutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (m_platformInterface != nullptr) {
         m_platformInterface.reset();
     }
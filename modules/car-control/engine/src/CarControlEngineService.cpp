@@ -15,12 +15,14 @@
 
 #include "AACE/Engine/CarControl/CarControlEngineService.h"
 
+#include <iterator>
 #include <string>
 #include <typeinfo>
 #include <unordered_map>
 
 #include "AACE/Alexa/AlexaProperties.h"
 #include "AACE/Engine/Alexa/AlexaComponentInterface.h"
+#include "AACE/Engine/CarControl/ConfigurationSnapshot.h"
 #include "AACE/Engine/CarControl/Endpoint.h"
 #include "AACE/Engine/CarControl/ZoneDefinitions.h"
 #include "AACE/Engine/Core/EngineMacros.h"
@@ -42,6 +44,8 @@ static const std::string AACE_STORAGE_SERVICE_KEY = "aace.storage";
 static const std::string CAR_CONTROL_CONFIG_TABLE = "carControl";
 /// The key for the 'configutation' in the database 'carControl' table
 static const std::string CAR_CONTROL_CONFIG_KEY = "configuration";
+/// The key for the configuration snapshot path in the database 'carControl' table
+static const std::string CAR_CONTROL_SNAPSHOT_PATH_KEY = "snapshotPath";
 
 /// The key for the 'endpoints' node of configuration
 static const std::string CONFIG_KEY_ENDPOINTS = "endpoints";
@@ -51,6 +55,8 @@ static const std::string CONFIG_KEY_ASSETS = "assets";
 static const std::string CONFIG_KEY_DEFAULT_ASSETS_PATH = "defaultAssetsPath";
 /// The key for the 'customAssetsPath' node of configuration
 static const std::string CONFIG_KEY_CUSTOM_ASSETS_PATH = "customAssetsPath";
+/// The key for the 'cachePath' node of configuration
+static const std::string CONFIG_KEY_CACHE_PATH = "cachePath";
 
 // The endpoint ID of the internal endpoint created for zones
 static const std::string INTERNAL_ENDPOINT_ID = "_AutoSDKInternalRoot";
@@ -84,35 +90,74 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
         AACE_DEBUG(LX(TAG).d("isLocalServiceAvailable", isLocalServiceAvailable()));
         ThrowIf(m_configured, "carControlEngineServiceAlreadyConfigured");
 
+        // Read the configuration text so it can be hashed to look up a compiled snapshot
+        std::string text{std::istreambuf_iterator<char>(*configuration), std::istreambuf_iterator<char>()};
+        uint64_t configurationHash = ConfigurationSnapshot::computeHash(text.data(), text.size());
+
+        auto localStorage =
+            getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>(AACE_STORAGE_SERVICE_KEY);
+        ThrowIfNull(localStorage, "invalidLocalStorage");
+
         json jconfiguration;
-        jconfiguration = json::parse(*configuration);
-
-        // Ingest assets from the file path(s) specified in configuration. Store custom assets in an @c AssetStore to
-        // facilitate retrieval of friendly name/locale pairs for asset expansion during @c Endpoint construction.
-        // Note: Default assets may be overridden for legacy backward compatibility, but this results in friendly name/
-        // locale pair expansion rather than using asset definitions stored in the cloud.
-
-        if (jconfiguration.contains(CONFIG_KEY_ASSETS) && jconfiguration[CONFIG_KEY_ASSETS].is_object()) {
-            auto& assets = jconfiguration.at(CONFIG_KEY_ASSETS);
-            if (assets.contains(CONFIG_KEY_DEFAULT_ASSETS_PATH) && assets[CONFIG_KEY_DEFAULT_ASSETS_PATH].is_string()) {
-                std::string path = assets.at(CONFIG_KEY_DEFAULT_ASSETS_PATH);
-                AACE_WARN(LX(TAG)
-                              .m("addingDefaultAssetsFromPath")
-                              .sensitive("path", path)
-                              .m("Assets in file override cloud definitions for matching IDs!"));
-                ThrowIfNot(m_assetStore.addAssets(path), "addDefaultAssetsFromPathFailed");
+        bool snapshotLoaded = loadConfigurationSnapshot(localStorage, configurationHash, jconfiguration);
+
+        if (!snapshotLoaded) {
+            jconfiguration = json::parse(text);
+
+            // Ingest assets from the file path(s) specified in configuration. Store custom assets in an @c AssetStore
+            // to facilitate retrieval of friendly name/locale pairs for asset expansion during @c Endpoint
+            // construction. Note: Default assets may be overridden for legacy backward compatibility, but this
+            // results in friendly name/locale pair expansion rather than using asset definitions stored in the cloud.
+            std::vector<std::string> assetPaths;
+
+            if (jconfiguration.contains(CONFIG_KEY_ASSETS) && jconfiguration[CONFIG_KEY_ASSETS].is_object()) {
+                auto& assets = jconfiguration.at(CONFIG_KEY_ASSETS);
+                if (assets.contains(CONFIG_KEY_DEFAULT_ASSETS_PATH) &&
+                    assets[CONFIG_KEY_DEFAULT_ASSETS_PATH].is_string()) {
+                    std::string path = assets.at(CONFIG_KEY_DEFAULT_ASSETS_PATH);
+                    AACE_WARN(LX(TAG)
+                                  .m("addingDefaultAssetsFromPath")
+                                  .sensitive("path", path)
+                                  .m("Assets in file override cloud definitions for matching IDs!"));
+                    ThrowIfNot(m_assetStore.addAssets(path), "addDefaultAssetsFromPathFailed");
+                    assetPaths.push_back(path);
+                }
+
+                if (assets.contains(CONFIG_KEY_CUSTOM_ASSETS_PATH) &&
+                    assets[CONFIG_KEY_CUSTOM_ASSETS_PATH].is_string()) {
+                    std::string path = assets.at(CONFIG_KEY_CUSTOM_ASSETS_PATH);
+                    AACE_DEBUG(LX(TAG).m("addingCustomAssetsFromPath").sensitive("path", path));
+                    ThrowIfNot(m_assetStore.addAssets(path), "addCustomAssetsFromPathFailed");
+                    assetPaths.push_back(path);
+                }
             }
 
-            if (assets.contains(CONFIG_KEY_CUSTOM_ASSETS_PATH) && assets[CONFIG_KEY_CUSTOM_ASSETS_PATH].is_string()) {
-                std::string path = assets.at(CONFIG_KEY_CUSTOM_ASSETS_PATH);
-                AACE_DEBUG(LX(TAG).m("addingCustomAssetsFromPath").sensitive("path", path));
-                ThrowIfNot(m_assetStore.addAssets(path), "addCustomAssetsFromPathFailed");
+            // Translate <v2.2 zones config format (top level "zones" array) to v2.3+ (ZoneDefinitions capability)
+            translateConfigForZones(jconfiguration);
+
+            // Compile the translated configuration and assets to a snapshot used by the next startup
+            if (jconfiguration.contains(CONFIG_KEY_CACHE_PATH) && jconfiguration[CONFIG_KEY_CACHE_PATH].is_string()) {
+                std::string path = jconfiguration.at(CONFIG_KEY_CACHE_PATH);
+                uint64_t assetsHash;
+                if (ConfigurationSnapshot::computeFilesHash(assetPaths, assetsHash) &&
+                    ConfigurationSnapshot::write(
+                        path,
+                        configurationHash,
+                        assetPaths,
+                        assetsHash,
+                        m_assetStore,
+                        jconfiguration,
+                        m_zonesCapabilityConfig)) {
+                    localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_SNAPSHOT_PATH_KEY, path);
+                } else {
+                    AACE_WARN(LX(TAG).m("writeConfigurationSnapshotFailed").sensitive("path", path));
+                    localStorage->removeKey(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_SNAPSHOT_PATH_KEY);
+                }
+            } else {
+                localStorage->removeKey(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_SNAPSHOT_PATH_KEY);
             }
         }
 
-        // Translate <v2.2 zones config format (top level "zones" array) to v2.3+ (ZoneDefinitions capability)
-        translateConfigForZones(jconfiguration);
-
         // Construct an object representation of each endpoint in configuration
         if (jconfiguration.contains(CONFIG_KEY_ENDPOINTS) && jconfiguration.at(CONFIG_KEY_ENDPOINTS).is_array()) {
             for (auto& item : jconfiguration.at(CONFIG_KEY_ENDPOINTS).items()) {
@@ -123,12 +168,12 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
             }
         }
 
-        // Write the configuration to storage for retrieval by the car control local service
-        auto localStorage =
-            getContext()->getServiceInterface<aace::engine::storage::LocalStorageInterface>(AACE_STORAGE_SERVICE_KEY);
-        ThrowIfNull(localStorage, "invalidLocalStorage");
-        std::string s = jconfiguration.dump();
-        localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, s);
+        // Write the configuration to storage for retrieval by the car control local service. The stored
+        // configuration is unchanged when it was loaded from a snapshot.
+        if (!snapshotLoaded || !localStorage->containsKey(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY)) {
+            std::string s = jconfiguration.dump();
+            localStorage->put(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_CONFIG_KEY, s);
+        }
 
         m_configured = true;
         return true;
@@ -138,6 +183,35 @@ bool CarControlEngineService::configure(std::shared_ptr<std::istream> configurat
     }
 }
 
+bool CarControlEngineService::loadConfigurationSnapshot(
+    std::shared_ptr<aace::engine::storage::LocalStorageInterface> localStorage,
+    uint64_t configurationHash,
+    json& jconfiguration) {
+    try {
+        ReturnIfNot(localStorage->containsKey(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_SNAPSHOT_PATH_KEY), false);
+        std::string path = localStorage->get(CAR_CONTROL_CONFIG_TABLE, CAR_CONTROL_SNAPSHOT_PATH_KEY, "");
+
+        auto snapshot = ConfigurationSnapshot::open(path, configurationHash);
+        ReturnIfNot(snapshot, false);
+
+        // The snapshot is stale if any of the asset files changed after it was written
+        uint64_t assetsHash;
+        ReturnIfNot(ConfigurationSnapshot::computeFilesHash(snapshot->getAssetPaths(), assetsHash), false);
+        ReturnIfNot(assetsHash == snapshot->getAssetsHash(), false);
+
+        ThrowIfNot(snapshot->loadAssets(m_assetStore), "loadAssetsFailed");
+        ThrowIfNot(snapshot->loadConfiguration(jconfiguration, m_zonesCapabilityConfig), "loadConfigurationFailed");
+
+        AACE_DEBUG(LX(TAG).m("loadedConfigurationSnapshot").sensitive("path", path));
+        return true;
+    } catch (std::exception& ex) {
+        AACE_WARN(LX(TAG).d("reason", ex.what()));
+        m_assetStore.clear();
+        m_zonesCapabilityConfig = json();
+        return false;
+    }
+}
+
 bool CarControlEngineService::setup() {
     try {
         if (m_carControlEngineImpl != nullptr) {
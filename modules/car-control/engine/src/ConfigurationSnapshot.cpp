@@ -0,0 +1,395 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AACE/Engine/CarControl/ConfigurationSnapshot.h>
+#include <AACE/Engine/Core/EngineMacros.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aace {
+namespace engine {
+namespace carControl {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("aace.carControl.ConfigurationSnapshot");
+
+/// Identifies a snapshot file. A snapshot written on a host with a different byte order does not match.
+static const uint32_t SNAPSHOT_MAGIC = 0x53434341;  // "ACCS"
+
+/// The snapshot format version. Increment when the format or the content of the snapshot changes.
+static const uint32_t SNAPSHOT_VERSION = 1;
+
+/// The FNV-1a 64-bit prime
+static const uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+/// The size of the buffer used to hash files
+static const size_t FILE_HASH_BUFFER_SIZE = 64 * 1024;
+
+const uint64_t ConfigurationSnapshot::INITIAL_HASH;
+
+/// Syncs the directory that contains a file, so a file renamed in the directory is persisted.
+static bool syncDirectory(const std::string& path) {
+    auto separator = path.find_last_of('/');
+    auto directory = separator == std::string::npos ? std::string(".") : path.substr(0, std::max<size_t>(separator, 1));
+
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    bool synced = ::fsync(fd) == 0;
+    ::close(fd);
+
+    return synced;
+}
+
+/**
+ * Appends fixed size values and byte sequences to the snapshot buffer.
+ */
+class SnapshotWriter {
+public:
+    void writeUInt32(uint32_t value) {
+        m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void writeUInt64(uint64_t value) {
+        m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void writeBytes(const void* data, size_t size) {
+        writeUInt32(static_cast<uint32_t>(size));
+        m_buffer.append(static_cast<const char*>(data), size);
+    }
+
+    const std::string& getBuffer() const {
+        return m_buffer;
+    }
+
+private:
+    std::string m_buffer;
+};
+
+/**
+ * Reads fixed size values and byte sequences from the mapped snapshot, checking that each read is
+ * within the bounds of the file.
+ */
+class SnapshotReader {
+public:
+    SnapshotReader(const uint8_t* data, size_t size, size_t offset) : m_data(data), m_size(size), m_offset(offset) {
+    }
+
+    uint32_t readUInt32() {
+        uint32_t value;
+        std::memcpy(&value, read(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    uint64_t readUInt64() {
+        uint64_t value;
+        std::memcpy(&value, read(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    const uint8_t* readBytes(size_t& size) {
+        size = readUInt32();
+        return read(size);
+    }
+
+    size_t getOffset() const {
+        return m_offset;
+    }
+
+private:
+    const uint8_t* read(size_t size) {
+        ThrowIf(size > m_size - m_offset, "snapshotTruncated");
+        const uint8_t* data = m_data + m_offset;
+        m_offset += size;
+        return data;
+    }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_offset;
+};
+
+uint64_t ConfigurationSnapshot::computeHash(const char* data, size_t size, uint64_t hash) {
+    for (size_t j = 0; j < size; j++) {
+        hash ^= static_cast<uint8_t>(data[j]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+bool ConfigurationSnapshot::computeFilesHash(const std::vector<std::string>& paths, uint64_t& hash) {
+    try {
+        std::vector<char> buffer(FILE_HASH_BUFFER_SIZE);
+        hash = INITIAL_HASH;
+        for (const auto& path : paths) {
+            std::ifstream ifs(path, std::ios::binary);
+            ThrowIfNot(ifs.good(), "openAssetsFileFailed");
+            while (ifs) {
+                ifs.read(buffer.data(), buffer.size());
+                hash = computeHash(buffer.data(), static_cast<size_t>(ifs.gcount()), hash);
+            }
+            ThrowIfNot(ifs.eof(), "readAssetsFileFailed");
+            // separate the contents of each file in the hash
+            hash = computeHash(path.c_str(), path.size() + 1, hash);
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool ConfigurationSnapshot::write(
+    const std::string& path,
+    uint64_t configurationHash,
+    const std::vector<std::string>& assetPaths,
+    uint64_t assetsHash,
+    const AssetStore& assetStore,
+    const nlohmann::json& configuration,
+    const nlohmann::json& zonesCapabilityConfig) {
+    std::string tempPath = path + ".tmp";
+    int fd = -1;
+    try {
+        // intern every string used by the asset paths and the asset table
+        std::unordered_map<std::string, uint32_t> stringIndexes;
+        std::vector<const std::string*> strings;
+        auto intern = [&stringIndexes, &strings](const std::string& value) {
+            auto result = stringIndexes.emplace(value, static_cast<uint32_t>(strings.size()));
+            if (result.second) {
+                strings.push_back(&result.first->first);
+            }
+            return result.first->second;
+        };
+
+        std::vector<uint32_t> assetPathIndexes;
+        for (const auto& assetPath : assetPaths) {
+            assetPathIndexes.push_back(intern(assetPath));
+        }
+
+        SnapshotWriter assetTable;
+        auto assetIds = assetStore.getAssetIds();
+        assetTable.writeUInt32(static_cast<uint32_t>(assetIds.size()));
+        for (const auto& assetId : assetIds) {
+            auto names = assetStore.getFriendlyNames(assetId);
+            assetTable.writeUInt32(intern(assetId));
+            assetTable.writeUInt32(static_cast<uint32_t>(names.size()));
+            for (auto name : names) {
+                assetTable.writeUInt32(intern(name.first));
+                assetTable.writeUInt32(intern(name.second));
+            }
+        }
+
+        SnapshotWriter snapshot;
+        snapshot.writeUInt32(SNAPSHOT_MAGIC);
+        snapshot.writeUInt32(SNAPSHOT_VERSION);
+        snapshot.writeUInt64(configurationHash);
+        snapshot.writeUInt64(assetsHash);
+
+        snapshot.writeUInt32(static_cast<uint32_t>(strings.size()));
+        for (const auto string : strings) {
+            snapshot.writeBytes(string->data(), string->size());
+        }
+
+        snapshot.writeUInt32(static_cast<uint32_t>(assetPathIndexes.size()));
+        for (auto index : assetPathIndexes) {
+            snapshot.writeUInt32(index);
+        }
+
+        const auto& assetTableBuffer = assetTable.getBuffer();
+        const auto& snapshotBuffer = snapshot.getBuffer();
+
+        auto configurationData = nlohmann::json::to_cbor(configuration);
+        auto zonesData = nlohmann::json::to_cbor(zonesCapabilityConfig);
+
+        std::string data;
+        data.reserve(snapshotBuffer.size() + assetTableBuffer.size() + configurationData.size() + zonesData.size() + 8);
+        data.append(snapshotBuffer);
+        data.append(assetTableBuffer);
+
+        SnapshotWriter configurationSection;
+        configurationSection.writeBytes(configurationData.data(), configurationData.size());
+        configurationSection.writeBytes(zonesData.data(), zonesData.size());
+        data.append(configurationSection.getBuffer());
+
+        // write the snapshot to a temporary file and replace the snapshot when it is complete
+        fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        ThrowIf(fd < 0, "openSnapshotFileFailed");
+
+        size_t offset = 0;
+        while (offset < data.size()) {
+            ssize_t count = ::write(fd, data.data() + offset, data.size() - offset);
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            ThrowIf(count <= 0, "writeSnapshotFileFailed");
+            offset += static_cast<size_t>(count);
+        }
+        ThrowIf(::fsync(fd) != 0, "syncSnapshotFileFailed");
+        ::close(fd);
+        fd = -1;
+
+        ThrowIf(std::rename(tempPath.c_str(), path.c_str()) != 0, "renameSnapshotFileFailed");
+        ThrowIfNot(syncDirectory(path), "syncSnapshotDirectoryFailed");
+
+        AACE_DEBUG(LX(TAG).d("size", data.size()).d("strings", strings.size()).d("assets", assetIds.size()));
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("path", path));
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        std::remove(tempPath.c_str());
+        return false;
+    }
+}
+
+std::unique_ptr<ConfigurationSnapshot> ConfigurationSnapshot::open(
+    const std::string& path,
+    uint64_t configurationHash) {
+    std::unique_ptr<ConfigurationSnapshot> snapshot(new ConfigurationSnapshot());
+    return snapshot->initialize(path, configurationHash) ? std::move(snapshot) : nullptr;
+}
+
+bool ConfigurationSnapshot::initialize(const std::string& path, uint64_t configurationHash) {
+    try {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        ReturnIf(fd < 0, false);
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            Throw("invalidSnapshotFile");
+        }
+
+        void* data = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        ThrowIf(data == MAP_FAILED, "mapSnapshotFileFailed");
+
+        m_data = static_cast<const uint8_t*>(data);
+        m_size = static_cast<size_t>(info.st_size);
+
+        SnapshotReader reader(m_data, m_size, 0);
+        ThrowIfNot(reader.readUInt32() == SNAPSHOT_MAGIC, "invalidSnapshotMagic");
+        ReturnIfNot(reader.readUInt32() == SNAPSHOT_VERSION, false);
+        ReturnIfNot(reader.readUInt64() == configurationHash, false);
+        m_assetsHash = reader.readUInt64();
+
+        uint32_t stringCount = reader.readUInt32();
+        m_strings.reserve(stringCount);
+        for (uint32_t j = 0; j < stringCount; j++) {
+            size_t size;
+            auto string = reader.readBytes(size);
+            m_strings.emplace_back(reinterpret_cast<const char*>(string), size);
+        }
+
+        uint32_t assetPathCount = reader.readUInt32();
+        for (uint32_t j = 0; j < assetPathCount; j++) {
+            auto index = reader.readUInt32();
+            ThrowIfNot(index < m_strings.size(), "invalidStringIndex");
+            m_assetPaths.push_back(m_strings[index]);
+        }
+
+        // skip the asset table, which is read by loadAssets()
+        m_assetTableOffset = reader.getOffset();
+        uint32_t assetCount = reader.readUInt32();
+        for (uint32_t j = 0; j < assetCount; j++) {
+            reader.readUInt32();
+            uint32_t nameCount = reader.readUInt32();
+            for (uint32_t k = 0; k < nameCount; k++) {
+                reader.readUInt64();
+            }
+        }
+
+        m_configurationOffset = reader.getOffset();
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()).sensitive("path", path));
+        return false;
+    }
+}
+
+ConfigurationSnapshot::~ConfigurationSnapshot() {
+    if (m_data != nullptr) {
+        ::munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+}
+
+const std::vector<std::string>& ConfigurationSnapshot::getAssetPaths() const {
+    return m_assetPaths;
+}
+
+uint64_t ConfigurationSnapshot::getAssetsHash() const {
+    return m_assetsHash;
+}
+
+bool ConfigurationSnapshot::loadAssets(AssetStore& assetStore) const {
+    try {
+        SnapshotReader reader(m_data, m_size, m_assetTableOffset);
+        uint32_t assetCount = reader.readUInt32();
+        for (uint32_t j = 0; j < assetCount; j++) {
+            auto idIndex = reader.readUInt32();
+            ThrowIfNot(idIndex < m_strings.size(), "invalidStringIndex");
+            uint32_t nameCount = reader.readUInt32();
+            std::vector<AssetStore::NameLocalePair> names;
+            names.reserve(nameCount);
+            for (uint32_t k = 0; k < nameCount; k++) {
+                auto nameIndex = reader.readUInt32();
+                auto localeIndex = reader.readUInt32();
+                ThrowIfNot(nameIndex < m_strings.size() && localeIndex < m_strings.size(), "invalidStringIndex");
+                names.emplace_back(m_strings[nameIndex], m_strings[localeIndex]);
+            }
+            assetStore.addAsset(m_strings[idIndex], names);
+        }
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool ConfigurationSnapshot::loadConfiguration(nlohmann::json& configuration, nlohmann::json& zonesCapabilityConfig)
+    const {
+    try {
+        SnapshotReader reader(m_data, m_size, m_configurationOffset);
+        size_t size;
+        auto data = reader.readBytes(size);
+        configuration = nlohmann::json::from_cbor(data, data + size);
+        data = reader.readBytes(size);
+        zonesCapabilityConfig = nlohmann::json::from_cbor(data, data + size);
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+}  // namespace carControl
+}  // namespace engine
+}  // namespace aace
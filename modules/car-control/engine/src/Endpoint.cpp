@@ -165,13 +165,13 @@ bool Endpoint::build(
         alexaClientSDK::avsCommon::avs::EndpointResources endpointResources;
         for (auto asset = m_assetIds.begin(); asset != m_assetIds.end(); ++asset) {
             // Expand assets present in the AssetStore. Use the asset ID for assets that are absent
-            const std::vector<AssetStore::NameLocalePair>& names = assetStore.getFriendlyNames(*asset);
+            auto names = assetStore.getFriendlyNames(*asset);
             if (names.empty()) {
                 endpointResources.addFriendlyNameWithAssetId(*asset);
             } else {
                 AACE_DEBUG(LX(TAG).m("expanding asset to text").d("assetID", *asset));
-                for (auto name = names.begin(); name != names.end(); ++name) {
-                    endpointResources.addFriendlyNameWithText(name->first, name->second);
+                for (auto name : names) {
+                    endpointResources.addFriendlyNameWithText(name.first, name.second);
                 }
             }
         }
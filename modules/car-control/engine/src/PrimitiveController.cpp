@@ -57,13 +57,13 @@ alexaClientSDK::avsCommon::utils::Optional<CapabilityResources> PrimitiveControl
             auto& value = item.value().at("value");
             std::string assetId = value.at("assetId");
             // Expand assets present in the AssetStore. Use the asset ID for assets that are absent
-            const std::vector<AssetStore::NameLocalePair>& names = assetStore.getFriendlyNames(assetId);
+            auto names = assetStore.getFriendlyNames(assetId);
             if (names.empty()) {
                 capabilityResources.addFriendlyNameWithAssetId(assetId);
             } else {
                 AACE_DEBUG(LX(TAG).m("expandingAssetToText").d("assetID", assetId));
-                for (auto name = names.begin(); name != names.end(); ++name) {
-                    capabilityResources.addFriendlyNameWithText(name->first, name->second);
+                for (auto name : names) {
+                    capabilityResources.addFriendlyNameWithText(name.first, name.second);
                 }
             }
         }
@@ -81,12 +81,12 @@ std::shared_ptr<ZoneDefinitions> ZoneDefinitions::create(
                 } else {
                     ThrowIfNot(type == "asset", "invalidFriendlyNameType");
                     std::string assetId = friendlyName["value"]["assetId"];
-                    const std::vector<AssetStore::NameLocalePair>& names = assetStore.getFriendlyNames(assetId);
+                    auto names = assetStore.getFriendlyNames(assetId);
                     if (names.empty()) {
                         translatedNames.push_back(friendlyName);
                     } else {
                         // Expand asset to text if the asset is in the AssetStore
-                        for (auto& name : names) {
+                        for (auto name : names) {
                             // clang-format off
                             json translatedName = {
                                 {"@type", "text"},
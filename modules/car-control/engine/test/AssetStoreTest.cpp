@@ -0,0 +1,191 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "AACE/Engine/CarControl/AssetStore.h"
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using aace::engine::carControl::AssetStore;
+
+/// An assets file with a value that has synonyms in two locales
+static const std::string ASSETS = R"({
+    "assets": [
+        {
+            "assetId": "Alexa.Setting.FanSpeed",
+            "values": [
+                {
+                    "defaultValue": "fan speed",
+                    "synonyms": ["fan", "blower"],
+                    "locales": ["en-US", "en-GB"]
+                },
+                {
+                    "defaultValue": "velocidad",
+                    "locales": ["es-ES"]
+                }
+            ]
+        },
+        {
+            "assetId": "Alexa.Setting.Temperature",
+            "values": [
+                {
+                    "defaultValue": "temperature",
+                    "locales": ["en-US"]
+                }
+            ]
+        }
+    ]
+})";
+
+/// An assets file that redefines an asset of @c ASSETS
+static const std::string OVERRIDE_ASSETS = R"({
+    "assets": [
+        {
+            "assetId": "Alexa.Setting.Temperature",
+            "values": [
+                {
+                    "defaultValue": "heat",
+                    "locales": ["en-US"]
+                }
+            ]
+        },
+        {
+            "assetId": "Alexa.Setting.Mode",
+            "values": [
+                {
+                    "defaultValue": "mode",
+                    "locales": ["en-US"]
+                }
+            ]
+        }
+    ]
+})";
+
+class AssetStoreTest : public ::testing::Test {
+public:
+    void TearDown() override {
+        for (const auto& path : m_paths) {
+            std::remove(path.c_str());
+        }
+    }
+
+protected:
+    std::string writeAssets(const std::string& contents) {
+        std::string path = "AssetStoreTest" + std::to_string(m_paths.size()) + ".json";
+        std::ofstream ofs(path, std::ios::trunc);
+        ofs << contents;
+        m_paths.push_back(path);
+        return path;
+    }
+
+    static std::vector<AssetStore::NameLocalePair> getNames(const AssetStore& assetStore, const std::string& assetId) {
+        std::vector<AssetStore::NameLocalePair> names;
+        for (auto name : assetStore.getFriendlyNames(assetId)) {
+            names.emplace_back(name.first, name.second);
+        }
+        return names;
+    }
+
+    std::vector<std::string> m_paths;
+};
+
+/**
+ * Test that the default value and each synonym of an asset value are added for every locale of the value.
+ */
+TEST_F(AssetStoreTest, namesAreExpandedForEachLocale) {
+    AssetStore assetStore;
+    ASSERT_TRUE(assetStore.addAssets(writeAssets(ASSETS)));
+
+    std::vector<AssetStore::NameLocalePair> expected = {{"fan speed", "en-US"},
+                                                        {"fan", "en-US"},
+                                                        {"blower", "en-US"},
+                                                        {"fan speed", "en-GB"},
+                                                        {"fan", "en-GB"},
+                                                        {"blower", "en-GB"},
+                                                        {"velocidad", "es-ES"}};
+    EXPECT_EQ(expected, getNames(assetStore, "Alexa.Setting.FanSpeed"));
+    EXPECT_EQ(
+        std::vector<AssetStore::NameLocalePair>({{"temperature", "en-US"}}),
+        getNames(assetStore, "Alexa.Setting.Temperature"));
+}
+
+/**
+ * Test that an asset that is already in the store is not replaced by a later definition, and that
+ * each distinct string is stored once.
+ */
+TEST_F(AssetStoreTest, duplicateAssetsAreNotReplaced) {
+    AssetStore assetStore;
+    ASSERT_TRUE(assetStore.addAssets(writeAssets(ASSETS)));
+    ASSERT_TRUE(assetStore.addAssets(writeAssets(OVERRIDE_ASSETS)));
+    assetStore.addAsset("Alexa.Setting.FanSpeed", {{"ventilator", "de-DE"}});
+
+    EXPECT_EQ(3u, assetStore.getAssetIds().size());
+    EXPECT_EQ(7u, assetStore.getFriendlyNames("Alexa.Setting.FanSpeed").size());
+    EXPECT_EQ(
+        std::vector<AssetStore::NameLocalePair>({{"temperature", "en-US"}}),
+        getNames(assetStore, "Alexa.Setting.Temperature"));
+    EXPECT_EQ(
+        std::vector<AssetStore::NameLocalePair>({{"mode", "en-US"}}), getNames(assetStore, "Alexa.Setting.Mode"));
+
+    // the names of different assets refer to the same locale string
+    auto temperature = *assetStore.getFriendlyNames("Alexa.Setting.Temperature").begin();
+    auto mode = *assetStore.getFriendlyNames("Alexa.Setting.Mode").begin();
+    EXPECT_EQ(&temperature.second, &mode.second);
+}
+
+/**
+ * Test that an asset that is not in the store has no friendly names.
+ */
+TEST_F(AssetStoreTest, unknownAssetHasNoNames) {
+    AssetStore assetStore;
+    ASSERT_TRUE(assetStore.addAssets(writeAssets(ASSETS)));
+
+    auto names = assetStore.getFriendlyNames("Alexa.Setting.Unknown");
+    EXPECT_TRUE(names.empty());
+    EXPECT_EQ(names.begin(), names.end());
+
+    // a locale or friendly name string is not an asset ID
+    EXPECT_TRUE(assetStore.getFriendlyNames("en-US").empty());
+    EXPECT_TRUE(assetStore.getFriendlyNames("fan").empty());
+}
+
+/**
+ * Test that a malformed assets file or an asset without names is rejected, and clears the store.
+ */
+TEST_F(AssetStoreTest, invalidAssetsAreRejected) {
+    AssetStore assetStore;
+    ASSERT_TRUE(assetStore.addAssets(writeAssets(ASSETS)));
+
+    EXPECT_FALSE(assetStore.addAssets(writeAssets(R"({"assets": [{"assetId": "Alexa.Setting.Mode", "values": [])")));
+    EXPECT_TRUE(assetStore.getAssetIds().empty());
+
+    ASSERT_TRUE(assetStore.addAssets(writeAssets(ASSETS)));
+    EXPECT_FALSE(assetStore.addAssets(writeAssets(R"({"assets": [{"assetId": "Alexa.Setting.Mode", "values": []}]})")));
+    EXPECT_TRUE(assetStore.getAssetIds().empty());
+
+    EXPECT_FALSE(assetStore.addAssets("AssetStoreTestMissing.json"));
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
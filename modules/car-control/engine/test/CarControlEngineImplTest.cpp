@@ -0,0 +1,228 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AACE/CarControl/CarControl.h"
+#include "AACE/Engine/CarControl/CarControlEngineImpl.h"
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using ControllerValue = aace::carControl::CarControl::ControllerValue;
+
+/// How long a test waits for the platform implementation to be called.
+static const std::chrono::seconds TEST_TIMEOUT(5);
+
+/**
+ * A car control platform implementation that records the batches it receives. The first batch can be
+ * held until it is released, to keep its endpoints in flight.
+ */
+class TestCarControl : public aace::carControl::CarControl {
+public:
+    TestCarControl(bool batches) : m_batches(batches) {
+    }
+
+    bool supportsControllerValueBatches() override {
+        return m_batches;
+    }
+
+    bool setControllerValues(const std::vector<ControllerValue>& values, std::vector<bool>& results) override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_receivedBatches.push_back(values);
+        m_trigger.notify_all();
+
+        if (m_receivedBatches.size() == 1 && m_holdFirstBatch) {
+            m_trigger.wait_for(lock, TEST_TIMEOUT, [this]() { return !m_holdFirstBatch; });
+        }
+
+        lock.unlock();
+        return aace::carControl::CarControl::setControllerValues(values, results);
+    }
+
+    bool turnPowerControllerOn(const std::string& endpointId) override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_activeSetters++;
+        m_maxActiveSetters = std::max(m_maxActiveSetters, m_activeSetters);
+        m_trigger.notify_all();
+
+        // give the other setters a chance to run at the same time
+        m_trigger.wait_for(lock, std::chrono::milliseconds(200), [this]() { return m_activeSetters >= 3; });
+        m_activeSetters--;
+        return true;
+    }
+
+    bool turnPowerControllerOff(const std::string& endpointId) override {
+        return true;
+    }
+
+    void holdFirstBatch() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_holdFirstBatch = true;
+    }
+
+    void releaseFirstBatch() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_holdFirstBatch = false;
+        m_trigger.notify_all();
+    }
+
+    bool waitForBatches(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_trigger.wait_for(lock, TEST_TIMEOUT, [this, count]() { return m_receivedBatches.size() >= count; });
+    }
+
+    std::vector<std::vector<ControllerValue>> getReceivedBatches() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_receivedBatches;
+    }
+
+    int getMaxActiveSetters() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_maxActiveSetters;
+    }
+
+private:
+    bool m_batches;
+    std::mutex m_mutex;
+    std::condition_variable m_trigger;
+    std::vector<std::vector<ControllerValue>> m_receivedBatches;
+    bool m_holdFirstBatch = false;
+    int m_activeSetters = 0;
+    int m_maxActiveSetters = 0;
+};
+
+static ControllerValue createPowerValue(const std::string& endpointId, bool turnOn) {
+    ControllerValue value;
+    value.type = ControllerValue::ControllerType::POWER;
+    value.endpointId = endpointId;
+    value.turnOn = turnOn;
+    return value;
+}
+
+class CarControlEngineImplTest : public ::testing::Test {
+public:
+    void create(bool batches) {
+        m_platformInterface = std::make_shared<TestCarControl>(batches);
+        m_carControlEngineImpl = aace::engine::carControl::CarControlEngineImpl::create(m_platformInterface);
+        ASSERT_NE(nullptr, m_carControlEngineImpl);
+    }
+
+    void TearDown() override {
+        if (m_carControlEngineImpl != nullptr) {
+            m_carControlEngineImpl->shutdown();
+        }
+    }
+
+    std::shared_ptr<TestCarControl> m_platformInterface;
+    std::shared_ptr<aace::engine::carControl::CarControlEngineImpl> m_carControlEngineImpl;
+};
+
+/**
+ * Test that set commands for different endpoints reach the platform implementation concurrently when it
+ * does not support batches.
+ */
+TEST_F(CarControlEngineImplTest, concurrentSettersWithoutBatchSupport) {
+    create(false);
+
+    std::vector<std::thread> threads;
+    for (auto endpointId : {"a", "b", "c"}) {
+        threads.emplace_back([this, endpointId]() {
+            EXPECT_TRUE(m_carControlEngineImpl->turnPowerControllerOn(endpointId));
+        });
+    }
+    for (auto& next : threads) {
+        next.join();
+    }
+
+    EXPECT_EQ(3, m_platformInterface->getMaxActiveSetters());
+
+    // each command is passed on its own
+    for (const auto& batch : m_platformInterface->getReceivedBatches()) {
+        EXPECT_EQ(1u, batch.size());
+    }
+}
+
+/**
+ * Test that a single set command is sent right away in a batch of its own.
+ */
+TEST_F(CarControlEngineImplTest, singleValueIsSentAlone) {
+    create(true);
+
+    EXPECT_TRUE(m_carControlEngineImpl->turnPowerControllerOff("a"));
+
+    auto batches = m_platformInterface->getReceivedBatches();
+    ASSERT_EQ(1u, batches.size());
+    ASSERT_EQ(1u, batches[0].size());
+    EXPECT_EQ("a", batches[0][0].endpointId);
+    EXPECT_FALSE(batches[0][0].turnOn);
+}
+
+/**
+ * Test that the values queued while a batch is in flight are sent together in the next batch, and that a
+ * value for an endpoint in flight is held back until the batch for that endpoint completes.
+ */
+TEST_F(CarControlEngineImplTest, valuesQueuedWhileInFlightAreBatched) {
+    create(true);
+    m_platformInterface->holdFirstBatch();
+
+    std::thread first([this]() { EXPECT_TRUE(m_carControlEngineImpl->turnPowerControllerOff("a")); });
+    ASSERT_TRUE(m_platformInterface->waitForBatches(1));
+
+    std::thread second([this]() { EXPECT_TRUE(m_carControlEngineImpl->turnPowerControllerOff("a")); });
+
+    std::vector<bool> results;
+    std::thread third([this, &results]() {
+        EXPECT_TRUE(m_carControlEngineImpl->setControllerValues(
+            {createPowerValue("b", false), createPowerValue("c", false), createPowerValue("d", false)}, results));
+    });
+
+    // the values for the other endpoints are not held back by the batch in flight
+    third.join();
+    EXPECT_EQ(std::vector<bool>({true, true, true}), results);
+
+    m_platformInterface->releaseFirstBatch();
+    first.join();
+    second.join();
+
+    auto batches = m_platformInterface->getReceivedBatches();
+    ASSERT_EQ(3u, batches.size());
+    ASSERT_EQ(1u, batches[0].size());
+    EXPECT_EQ("a", batches[0][0].endpointId);
+
+    std::vector<std::string> endpointIds;
+    for (size_t j = 1; j < batches.size(); j++) {
+        for (const auto& value : batches[j]) {
+            endpointIds.push_back(value.endpointId);
+        }
+    }
+
+    // the second value for "a" is sent after the first one completes
+    EXPECT_EQ("a", endpointIds.back());
+    EXPECT_EQ(std::vector<std::string>({"b", "c", "d", "a"}), endpointIds);
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2019-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "AACE/Engine/CarControl/AssetStore.h"
+#include "AACE/Engine/CarControl/ConfigurationSnapshot.h"
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using aace::engine::carControl::AssetStore;
+using aace::engine::carControl::ConfigurationSnapshot;
+using json = nlohmann::json;
+
+/// The hash of the configuration used by the tests
+static const uint64_t CONFIGURATION_HASH = 0x1234;
+
+/// The hash of the asset files used by the tests
+static const uint64_t ASSETS_HASH = 0x5678;
+
+/// The offset of the format version in a snapshot file
+static const size_t VERSION_OFFSET = 4;
+
+class ConfigurationSnapshotTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_path = "ConfigurationSnapshotTest.snapshot";
+        std::remove(m_path.c_str());
+
+        m_assetStore.addAsset("Alexa.Setting.Temperature", {{"temperature", "en-US"}, {"temp", "en-US"}});
+        m_assetStore.addAsset("Alexa.Setting.FanSpeed", {{"fan speed", "en-US"}, {"velocidad", "es-ES"}});
+
+        m_configuration = {{"endpoints", {{{"endpointId", "car.heater"}, {"capabilities", json::array()}}}}};
+        m_zonesCapabilityConfig = {{"zones", {{{"zoneId", "zone.all"}}}}};
+    }
+
+    void TearDown() override {
+        std::remove(m_path.c_str());
+    }
+
+protected:
+    bool writeSnapshot() {
+        return ConfigurationSnapshot::write(
+            m_path,
+            CONFIGURATION_HASH,
+            {"assets/default.json", "assets/custom.json"},
+            ASSETS_HASH,
+            m_assetStore,
+            m_configuration,
+            m_zonesCapabilityConfig);
+    }
+
+    std::string readFile() {
+        std::ifstream ifs(m_path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+
+    void writeFile(const std::string& data) {
+        std::ofstream ofs(m_path, std::ios::binary | std::ios::trunc);
+        ofs.write(data.data(), data.size());
+    }
+
+    std::string m_path;
+    AssetStore m_assetStore;
+    json m_configuration;
+    json m_zonesCapabilityConfig;
+};
+
+/**
+ * Test that the configuration, asset paths, and assets written to a snapshot are read back unchanged.
+ */
+TEST_F(ConfigurationSnapshotTest, roundTrip) {
+    ASSERT_TRUE(writeSnapshot());
+
+    auto snapshot = ConfigurationSnapshot::open(m_path, CONFIGURATION_HASH);
+    ASSERT_NE(nullptr, snapshot);
+
+    EXPECT_EQ(std::vector<std::string>({"assets/default.json", "assets/custom.json"}), snapshot->getAssetPaths());
+    EXPECT_EQ(ASSETS_HASH, snapshot->getAssetsHash());
+
+    json configuration;
+    json zonesCapabilityConfig;
+    ASSERT_TRUE(snapshot->loadConfiguration(configuration, zonesCapabilityConfig));
+    EXPECT_EQ(m_configuration, configuration);
+    EXPECT_EQ(m_zonesCapabilityConfig, zonesCapabilityConfig);
+
+    AssetStore assetStore;
+    ASSERT_TRUE(snapshot->loadAssets(assetStore));
+    EXPECT_EQ(m_assetStore.getAssetIds().size(), assetStore.getAssetIds().size());
+    for (const auto& assetId : m_assetStore.getAssetIds()) {
+        std::vector<AssetStore::NameLocalePair> expected;
+        for (auto name : m_assetStore.getFriendlyNames(assetId)) {
+            expected.emplace_back(name.first, name.second);
+        }
+        std::vector<AssetStore::NameLocalePair> actual;
+        for (auto name : assetStore.getFriendlyNames(assetId)) {
+            actual.emplace_back(name.first, name.second);
+        }
+        EXPECT_EQ(expected, actual) << assetId;
+    }
+}
+
+/**
+ * Test that a snapshot written for a different configuration is not opened.
+ */
+TEST_F(ConfigurationSnapshotTest, configurationHashMismatch) {
+    ASSERT_TRUE(writeSnapshot());
+
+    EXPECT_EQ(nullptr, ConfigurationSnapshot::open(m_path, CONFIGURATION_HASH + 1));
+}
+
+/**
+ * Test that a snapshot with a different format version is not opened.
+ */
+TEST_F(ConfigurationSnapshotTest, versionMismatch) {
+    ASSERT_TRUE(writeSnapshot());
+
+    auto data = readFile();
+    ASSERT_GT(data.size(), VERSION_OFFSET + sizeof(uint32_t));
+    data[VERSION_OFFSET]++;
+    writeFile(data);
+
+    EXPECT_EQ(nullptr, ConfigurationSnapshot::open(m_path, CONFIGURATION_HASH));
+}
+
+/**
+ * Test that a truncated or corrupt snapshot is rejected instead of being read out of bounds.
+ */
+TEST_F(ConfigurationSnapshotTest, corruptFile) {
+    ASSERT_TRUE(writeSnapshot());
+    auto data = readFile();
+
+    // a snapshot cut off in the string table
+    writeFile(data.substr(0, 40));
+    EXPECT_EQ(nullptr, ConfigurationSnapshot::open(m_path, CONFIGURATION_HASH));
+
+    // a snapshot with a different magic number
+    auto corrupt = data;
+    corrupt[0] ^= 0xff;
+    writeFile(corrupt);
+    EXPECT_EQ(nullptr, ConfigurationSnapshot::open(m_path, CONFIGURATION_HASH));
+
+    // a snapshot cut off in the configuration section opens, but its configuration cannot be read
+    writeFile(data.substr(0, data.size() - 4));
+    auto snapshot = ConfigurationSnapshot::open(m_path, CONFIGURATION_HASH);
+    ASSERT_NE(nullptr, snapshot);
+    json configuration;
+    json zonesCapabilityConfig;
+    EXPECT_FALSE(snapshot->loadConfiguration(configuration, zonesCapabilityConfig));
+
+    // an empty file
+    writeFile("");
+    EXPECT_EQ(nullptr, ConfigurationSnapshot::open(m_path, CONFIGURATION_HASH));
+}
+
+/**
+ * Test that a missing snapshot is not opened.
+ */
+TEST_F(ConfigurationSnapshotTest, missingFile) {
+    EXPECT_EQ(nullptr, ConfigurationSnapshot::open(m_path, CONFIGURATION_HASH));
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
@@ -17,6 +17,8 @@
 #define AACE_CAR_CONTROL_CAR_CONTROL_H
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "AACE/Core/PlatformInterface.h"
 
@@ -43,6 +45,38 @@ namespace carControl {
  */
 class CarControl : public aace::core::PlatformInterface {
 public:
+    /**
+     * Describes the new value of a single controller in a @c setControllerValues() batch.
+     */
+    struct ControllerValue {
+        /**
+         * The type of controller the value is set on.
+         */
+        enum class ControllerType {
+            /// Power Controller, identified by @c endpointId. Uses @c turnOn.
+            POWER,
+            /// Toggle Controller, identified by @c endpointId and @c controllerId. Uses @c turnOn.
+            TOGGLE,
+            /// Range Controller, identified by @c endpointId and @c controllerId. Uses @c rangeValue.
+            RANGE,
+            /// Mode Controller, identified by @c endpointId and @c controllerId. Uses @c modeValue.
+            MODE
+        };
+
+        /// The type of controller.
+        ControllerType type = ControllerType::POWER;
+        /// The unique identifier of the endpoint.
+        std::string endpointId;
+        /// The unique identifier of the controller. Empty for a Power Controller.
+        std::string controllerId;
+        /// The new power state of a Power or Toggle Controller.
+        bool turnOn = false;
+        /// The new range setting of a Range Controller.
+        double rangeValue = 0;
+        /// The new mode of a Mode Controller.
+        std::string modeValue;
+    };
+
     /**
      * CarControl constructor.
      */
@@ -175,8 +209,51 @@ public:
         const std::string& endpointId,
         const std::string& controllerId,
         std::string& value);
+
+    /**
+     * Notifies the platform implementation to set the values of several controllers at once, for example when a
+     * single utterance targets every endpoint in a zone. The values are listed in the order in which they should
+     * be applied, and a controller may appear more than once.
+     *
+     * The default implementation applies each value with the matching @c turnPowerControllerOn(),
+     * @c turnPowerControllerOff(), @c turnToggleControllerOn(), @c turnToggleControllerOff(),
+     * @c setRangeControllerValue() or @c setModeControllerValue() method. Override this method to apply the
+     * values in a single operation.
+     *
+     * @param [in] values The controller values to set.
+     * @param [out] results To be set by the implementation to the result of each value, in the same order as
+     * @c values.
+     * @return @c true if every value was set successfully.
+     */
+    virtual bool setControllerValues(const std::vector<ControllerValue>& values, std::vector<bool>& results);
+
+    /**
+     * Returns whether the Engine should combine set commands that arrive together into batches for
+     * @c setControllerValues(). Otherwise each set command is passed to the platform implementation as soon as it
+     * arrives, and the commands for different endpoints are passed concurrently.
+     *
+     * @return @c true if set commands should be batched. The default implementation returns @c false.
+     */
+    virtual bool supportsControllerValueBatches();
 };
 
+/**
+ * Returns the name of a @c CarControl::ControllerValue::ControllerType.
+ */
+inline std::string controllerTypeToString(CarControl::ControllerValue::ControllerType type) {
+    switch (type) {
+        case CarControl::ControllerValue::ControllerType::POWER:
+            return "POWER";
+        case CarControl::ControllerValue::ControllerType::TOGGLE:
+            return "TOGGLE";
+        case CarControl::ControllerValue::ControllerType::RANGE:
+            return "RANGE";
+        case CarControl::ControllerValue::ControllerType::MODE:
+            return "MODE";
+    }
+    return "UNKNOWN";
+}
+
 }  // namespace carControl
 }  // namespace aace
 
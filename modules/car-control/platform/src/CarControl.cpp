@@ -89,5 +89,40 @@ bool CarControl::getModeControllerValue(
     return false;
 }
 
+/**
+ * Batched controller values
+ */
+bool CarControl::setControllerValues(const std::vector<ControllerValue>& values, std::vector<bool>& results) {
+    bool success = true;
+    results.clear();
+    results.reserve(values.size());
+    for (const auto& value : values) {
+        bool result = false;
+        switch (value.type) {
+            case ControllerValue::ControllerType::POWER:
+                result = value.turnOn ? turnPowerControllerOn(value.endpointId)
+                                      : turnPowerControllerOff(value.endpointId);
+                break;
+            case ControllerValue::ControllerType::TOGGLE:
+                result = value.turnOn ? turnToggleControllerOn(value.endpointId, value.controllerId)
+                                      : turnToggleControllerOff(value.endpointId, value.controllerId);
+                break;
+            case ControllerValue::ControllerType::RANGE:
+                result = setRangeControllerValue(value.endpointId, value.controllerId, value.rangeValue);
+                break;
+            case ControllerValue::ControllerType::MODE:
+                result = setModeControllerValue(value.endpointId, value.controllerId, value.modeValue);
+                break;
+        }
+        results.push_back(result);
+        success = success && result;
+    }
+    return success;
+}
+
+bool CarControl::supportsControllerValueBatches() {
+    return false;
+}
+
 }  // namespace carControl
 }  // namespace aace
@@ -16,9 +16,11 @@
 #ifndef AACE_ENGINE_AUDIO_AUDIO_INPUT_ENGINE_IMPL_H
 #define AACE_ENGINE_AUDIO_AUDIO_INPUT_ENGINE_IMPL_H
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <AACE/Audio/AudioInput.h>
 #include "AudioInputChannelInterface.h"
@@ -36,8 +38,14 @@ private:
 public:
     static std::shared_ptr<AudioInputEngineImpl> create(std::shared_ptr<aace::audio::AudioInput> platformAudioInput);
 
+    ~AudioInputEngineImpl();
+
     // AudioInputChannelInterface
     ChannelId start(AudioWriteCallback callback) override;
+
+    // Stops the channel, and waits for the writes in progress, so the callback of the channel is not executed
+    // after stop() returns. When stop() is called from a callback, it does not wait, and only the writes
+    // already in progress on other threads can still execute the callback.
     bool stop(ChannelId id) override;
     void doShutdown() override;
 
@@ -45,16 +53,32 @@ public:
     ssize_t write(const int16_t* data, const size_t size) override;
 
 private:
+    using CallbackList = std::vector<AudioWriteCallback>;
+
     ChannelId getNextChannelId();
 
+    // publishes a new snapshot of the callback map to the audio writer, and waits for the writers
+    // that may still use the previous snapshot before releasing it
+    void updateCallbackList();
+
 private:
     std::shared_ptr<aace::audio::AudioInput> m_platformAudioInput;
     std::unordered_map<ChannelId, AudioWriteCallback> m_callbackMap;
 
     ChannelId m_nextChannelId = 1;
 
-    std::mutex m_mutex;          // to serialize operations of AudioInputChannelInterface
-    std::mutex m_callbackMutex;  // to guard against potential race conditions caused by callback from another thread
+    std::mutex m_mutex;  // to serialize operations of AudioInputChannelInterface
+
+    // Immutable snapshot of the callbacks read by write() without locking. A writer registers itself in
+    // the reader count of the current epoch before loading the snapshot, and updateCallbackList() flips
+    // the epoch and waits for the count of the previous epoch to drop to zero before the previous snapshot
+    // is released, so no callback of a stopped channel is executed after stop() returns.
+    std::atomic<const CallbackList*> m_callbackList;
+    std::atomic<uint32_t> m_epoch;
+    std::atomic<uint32_t> m_readers[2];
+
+    // snapshots released by a callback calling stop() from write(), which cannot wait for itself
+    std::vector<const CallbackList*> m_retiredCallbackLists;
 };
 
 }  // namespace audio
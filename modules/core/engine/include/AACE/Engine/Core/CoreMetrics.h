@@ -33,7 +33,8 @@ public:
         ENGINE_STOP_EXCEPTION,
         ENGINE_START_BEGIN,
         ENGINE_START_END,
-        ENGINE_START_EXCEPTION
+        ENGINE_START_EXCEPTION,
+        ENGINE_SERVICE_LIFECYCLE_END
     };
 };
 
@@ -57,6 +58,9 @@ inline std::ostream& operator<<(std::ostream& stream, const CoreMetrics::Locatio
         case CoreMetrics::Location::ENGINE_START_EXCEPTION:
             stream << "ENGINE_START_EXCEPTION";
             break;
+        case CoreMetrics::Location::ENGINE_SERVICE_LIFECYCLE_END:
+            stream << "ENGINE_SERVICE_LIFECYCLE_END";
+            break;
     }
     return stream;
 }
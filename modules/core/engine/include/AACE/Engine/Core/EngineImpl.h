@@ -16,6 +16,7 @@
 #ifndef AACE_ENGINE_CORE_ENGINE_IMPL_H
 #define AACE_ENGINE_CORE_ENGINE_IMPL_H
 
+#include <functional>
 #include <vector>
 #include <unordered_map>
 
@@ -23,6 +24,7 @@
 #include "AACE/Logger/Logger.h"
 #include "AACE/Engine/PropertyManager/PropertyManagerServiceInterface.h"
 #include "EngineServiceManager.h"
+#include "ServiceDependencyGraph.h"
 #include "ServiceDescription.h"
 
 namespace aace {
@@ -65,10 +67,27 @@ private:
     std::shared_ptr<EngineService> getServiceFromPropertyKey(const std::string& key);
     bool registerProperties();
 
+    /**
+     * Runs a lifecycle phase for each service. A service is only handled after the services it depends on,
+     * and services whose dependencies have been handled run concurrently when more than one lifecycle
+     * thread is configured.
+     *
+     * @param [in] phase The name of the phase, used for logging and metrics
+     * @param [in] handler Handles the phase for a service, and returns @c false if the service failed
+     * @return @c true if the phase succeeded for every service
+     */
+    bool runLifecyclePhase(const std::string& phase, std::function<bool(std::shared_ptr<EngineService>)> handler);
+
 private:
     std::unordered_map<std::string, std::shared_ptr<EngineService>> m_registeredServiceMap;
     std::vector<std::shared_ptr<EngineService>> m_orderedServiceList;
 
+    // dependencies between the services in m_orderedServiceList
+    std::shared_ptr<ServiceDependencyGraph> m_serviceDependencyGraph;
+
+    // number of threads used to run the service lifecycle phases
+    std::size_t m_lifecycleThreads = 1;
+
     // engine flags
     bool m_running = false;
     bool m_initialized = false;
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_CORE_SERVICE_DEPENDENCY_GRAPH_H
+#define AACE_ENGINE_CORE_SERVICE_DEPENDENCY_GRAPH_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "ServiceDescription.h"
+
+namespace aace {
+namespace engine {
+namespace core {
+
+/**
+ * Orders engine services so that each service comes after the services it depends on. Services are
+ * referred to by their position in the start order.
+ */
+class ServiceDependencyGraph {
+private:
+    ServiceDependencyGraph() = default;
+
+public:
+    /**
+     * Creates the dependency graph of a set of services.
+     *
+     * @param [in] descriptions The descriptions of the services, in registration order
+     * @return The graph, or @c nullptr if a dependency is missing, has a lower version than required,
+     * or is part of a dependency cycle
+     */
+    static std::shared_ptr<ServiceDependencyGraph> create(const std::vector<ServiceDescription>& descriptions);
+
+    /**
+     * Returns the index in the registration order of each service, in the order the services are started.
+     */
+    const std::vector<std::size_t>& getStartOrder() const;
+
+    /**
+     * Returns the positions in the start order of the services, in the order the services are stopped
+     * and shut down. A service is stopped before the services it depends on.
+     */
+    std::vector<std::size_t> getStopOrder() const;
+
+    /**
+     * Returns the positions in the start order of the services that depend on the service at @c position.
+     */
+    const std::vector<std::size_t>& getDependents(std::size_t position) const;
+
+    /**
+     * Returns the number of dependencies of the service at each position in the start order.
+     */
+    const std::vector<std::size_t>& getDependencyCounts() const;
+
+private:
+    std::vector<std::size_t> m_startOrder;
+    std::vector<std::vector<std::size_t>> m_dependents;
+    std::vector<std::size_t> m_dependencyCounts;
+};
+
+}  // namespace core
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_CORE_SERVICE_DEPENDENCY_GRAPH_H
@@ -19,9 +19,12 @@
 #include <unordered_set>
 #include <unordered_map>
 #include <vector>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <regex>
+#include <thread>
 
 #include "AACE/Logger/LoggerEngineInterfaces.h"
 #include "Sinks/Sink.h"
@@ -60,8 +63,40 @@ private:
         const char* threadMoniker,
         const char* text);
 
+    // emits a log entry to the sinks and observers on the calling thread
+    void emitSync(
+        const std::string& source,
+        const std::string& tag,
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text);
+
+    // writes a log entry to the buffer of the calling thread
+    void emitAsync(
+        const std::string& source,
+        const std::string& tag,
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text);
+
 public:
-    virtual ~EngineLogger() = default;
+    virtual ~EngineLogger();
+
+    /**
+     * Enables or disables asynchronous logging. When asynchronous logging is enabled, log entries are
+     * written to a buffer owned by the calling thread, and a background thread emits them to the sinks
+     * and observers in batches. Log entries are emitted on the calling thread by default.
+     *
+     * @param [in] async @c true to enable asynchronous logging
+     */
+    void setAsync(bool async);
+
+    /**
+     * Emits the buffered log entries of all threads and flushes the sinks.
+     */
+    void flush();
 
     void addObserver(std::shared_ptr<aace::engine::logger::LogEventObserver> observer);
     void removeObserver(std::shared_ptr<aace::engine::logger::LogEventObserver> observer);
@@ -93,6 +128,26 @@ private:
     // log mutex
     std::mutex m_mutex;
 
+    // asynchronous logging
+    struct LogRecord;
+    struct ThreadBuffer;
+
+    ThreadBuffer* getThreadBuffer();
+    void asyncLoop();
+
+    // emits the buffered log entries of all threads, and returns the number of entries emitted
+    size_t emitBuffered(bool flushSinks);
+    void setSinksBuffered(bool buffered);
+
+    std::atomic<bool> m_async;
+    std::mutex m_bufferMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_threadBuffers;
+    std::mutex m_flushMutex;
+    std::mutex m_asyncMutex;
+    std::condition_variable m_asyncCondition;
+    std::thread m_asyncThread;
+    bool m_asyncRunning;
+
     // singleton
     static std::shared_ptr<EngineLogger> s_instance;
 };
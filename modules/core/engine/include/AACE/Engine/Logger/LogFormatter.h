@@ -35,6 +35,14 @@ public:
         std::chrono::system_clock::time_point time,
         const char* threadMoniker,
         const char* text);
+
+    // appends the formatted log entry to the output string, so the caller can reuse its buffer
+    static void format(
+        std::string& output,
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const char* text);
 };
 
 }  // namespace logger
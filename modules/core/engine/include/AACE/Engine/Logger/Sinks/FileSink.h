@@ -40,6 +40,7 @@ private:
     void log(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
         override;
     void flush() override;
+    void setBuffered(bool buffered) override;
 
     bool rotateLog();
 
@@ -56,6 +57,16 @@ private:
 
     std::string m_filename;
     std::shared_ptr<std::ofstream> m_stream;
+
+    // reusable buffer for formatting log entries
+    std::string m_buffer;
+
+    // each entry is flushed when it is logged unless the sink is buffered by the asynchronous logger
+    bool m_buffered = false;
+
+    // bytes written since the stream was last flushed, and the time of the last flush
+    size_t m_unflushedSize = 0;
+    std::chrono::steady_clock::time_point m_lastFlushTime;
 };
 
 }  // namespace sink
@@ -49,6 +49,7 @@ public:
         const char* threadMoniker,
         const char* text) = 0;
     virtual void flush();
+    virtual void setBuffered(bool buffered);
 
     std::string getId();
 
@@ -17,7 +17,7 @@
 #define AACE_ENGINE_METRICS_METRIC_EVENT_H
 
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace aace {
 namespace engine {
@@ -45,6 +45,23 @@ public:
      */
     enum class MetricIdentityType { UNIQ, NUNI };
 
+    /**
+     * A datapoint captured by the metric event.
+     */
+    struct Datapoint {
+        /// The type of the datapoint.
+        MetricDataType type;
+
+        /// The name describing the datapoint.
+        std::string name;
+
+        /// The value of the datapoint.
+        std::string value;
+
+        /// The number of samples aggregated in the datapoint.
+        int sampleCount;
+    };
+
     /**
      * Constructor.
      *
@@ -118,61 +135,42 @@ public:
      *
      * @param name The name describing the datapoint being captured.
      * @param value The number that represents frequency or count.
+     * @param sampleCount The number of samples aggregated in @c value.
      */
-    void addCounter(const std::string& name, int value);
+    void addCounter(const std::string& name, int value, int sampleCount = 1);
 
     /**
-     * Print the metric event data via logger in a standardized metric format.
+     * Deliver the metric event to the metrics uploader. The event is discarded if no uploader is registered.
      */
     void record();
 
-private:
-    /**
-     * Convert MetricPriority enum to String representation. 
-     *
-     * @param priority The enum to convert.
-     */
-    static std::string priorityToString(MetricPriority priority);
+    /// @return The name that indicates where the event came from / who reported.
+    const std::string& getProgram() const;
 
-    /**
-     * Convert MetricDataType enum to String representation. 
-     *
-     * @param priority The enum to convert.
-     */
-    static std::string dataTypeToString(MetricDataType dataPoint);
+    /// @return The name that provides additional contextual information about how the event happened.
+    const std::string& getSource() const;
 
-    /**
-     * Convert MetricDataType enum to String representation.
-     *
-     * @param type The buffer type enum to convert.
-     */
-    static std::string bufferTypeToString(MetricBufferType type);
+    /// @return The priority of the metric.
+    MetricPriority getPriority() const;
 
-    /**
-     * Convert MetricIdentityType enum to String representation.
-     *
-     * @param type The metric identity type enum to convert.
-     */
-    static std::string identityTypeToString(MetricIdentityType type);
+    /// @return The buffer type of the metric.
+    MetricBufferType getBufferType() const;
 
-    /**
-     * Helper method to append data to the string log that is being built. 
-     *
-     * @param name The name describing the datapoint being captured.
-     * @param value The string that represents the value.
-     * @param type The type of metric (timer, counter, string).
-     * @param sampleCount The frequency or count of the datapoint.
-     */
-    void addDataToLog(std::string name, std::string value, MetricDataType type, std::string sampleCount);
+    /// @return The identity type of the metric.
+    MetricIdentityType getIdentityType() const;
+
+    /// @return The datapoints captured by the metric event.
+    const std::vector<Datapoint>& getDatapoints() const;
 
+private:
     /// Name that indicates where the event came from / who reported.
     std::string m_program;
 
     /// Name that provides additional contextual information about how the event happened.
     std::string m_source;
 
-    /// A string that follows a standard format to capture metric datapoints.
-    std::string m_metricLog;
+    /// The datapoints captured by the metric event.
+    std::vector<Datapoint> m_datapoints;
 
     /// Priority of the metric (High or Normal).
     MetricPriority m_priority;
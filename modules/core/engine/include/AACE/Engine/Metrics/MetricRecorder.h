@@ -0,0 +1,166 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_METRICS_METRIC_RECORDER_H
+#define AACE_ENGINE_METRICS_METRIC_RECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "MetricEvent.h"
+#include "MetricSinkInterface.h"
+
+namespace aace {
+namespace engine {
+namespace metrics {
+
+/**
+ * The MetricRecorder delivers metric events to the registered @c MetricSinkInterface.
+ *
+ * Counters are registered once and identified by a @c CounterId. Incrementing a counter only updates
+ * a slot owned by the calling thread, without locking or allocating. The counters of all threads are
+ * aggregated and delivered to the sink periodically, and when the sink is removed.
+ *
+ * Each thread that increments a counter allocates @c MAX_COUNTERS slots the first time it does so. The
+ * slots are merged into the recorder and freed when the thread exits.
+ */
+class MetricRecorder {
+public:
+    using CounterId = std::size_t;
+
+    /// Identifies a counter that could not be registered.
+    static const CounterId INVALID_COUNTER;
+
+    /// The maximum number of counters that can be registered.
+    static const std::size_t MAX_COUNTERS = 512;
+
+    static std::shared_ptr<MetricRecorder> getInstance();
+
+    ~MetricRecorder();
+
+    /**
+     * Sets the sink that receives the recorded metrics. Aggregated counters are flushed to the
+     * previous sink before it is replaced.
+     *
+     * @param sink The metric sink, or @c nullptr to stop recording metrics.
+     */
+    void setSink(std::shared_ptr<MetricSinkInterface> sink);
+
+    /// @return @c true if a sink is registered to receive metrics.
+    bool isEnabled() const;
+
+    /**
+     * Sets the interval at which aggregated counters are delivered to the sink.
+     */
+    void setFlushInterval(std::chrono::milliseconds interval);
+
+    /**
+     * Delivers a metric event to the sink immediately.
+     */
+    void record(const MetricEvent& metricEvent);
+
+    /**
+     * Registers a counter, or gets the id of a counter that was already registered.
+     *
+     * @param program The name that indicates where the event came from / who reported.
+     * @param source The name that provides additional contextual information about how the event happened.
+     * @param name The name of the counter.
+     * @param bufferType Indicates if the aggregated metric should be buffered.
+     * @return The counter id, or @c INVALID_COUNTER if no more counters can be registered.
+     */
+    CounterId registerCounter(
+        const std::string& program,
+        const std::string& source,
+        const std::string& name,
+        MetricEvent::MetricBufferType bufferType = MetricEvent::MetricBufferType::NB);
+
+    /**
+     * Adds a value to a registered counter.
+     */
+    void incrementCounter(CounterId id, int value = 1);
+
+    /**
+     * Delivers the aggregated counters of all threads to the sink.
+     */
+    void flush();
+
+private:
+    MetricRecorder();
+
+    struct CounterSlot {
+        std::atomic<int64_t> value;
+        std::atomic<int64_t> samples;
+    };
+
+    struct ThreadCounters {
+        ThreadCounters();
+        CounterSlot slots[MAX_COUNTERS];
+    };
+
+    // owns the counter slots of a thread, and releases them when the thread exits
+    struct ThreadCountersOwner {
+        ~ThreadCountersOwner();
+        std::shared_ptr<MetricRecorder> recorder;
+        std::unique_ptr<ThreadCounters> counters;
+    };
+
+    struct Counter {
+        std::string program;
+        std::string source;
+        std::string name;
+        MetricEvent::MetricBufferType bufferType;
+    };
+
+    ThreadCounters* getThreadCounters();
+    void releaseThreadCounters(ThreadCounters* threadCounters);
+    std::shared_ptr<MetricSinkInterface> getSink();
+    void flushLoop();
+
+private:
+    // registered counters and the counter slots of each thread
+    std::mutex m_counterMutex;
+    std::vector<Counter> m_counters;
+    std::unordered_map<std::string, CounterId> m_counterIds;
+    std::vector<ThreadCounters*> m_threadCounters;
+    std::vector<int64_t> m_releasedValues;
+    std::vector<int64_t> m_releasedSamples;
+    std::atomic<std::size_t> m_counterCount;
+
+    // the sink and the flush thread
+    std::mutex m_setSinkMutex;
+    std::mutex m_sinkMutex;
+    std::shared_ptr<MetricSinkInterface> m_sink;
+    std::atomic<bool> m_enabled;
+
+    std::mutex m_flushMutex;
+    std::condition_variable m_flushCondition;
+    std::chrono::milliseconds m_flushInterval;
+    std::thread m_flushThread;
+    bool m_flushThreadRunning;
+};
+
+}  // namespace metrics
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_METRICS_METRIC_RECORDER_H
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_METRICS_METRIC_SINK_INTERFACE_H
+#define AACE_ENGINE_METRICS_METRIC_SINK_INTERFACE_H
+
+#include "MetricEvent.h"
+
+namespace aace {
+namespace engine {
+namespace metrics {
+
+/**
+ * Receives the metric events recorded by the @c MetricRecorder.
+ */
+class MetricSinkInterface {
+public:
+    virtual ~MetricSinkInterface() = default;
+
+    /**
+     * Records a metric event. This method may be called from any thread.
+     *
+     * @param metricEvent The metric event to record.
+     */
+    virtual void record(const MetricEvent& metricEvent) = 0;
+};
+
+}  // namespace metrics
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_METRICS_METRIC_SINK_INTERFACE_H
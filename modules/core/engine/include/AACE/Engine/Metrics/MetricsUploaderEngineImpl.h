@@ -16,42 +16,31 @@
 #ifndef AACE_ENGINE_METRICS_METRICS_UPLOADER_ENGINE_IMPL_H
 #define AACE_ENGINE_METRICS_METRICS_UPLOADER_ENGINE_IMPL_H
 
-#include "AACE/Engine/Logger/Sinks/Sink.h"
-#include "AACE/Engine/Logger/LoggerServiceInterface.h"
+#include "AACE/Engine/Metrics/MetricSinkInterface.h"
 #include "AACE/Metrics/MetricsUploader.h"
 
 namespace aace {
 namespace engine {
 namespace metrics {
 
-class MetricsUploaderEngineImpl : public aace::engine::logger::sink::Sink {
+class MetricsUploaderEngineImpl : public MetricSinkInterface {
 public:
-    static const std::string METRIC_RECORD_KEYWORD;
     static const std::string PRIORITY_KEY;
     static const std::string PROGRAM_KEY;
     static const std::string SOURCE_KEY;
-    static const std::string TIMER_KEY;
-    static const std::string STRING_KEY;
-    static const std::string COUNTER_KEY;
 
     static const std::string NORMAL_PRIORITY;
     static const std::string HIGH_PRIORITY;
 
-    static const std::string UNIQUE;
-    static const std::string BUFFER;
-
     static std::shared_ptr<MetricsUploaderEngineImpl> create(
         std::shared_ptr<aace::metrics::MetricsUploader> platformMetricsUploaderInterface);
 
+    // aace::engine::metrics::MetricSinkInterface
+    void record(const MetricEvent& metricEvent) override;
+
 private:
     MetricsUploaderEngineImpl(std::shared_ptr<aace::metrics::MetricsUploader> platformMetricsUploaderInterface);
 
-    bool initialize();
-
-    // aace::engine::logger::sink::Sink
-    void log(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
-        override;
-
 private:
     std::shared_ptr<aace::metrics::MetricsUploader> m_platformMetricsUploaderInterface;
 };
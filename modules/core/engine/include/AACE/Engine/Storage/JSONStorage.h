@@ -20,6 +20,8 @@
 #include <memory>
 #include <mutex>
 #include <condition_variable>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <rapidjson/document.h>
@@ -30,6 +32,13 @@ namespace aace {
 namespace engine {
 namespace storage {
 
+/**
+ * JSONStorage keeps the storage document in memory, and persists it as a snapshot file and an
+ * append-only journal. Changes are appended to the journal in batches by a writer thread, and the
+ * journal is compacted into a new snapshot when it grows larger than the snapshot. The snapshot is
+ * written to a temporary file and renamed, so a crash never leaves a partially written snapshot. A
+ * batch that fails to be written is truncated from the journal, so the batches after it can be replayed.
+ */
 class JSONStorage : public LocalStorageInterface {
 public:
     static std::shared_ptr<JSONStorage> create(const std::string& path);
@@ -37,10 +46,29 @@ public:
     virtual ~JSONStorage();
 
 private:
+    // a change to the storage document, as it is written to the journal
+    struct Record {
+        enum class Operation { PUT, REMOVE_KEY, REMOVE_TABLE };
+
+        Operation operation;
+        std::string table;
+        std::string key;
+        std::string value;
+    };
+
     JSONStorage(const std::string& path);
 
     bool initialize();
-    bool write();
+
+    bool load(rapidjson::Document& document);
+    static void apply(rapidjson::Document& document, const Record& record);
+    void addRecordLocked(Record record);
+
+    bool flush();
+    bool compact();
+    bool appendJournal(const std::vector<Record>& records);
+    bool writeSnapshot(const char* data, size_t size);
+    void writerLoop();
 
 public:
     bool put(const std::string& table, const std::string& key, const std::string& value) override;
@@ -58,12 +86,34 @@ public:
 
 private:
     std::string m_path;
+    std::string m_journalPath;
     rapidjson::Document m_document;
     bool m_transactionInProgress = false;
-    bool m_dirty = false;
 
     std::mutex m_mutex;
     std::condition_variable m_notifyTransactionComplete;
+
+    // guards the document and the records that have not been written to the journal
+    std::recursive_mutex m_documentMutex;
+    std::vector<Record> m_pendingRecords;
+    std::unordered_map<std::string, size_t> m_pendingPuts;
+    std::vector<Record> m_transactionRecords;
+
+    // serializes writes to the journal and the snapshot, acquired before m_documentMutex
+    std::mutex m_journalMutex;
+    int m_journalFd = -1;
+    size_t m_journalSize = 0;
+    size_t m_snapshotSize = 0;
+    bool m_compactionRequired = false;
+
+    // the journal ends with a partially written batch that could not be truncated, so no batches are
+    // appended until it is compacted
+    bool m_journalDamaged = false;
+
+    // batches the pending records, and compacts the journal
+    bool m_shutdown = false;
+    std::condition_variable_any m_writerCondition;
+    std::thread m_writerThread;
 };
 
 }  // namespace storage
@@ -16,8 +16,15 @@
 #ifndef AACE_ENGINE_STORAGE_SQLITE_STORAGE_H
 #define AACE_ENGINE_STORAGE_SQLITE_STORAGE_H
 
+#include <chrono>
+#include <condition_variable>
+#include <list>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <functional>
 
@@ -31,20 +38,82 @@ namespace storage {
 
 class SQLiteStorage : public LocalStorageInterface {
 public:
-    static std::shared_ptr<SQLiteStorage> create(const std::string& path);
+    /**
+     * Creates the SQLite local storage.
+     *
+     * @param [in] path The path of the database file, which is created if it does not exist
+     * @param [in] readCache @c true to keep the values read from the database in memory, so
+     * repeated reads of the same key do not query the database
+     * @param [in] maxReadCacheEntries The maximum number of values kept in the read cache. The least
+     * recently used values are evicted first.
+     *
+     * Writes made outside of an explicit transaction are batched, and committed after 64 writes,
+     * 100 milliseconds after the first write of the batch, or when @c begin() is called. A write
+     * returns before it is committed, so the writes made in the last 100 milliseconds before a
+     * crash or power loss can be lost. Use @c begin() and @c commit() to make writes durable when
+     * they return.
+     *
+     * If committing the batched writes fails, they are rolled back, and the next call to @c put(),
+     * @c removeKey(), @c removeTable() or @c begin() returns @c false without making changes, so the
+     * caller learns that recent writes were lost. A write that fills the batch returns @c false if
+     * the batch it completes cannot be committed.
+     */
+    static std::shared_ptr<SQLiteStorage> create(
+        const std::string& path,
+        bool readCache = false,
+        size_t maxReadCacheEntries = 1024);
 
     virtual ~SQLiteStorage();
 
 private:
-    SQLiteStorage(const std::string& path);
+    // finalizes a prepared statement when it is released
+    struct StatementDeleter {
+        void operator()(sqlite3_stmt* stmt) const {
+            sqlite3_finalize(stmt);
+        }
+    };
+    using Statement = std::unique_ptr<sqlite3_stmt, StatementDeleter>;
+
+    // prepared statements for the operations on a table
+    struct TableStatements {
+        Statement select;
+        Statement upsert;
+        Statement remove;
+        Statement keys;
+        Statement list;
+    };
+
+    // a value in the read cache
+    struct CacheEntry {
+        std::string table;
+        std::string key;
+        std::string value;
+    };
+    using CacheList = std::list<CacheEntry>;
+
+    SQLiteStorage(const std::string& path, bool readCache, size_t maxReadCacheEntries);
 
     bool initialize();
 
-    std::string createStatement(const char* stmt, ...);
+    Statement prepare(const std::string& sql);
+    TableStatements* getTableStatementsLocked(const std::string& table);
+
+    bool checkTableLocked(const std::string& table, bool create = false);
+    bool getLocked(const std::string& table, const std::string& key, std::string& value);
+    bool query(const std::string& sql);
+
+    bool getCachedLocked(const std::string& table, const std::string& key, std::string& value);
+    void cacheLocked(const std::string& table, const std::string& key, const std::string& value);
+    void uncacheLocked(const std::string& table, const std::string& key);
+    void uncacheTableLocked(const std::string& table);
+    void clearCacheLocked();
 
-    bool checkTable(const std::string& table, bool create = false);
-    bool checkKey(const std::string& table, const std::string& key);
-    bool query(const std::string& sql, int (*cb)(void*, int, char**, char**) = nullptr, void* data = nullptr);
+    // writes made outside of an explicit transaction are batched in an implicit transaction
+    void beginWriteLocked();
+    void endWriteLocked();
+    void commitImplicitTransactionLocked();
+    bool checkImplicitCommitLocked();
+    void flushLoop();
 
 public:
     bool put(const std::string& table, const std::string& key, const std::string& value) override;
@@ -62,8 +131,32 @@ public:
 
 private:
     std::string m_path;
-    sqlite3* m_db;
+    sqlite3* m_db = nullptr;
     bool m_transactionInProgress = false;
+
+    // serializes access to the database connection and the caches
+    std::mutex m_mutex;
+
+    // prepared statements, and the tables known to exist
+    Statement m_checkTableStatement;
+    std::unordered_map<std::string, TableStatements> m_tableStatements;
+    std::unordered_set<std::string> m_tables;
+
+    // values read from or written to the database, if the read cache is enabled, ordered from the
+    // most to the least recently used
+    bool m_readCacheEnabled;
+    size_t m_maxReadCacheEntries;
+    CacheList m_readCacheEntries;
+    std::unordered_map<std::string, std::unordered_map<std::string, CacheList::iterator>> m_readCache;
+
+    // implicit transaction state, committed by the flush thread
+    bool m_implicitTransaction = false;
+    int m_implicitTransactionWrites = 0;
+    std::chrono::steady_clock::time_point m_implicitTransactionStart;
+    bool m_implicitCommitFailed = false;
+    bool m_shutdown = false;
+    std::condition_variable m_flushCondition;
+    std::thread m_flushThread;
 };
 
 }  // namespace storage
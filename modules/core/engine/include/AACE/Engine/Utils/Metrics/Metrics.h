@@ -19,9 +19,11 @@
 #include <string>
 #include <sstream>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <AACE/Engine/Metrics/MetricEvent.h>
+#include <AACE/Engine/Metrics/MetricRecorder.h>
 
 namespace aace {
 namespace engine {
@@ -217,6 +219,50 @@ void emitBufferedMetrics(
     const std::vector<std::pair<std::string, std::string>>& stringDatapoints = {},
     const std::vector<std::pair<std::string, double>>& timerDatapoints = {});
 
+/**
+ * Registers a counter metric, so it can be emitted in hot paths without looking up the counter.
+ * Counters are aggregated and delivered to the metrics uploader periodically.
+ *
+ * @return The counter id, or @c MetricRecorder::INVALID_COUNTER if the counter could not be registered.
+ */
+MetricRecorder::CounterId registerCounterMetrics(
+    const std::string& metricSuffix,
+    const std::string& methodName,
+    const std::string& key,
+    MetricEvent::MetricBufferType bufferType = MetricEvent::MetricBufferType::NB);
+
+/**
+ * Emits a counter metric registered with @c registerCounterMetrics().
+ */
+void emitCounterMetrics(MetricRecorder::CounterId counter, const int value = 1);
+
+/**
+ * A counter metric that is registered the first time it is emitted, so it can be declared at file scope
+ * and emitted in hot paths without looking up the counter.
+ */
+class CounterMetric {
+public:
+    CounterMetric(
+        const std::string& metricSuffix,
+        const std::string& methodName,
+        const std::string& key,
+        MetricEvent::MetricBufferType bufferType = MetricEvent::MetricBufferType::NB);
+
+    /**
+     * Emits the counter metric.
+     */
+    void emit(const int value = 1);
+
+private:
+    const std::string m_metricSuffix;
+    const std::string m_methodName;
+    const std::string m_key;
+    const MetricEvent::MetricBufferType m_bufferType;
+
+    std::once_flag m_registered;
+    MetricRecorder::CounterId m_counter;
+};
+
 /**
  * Get the current time in  milliseconds
  */
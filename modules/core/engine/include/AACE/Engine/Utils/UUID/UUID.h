@@ -16,6 +16,9 @@
 #ifndef AACE_ENGINE_UTILS_UUID_H_
 #define AACE_ENGINE_UTILS_UUID_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 
 namespace aace {
@@ -34,11 +37,104 @@ namespace uuid {
  */
 const std::string generateUUID();
 
+/**
+ * Compares two UUID strings, ignoring the case of the hexadecimal digits.
+ *
+ * @return @c true if the UUID strings are equal.
+ */
 bool compare(const std::string& uuid1, const std::string& uuid2);
 
+/**
+ * A 128-bit UUID value that can be compared and hashed without formatting it as a string.
+ * A default constructed @c Uuid is the nil UUID.
+ */
+class Uuid {
+public:
+    /// The length of the string representation of a UUID.
+    static constexpr size_t STRING_LENGTH = 36;
+
+    Uuid() = default;
+
+    /**
+     * Generates a variant 1, version 4 UUID. The UUID is generated with a random number generator
+     * owned by the calling thread, so no locking is required.
+     *
+     * @return The new UUID.
+     */
+    static Uuid generate();
+
+    /**
+     * Parses a UUID string of the format xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx. Upper and lower
+     * case hexadecimal digits are accepted.
+     *
+     * @param [in] text The UUID string.
+     * @param [out] uuid The parsed UUID. It is not modified if the string is not a valid UUID.
+     * @return @c true if the string was parsed successfully.
+     */
+    static bool fromString(const std::string& text, Uuid& uuid);
+
+    /**
+     * Formats the UUID as a string of lower case hexadecimal digits.
+     *
+     * @return The UUID string.
+     */
+    std::string toString() const;
+
+    /**
+     * Writes the UUID string into @c buffer without allocating. The buffer is not null terminated.
+     *
+     * @param [out] buffer The buffer to write to, which must be at least @c STRING_LENGTH characters.
+     */
+    void toString(char* buffer) const;
+
+    /// Returns @c true if this is the nil UUID.
+    bool isNil() const {
+        return m_high == 0 && m_low == 0;
+    }
+
+    /// Returns a hash of the UUID.
+    size_t hash() const {
+        return std::hash<uint64_t>()(m_high ^ (m_low * 0x9e3779b97f4a7c15ULL));
+    }
+
+    bool operator==(const Uuid& other) const {
+        return m_high == other.m_high && m_low == other.m_low;
+    }
+
+    bool operator!=(const Uuid& other) const {
+        return !(*this == other);
+    }
+
+    bool operator<(const Uuid& other) const {
+        return m_high < other.m_high || (m_high == other.m_high && m_low < other.m_low);
+    }
+
+private:
+    Uuid(uint64_t high, uint64_t low) : m_high(high), m_low(low) {
+    }
+
+private:
+    /// The most significant 64 bits of the UUID.
+    uint64_t m_high = 0;
+
+    /// The least significant 64 bits of the UUID.
+    uint64_t m_low = 0;
+};
+
 }  // namespace uuid
 }  // namespace utils
 }  // namespace engine
 }  // namespace aace
 
+namespace std {
+
+template <>
+struct hash<aace::engine::utils::uuid::Uuid> {
+    size_t operator()(const aace::engine::utils::uuid::Uuid& uuid) const {
+        return uuid.hash();
+    }
+};
+
+}  // namespace std
+
 #endif  // AACE_ENGINE_UTILS_UUID_H_
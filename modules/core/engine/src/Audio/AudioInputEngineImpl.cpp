@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <thread>
+
 #include <AACE/Engine/Audio/AudioInputEngineImpl.h>
 #include <AACE/Engine/Core/EngineMacros.h>
 #include <AACE/Engine/Utils/Metrics/Metrics.h>
@@ -34,8 +36,25 @@ namespace audio {
 
 using namespace aace::engine::utils::metrics;
 
+/// The number of nested writes on the calling thread
+static thread_local int s_writeDepth = 0;
+
+/// Counter metrics for AudioInput Platform APIs
+static CounterMetric s_startAudioInputCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "start", METRIC_AUDIO_INPUT_START_AUDIO_INPUT);
+static CounterMetric s_stopAudioInputCounter(METRIC_PROGRAM_NAME_SUFFIX, "stop", METRIC_AUDIO_INPUT_STOP_AUDIO_INPUT);
+
 AudioInputEngineImpl::AudioInputEngineImpl(std::shared_ptr<aace::audio::AudioInput> platformAudioInput) :
-        m_platformAudioInput(platformAudioInput) {
+        m_platformAudioInput(platformAudioInput), m_callbackList(new CallbackList()), m_epoch(0) {
+    m_readers[0] = 0;
+    m_readers[1] = 0;
+}
+
+AudioInputEngineImpl::~AudioInputEngineImpl() {
+    delete m_callbackList.load();
+    for (auto next : m_retiredCallbackLists) {
+        delete next;
+    }
 }
 
 std::shared_ptr<AudioInputEngineImpl> AudioInputEngineImpl::create(
@@ -59,19 +78,44 @@ AudioInputChannelInterface::ChannelId AudioInputEngineImpl::getNextChannelId() {
     return m_nextChannelId++;
 }
 
+void AudioInputEngineImpl::updateCallbackList() {
+    auto callbackList = new CallbackList();
+    for (auto& next : m_callbackMap) {
+        callbackList->push_back(next.second);
+    }
+
+    auto previous = m_callbackList.exchange(callbackList);
+
+    // a callback stopping its channel from inside write() cannot wait for itself, so the previous
+    // snapshot is released by the next update that is made outside of a write
+    if (s_writeDepth > 0) {
+        m_retiredCallbackLists.push_back(previous);
+        return;
+    }
+
+    // new writers register in the next epoch, so only the writers that may have loaded the
+    // previous snapshot are waited for
+    auto epoch = m_epoch.fetch_add(1);
+    while (m_readers[epoch & 1].load() != 0) {
+        std::this_thread::yield();
+    }
+
+    delete previous;
+    for (auto next : m_retiredCallbackLists) {
+        delete next;
+    }
+    m_retiredCallbackLists.clear();
+}
+
 // AudioInputChannelInterface
 AudioInputChannelInterface::ChannelId AudioInputEngineImpl::start(AudioWriteCallback callback) {
     try {
         std::lock_guard<std::mutex> clientLock(m_mutex);
-        std::unique_lock<std::mutex> callbackLock(m_callbackMutex);
 
         // call the platform startAudioInput() if there are no observers
         if (m_callbackMap.empty()) {
-            // Release the lock temporarily so that audio data callback can acquire it and prevent deadlock
-            callbackLock.unlock();
-            emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "start", {METRIC_AUDIO_INPUT_START_AUDIO_INPUT});
+            s_startAudioInputCounter.emit();
             ThrowIfNot(m_platformAudioInput->startAudioInput(), "startPlatformAudioInputFailed");
-            callbackLock.lock();
         }
 
         // get the next channel id
@@ -79,6 +123,7 @@ AudioInputChannelInterface::ChannelId AudioInputEngineImpl::start(AudioWriteCall
 
         // add the callback to the channel callback map
         m_callbackMap[id] = callback;
+        updateCallbackList();
 
         return id;
     } catch (std::exception& ex) {
@@ -90,7 +135,6 @@ AudioInputChannelInterface::ChannelId AudioInputEngineImpl::start(AudioWriteCall
 bool AudioInputEngineImpl::stop(ChannelId id) {
     try {
         std::lock_guard<std::mutex> clientLock(m_mutex);
-        std::unique_lock<std::mutex> callbackLock(m_callbackMutex);
 
         auto it = m_callbackMap.find(id);
         ThrowIf(it == m_callbackMap.end(), "invalidChannelId");
@@ -98,16 +142,14 @@ bool AudioInputEngineImpl::stop(ChannelId id) {
         // call the platform stopAudioInput() if the channel is the only channel
         // requesting audio from the audio provider
         if (m_callbackMap.size() == 1) {
-            // Release the lock temporarily so that audio data callback can acquire it and prevent deadlock
-            callbackLock.unlock();
-            emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "stop", {METRIC_AUDIO_INPUT_STOP_AUDIO_INPUT});
+            s_stopAudioInputCounter.emit();
             ThrowIfNot(m_platformAudioInput->stopAudioInput(), "stopPlatformAudioInputFailed");
-            callbackLock.lock();
         }
 
         // we successfully stopped the platform audio, so we need to remove
         // the audio channel from the channel list
         m_callbackMap.erase(it);
+        updateCallbackList();
 
         return true;
     } catch (std::exception& ex) {
@@ -118,19 +160,37 @@ bool AudioInputEngineImpl::stop(ChannelId id) {
 
 void AudioInputEngineImpl::doShutdown() {
     std::lock_guard<std::mutex> clientLock(m_mutex);
-    std::lock_guard<std::mutex> callbackLock(m_callbackMutex);
     m_platformAudioInput->setEngineInterface(nullptr);
 }
 
 // AudioInputChannelEngineInterface
 ssize_t AudioInputEngineImpl::write(const int16_t* data, const size_t size) {
     try {
-        std::lock_guard<std::mutex> callbackLock(m_callbackMutex);
+        // register the writer in the current epoch before loading the snapshot, and register again
+        // if the epoch was flipped in between, since the update may not have waited for this writer
+        uint32_t epoch;
+        while (true) {
+            epoch = m_epoch.load();
+            m_readers[epoch & 1]++;
+            if (m_epoch.load() == epoch) {
+                break;
+            }
+            m_readers[epoch & 1]--;
+        }
 
-        // execute the register callbacks
-        for (auto& next : m_callbackMap) {
-            next.second(data, size);
+        s_writeDepth++;
+        try {
+            // execute the register callbacks
+            for (auto& next : *m_callbackList.load()) {
+                next(data, size);
+            }
+        } catch (...) {
+            s_writeDepth--;
+            m_readers[epoch & 1]--;
+            throw;
         }
+        s_writeDepth--;
+        m_readers[epoch & 1]--;
 
         // always return a successfull write even if some of the callbacks failed to write all
         // of the data being provided... the audio input channel should handle retries or buffering
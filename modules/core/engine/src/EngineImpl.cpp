@@ -13,8 +13,13 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <chrono>
 #include <unordered_map>
-#include <forward_list>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
 #ifndef NO_SIGPIPE
 #include <csignal>
 #endif
@@ -39,6 +44,9 @@ namespace core {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.core.EngineImpl");
 
+// Configuration key for the engine.
+static const char* ENGINE_CONFIG_KEY = "aace.engine";
+
 std::shared_ptr<EngineImpl> EngineImpl::create() {
     try {
         auto engine = std::shared_ptr<EngineImpl>(new EngineImpl());
@@ -117,8 +125,10 @@ bool EngineImpl::shutdown() {
 
         AACE_DEBUG(LX(TAG).m("EngineShutdown"));
 
-        // iterate through registered engine services and call shutdown() for each module
-        for (auto next : m_orderedServiceList) {
+        // iterate through registered engine services and call shutdown() for each module, in the same
+        // order the services are stopped
+        for (auto position : m_serviceDependencyGraph->getStopOrder()) {
+            auto next = m_orderedServiceList[position];
             AACE_DEBUG(LX(TAG).m(next->getDescription().getType()));
 
             // if shutting down the service failed throw an error but continue with
@@ -133,6 +143,7 @@ bool EngineImpl::shutdown() {
         // reset the engine state
         m_orderedServiceList.clear();
         m_registeredServiceMap.clear();
+        m_serviceDependencyGraph.reset();
         m_initialized = false;
         m_configured = false;
 
@@ -186,25 +197,41 @@ bool EngineImpl::configure(std::vector<std::shared_ptr<aace::core::config::Engin
                 "mergeConfigurationFailed");
         }
 
-        // iterate through registered engine services and call configure() for each module
+        // get the number of threads used to run the service lifecycle phases
+        auto engineConfig = root.FindMember(ENGINE_CONFIG_KEY);
+        if (engineConfig != root.end() && engineConfig->value.IsObject()) {
+            auto lifecycleThreads = engineConfig->value.FindMember("lifecycleThreads");
+            if (lifecycleThreads != engineConfig->value.MemberEnd() && lifecycleThreads->value.IsUint()) {
+                m_lifecycleThreads = std::max(lifecycleThreads->value.GetUint(), 1u);
+            }
+        }
+
+        // get the configuration stream for each service
+        std::unordered_map<std::string, std::shared_ptr<std::istream>> serviceConfigurationMap;
         for (auto nextService : m_orderedServiceList) {
-            auto config = root.FindMember(nextService->getDescription().getType().c_str());
+            auto type = nextService->getDescription().getType();
+            auto config = root.FindMember(type.c_str());
 
             if (config != root.end()) {
                 rapidjson::Document subDocument;
 
                 subDocument.CopyFrom(config->value, subDocument.GetAllocator());
 
-                ThrowIfNot(
-                    nextService->handleConfigureEngineEvent(aace::engine::utils::json::toStream(subDocument)),
-                    "Service failed to configure: " + nextService->getDescription().getType());
-            } else {
-                ThrowIfNot(
-                    nextService->handleConfigureEngineEvent(nullptr),
-                    "Service failed to configure: " + nextService->getDescription().getType());
+                serviceConfigurationMap[type] = aace::engine::utils::json::toStream(subDocument);
             }
         }
 
+        // iterate through registered engine services and call configure() for each module
+        ThrowIfNot(
+            runLifecyclePhase(
+                "configure",
+                [&serviceConfigurationMap](std::shared_ptr<EngineService> service) {
+                    auto it = serviceConfigurationMap.find(service->getDescription().getType());
+                    return service->handleConfigureEngineEvent(
+                        it != serviceConfigurationMap.end() ? it->second : nullptr);
+                }),
+            "serviceConfigureFailed");
+
         m_configured = true;
 
         // iterate through registered engine modules and call handlePreRegisterEngineEvent() for each module
@@ -221,89 +248,21 @@ bool EngineImpl::configure(std::vector<std::shared_ptr<aace::core::config::Engin
 
 bool EngineImpl::checkServices() {
     try {
-        std::unordered_map<std::string, std::shared_ptr<ServiceFactory>> registeredServiceFactoryMap;
-        std::vector<std::shared_ptr<ServiceFactory>> orderedServiceFactoryList;
-        std::forward_list<std::shared_ptr<ServiceFactory>> unresolvedDependencyList;
+        std::vector<std::shared_ptr<ServiceFactory>> serviceFactoryList;
+        std::vector<ServiceDescription> descriptions;
 
         for (auto it = EngineServiceManager::registryBegin(); it != EngineServiceManager::registryEnd(); it++) {
-            bool success = true;
-            auto serviceFactory = it->second;
-            auto desc = serviceFactory->getDescription();
-
-            for (auto next : desc.getDependencies()) {
-                auto it = registeredServiceFactoryMap.find(next.getType());
-
-                if (it != registeredServiceFactoryMap.end()) {
-                    auto serviceFactory = it->second;
-                    auto desc = serviceFactory->getDescription();
-                    auto v1 = desc.getVersion();
-                    auto v2 = next.getVersion();
-
-                    ThrowIf(v1 < v2, "invalidDependencyVersion");
-                } else {
-                    success = false;
-                    break;
-                }
-            }
-
-            if (success) {
-                orderedServiceFactoryList.push_back(serviceFactory);
-
-                // add the service to the registered service map so we can resolve dependencies
-                registeredServiceFactoryMap[desc.getType()] = serviceFactory;
-            } else {
-                unresolvedDependencyList.push_front(serviceFactory);
-            }
+            serviceFactoryList.push_back(it->second);
+            descriptions.push_back(it->second->getDescription());
         }
 
-        while (unresolvedDependencyList.empty() == false) {
-            bool updated = false;
-            auto it = unresolvedDependencyList.begin();
-            auto prev = unresolvedDependencyList.before_begin();
-
-            while (it != unresolvedDependencyList.end()) {
-                bool success = true;
-                auto serviceFactory = *it;
-                auto desc = serviceFactory->getDescription();
-
-                for (auto next : desc.getDependencies()) {
-                    auto it = registeredServiceFactoryMap.find(next.getType());
-
-                    if (it != registeredServiceFactoryMap.end()) {
-                        auto serviceFactory = it->second;
-                        auto desc = serviceFactory->getDescription();
-                        auto v1 = desc.getVersion();
-                        auto v2 = next.getVersion();
-
-                        ThrowIf(v1 < v2, "invalidDependencyVersion");
-                    } else {
-                        success = false;
-                        break;
-                    }
-                }
-
-                if (success) {
-                    orderedServiceFactoryList.push_back(serviceFactory);
-
-                    // add the service to the registered service map so we can resolve dependencies
-                    registeredServiceFactoryMap[desc.getType()] = serviceFactory;
-
-                    // remove the item from the list
-                    it = unresolvedDependencyList.erase_after(prev);
-
-                    updated = true;
-                } else {
-                    prev = it++;
-                }
-            }
-
-            // fail if we were not able to resolve any of the remaining dependencies
-            ThrowIfNot(updated, "failedToResolveServiceDependencies");
-        }
+        // order the services so that each service comes after its dependencies
+        m_serviceDependencyGraph = ServiceDependencyGraph::create(descriptions);
+        ThrowIfNull(m_serviceDependencyGraph, "failedToResolveServiceDependencies");
 
         // instantiate the engine service objects
-        for (auto next : orderedServiceFactoryList) {
-            auto service = next->newInstance();
+        for (auto index : m_serviceDependencyGraph->getStartOrder()) {
+            auto service = serviceFactoryList[index]->newInstance();
             ThrowIfNull(service, "createNewServiceInstanceFailed");
 
             m_orderedServiceList.push_back(service);
@@ -322,6 +281,7 @@ bool EngineImpl::checkServices() {
         AACE_ERROR(LX(TAG).d("reason", ex.what()));
         m_orderedServiceList.clear();
         m_registeredServiceMap.clear();
+        m_serviceDependencyGraph.reset();
         return false;
     }
 }
@@ -338,23 +298,27 @@ bool EngineImpl::start() {
         // postRegister and setup are called for each service the first time the engine is started
         if (m_setup == false) {
             // iterate through registered engine modules and call handlePostRegisterEngineEvent() for each module
-            for (auto next : m_orderedServiceList) {
-                ThrowIfNot(next->handlePostRegisterEngineEvent(), "handlePostRegisterEngineEvent");
-            }
+            ThrowIfNot(
+                runLifecyclePhase(
+                    "postRegister",
+                    [](std::shared_ptr<EngineService> service) { return service->handlePostRegisterEngineEvent(); }),
+                "handlePostRegisterEngineEvent");
 
             // iterate through registered engine modules and call handleSetupEngineEvent() for each module
-            for (auto next : m_orderedServiceList) {
-                ThrowIfNot(next->handleSetupEngineEvent(), "handleSetupEngineEventFailed");
-            }
+            ThrowIfNot(
+                runLifecyclePhase(
+                    "setup", [](std::shared_ptr<EngineService> service) { return service->handleSetupEngineEvent(); }),
+                "handleSetupEngineEventFailed");
 
             // set the engine setup flag to true
             m_setup = true;
         }
 
         // iterate through registered engine modules and call handleStartEngineEvent() for each module
-        for (auto next : m_orderedServiceList) {
-            ThrowIfNot(next->handleStartEngineEvent(), "handleStartEngineEventFailed");
-        }
+        ThrowIfNot(
+            runLifecyclePhase(
+                "start", [](std::shared_ptr<EngineService> service) { return service->handleStartEngineEvent(); }),
+            "handleStartEngineEventFailed");
 
         // set the engine running flag to true
         m_running = true;
@@ -378,9 +342,10 @@ bool EngineImpl::stop() {
             return true;
         }
 
-        // iterate through registered engine modules and call stop() for each module
-        for (auto next : m_orderedServiceList) {
-            ThrowIfNot(next->handleStopEngineEvent(), "handleStopEngineEventFailed");
+        // iterate through registered engine modules and call stop() for each module, stopping each
+        // service before the services it depends on
+        for (auto position : m_serviceDependencyGraph->getStopOrder()) {
+            ThrowIfNot(m_orderedServiceList[position]->handleStopEngineEvent(), "handleStopEngineEventFailed");
         }
 
         // set the engine running and configured flag to false - the engine must be reconfigured before starting again
@@ -395,6 +360,108 @@ bool EngineImpl::stop() {
     }
 }
 
+bool EngineImpl::runLifecyclePhase(
+    const std::string& phase,
+    std::function<bool(std::shared_ptr<EngineService>)> handler) {
+    auto runService = [this, &phase, &handler](std::size_t index) {
+        auto service = m_orderedServiceList[index];
+        auto type = service->getDescription().getType();
+        auto startTime = std::chrono::steady_clock::now();
+
+        bool success = false;
+
+        // exceptions are caught here so they are not thrown from a worker thread
+        try {
+            success = handler(service);
+        } catch (std::exception& ex) {
+            AACE_ERROR(LX(TAG).d("reason", ex.what()).d("service", type).d("phase", phase));
+        }
+
+        auto duration =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+        CORE_METRIC(
+            LX(TAG).d("service", type).d("phase", phase).d("duration", duration.count()),
+            aace::engine::core::CoreMetrics::Location::ENGINE_SERVICE_LIFECYCLE_END);
+
+        if (success == false) {
+            AACE_ERROR(LX(TAG)
+                           .d("reason", "serviceLifecycleFailed")
+                           .d("service", type)
+                           .d("phase", phase)
+                           .d("duration", duration.count()));
+        }
+
+        return success;
+    };
+
+    auto serviceCount = m_orderedServiceList.size();
+    auto threadCount = std::min(m_lifecycleThreads, serviceCount);
+
+    // run the services one at a time in dependency order
+    if (threadCount <= 1) {
+        for (std::size_t j = 0; j < serviceCount; j++) {
+            ReturnIfNot(runService(j), false);
+        }
+        return true;
+    }
+
+    std::mutex mutex;
+    std::condition_variable trigger;
+    std::vector<std::size_t> pendingDependencies = m_serviceDependencyGraph->getDependencyCounts();
+    std::set<std::size_t> readyServices;
+    std::size_t completed = 0;
+    bool failed = false;
+
+    for (std::size_t j = 0; j < serviceCount; j++) {
+        if (pendingDependencies[j] == 0) {
+            readyServices.insert(j);
+        }
+    }
+
+    // each worker runs the ready services in registration order, and makes the dependents of a service
+    // ready when it completes
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true) {
+            trigger.wait(lock, [&]() { return failed || completed == serviceCount || readyServices.empty() == false; });
+            if (failed || completed == serviceCount) {
+                return;
+            }
+
+            auto index = *readyServices.begin();
+            readyServices.erase(readyServices.begin());
+
+            lock.unlock();
+            bool success = runService(index);
+            lock.lock();
+
+            if (success == false) {
+                failed = true;
+            } else {
+                completed++;
+                for (auto dependent : m_serviceDependencyGraph->getDependents(index)) {
+                    if (--pendingDependencies[dependent] == 0) {
+                        readyServices.insert(dependent);
+                    }
+                }
+            }
+
+            trigger.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t j = 0; j < threadCount; j++) {
+        threads.emplace_back(worker);
+    }
+    for (auto& next : threads) {
+        next.join();
+    }
+
+    return failed == false;
+}
+
 std::shared_ptr<EngineServiceContext> EngineImpl::getService(const std::string& type) {
     auto it = m_registeredServiceMap.find(type);
     return it != m_registeredServiceMap.end() ? std::make_shared<EngineServiceContext>(it->second) : nullptr;
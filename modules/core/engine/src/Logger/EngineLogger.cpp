@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -31,12 +32,44 @@ namespace aace {
 namespace engine {
 namespace logger {
 
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.logger.EngineLogger");
+
+/// The number of log entries that can be buffered by each thread in asynchronous mode.
+static const size_t THREAD_BUFFER_CAPACITY = 256;
+
+/// The maximum time log entries are buffered before they are emitted in asynchronous mode.
+static const std::chrono::milliseconds ASYNC_FLUSH_INTERVAL = std::chrono::milliseconds(100);
+
+// A log entry buffered in asynchronous mode. The strings are assigned when the entry is written, so
+// their capacity is reused once the buffer has wrapped around.
+struct EngineLogger::LogRecord {
+    std::string source;
+    std::string tag;
+    Level level;
+    std::chrono::system_clock::time_point time;
+    std::string threadMoniker;
+    std::string text;
+    // the number of entries dropped by the thread before this entry because its buffer was full
+    size_t dropped;
+};
+
+// Single producer, single consumer ring of log entries written by one thread. The entries are
+// consumed under m_flushMutex.
+struct EngineLogger::ThreadBuffer {
+    LogRecord records[THREAD_BUFFER_CAPACITY];
+    std::atomic<size_t> writeIndex{0};
+    std::atomic<size_t> readIndex{0};
+    // entries dropped since the last buffered entry, only accessed by the writing thread
+    size_t dropped = 0;
+};
+
 std::shared_ptr<EngineLogger> EngineLogger::getInstance() {
     static std::shared_ptr<EngineLogger> s_instance(new EngineLogger());
     return s_instance;
 }
 
-EngineLogger::EngineLogger() {
+EngineLogger::EngineLogger() : m_async(false), m_asyncRunning(false) {
 #ifdef AAC_DEFAULT_LOGGER_ENABLED
 #ifdef AAC_DEFAULT_LOGGER_SINK
 #if defined AAC_DEFAULT_LOGGER_SINK_CONSOLE
@@ -141,6 +174,20 @@ void EngineLogger::log(
 }
 
 void EngineLogger::emit(
+    const std::string& source,
+    const std::string& tag,
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    if (m_async) {
+        emitAsync(source, tag, level, time, threadMoniker, text);
+    } else {
+        emitSync(source, tag, level, time, threadMoniker, text);
+    }
+}
+
+void EngineLogger::emitSync(
     const std::string& source,
     const std::string& tag,
     Level level,
@@ -161,9 +208,200 @@ void EngineLogger::emit(
     }
 }
 
+void EngineLogger::emitAsync(
+    const std::string& source,
+    const std::string& tag,
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    auto buffer = getThreadBuffer();
+    auto writeIndex = buffer->writeIndex.load(std::memory_order_relaxed);
+
+    // drop the entry if the buffer is full rather than blocking the calling thread, and report the
+    // number of dropped entries with the next entry that is buffered
+    if (writeIndex - buffer->readIndex.load(std::memory_order_acquire) >= THREAD_BUFFER_CAPACITY) {
+        buffer->dropped++;
+        m_asyncCondition.notify_one();
+        return;
+    }
+
+    auto& record = buffer->records[writeIndex % THREAD_BUFFER_CAPACITY];
+    record.source.assign(source);
+    record.tag.assign(tag);
+    record.level = level;
+    record.time = time;
+    record.threadMoniker.assign(threadMoniker);
+    record.text.assign(text);
+    record.dropped = buffer->dropped;
+    buffer->dropped = 0;
+
+    buffer->writeIndex.store(writeIndex + 1, std::memory_order_release);
+
+    // wake up the logger thread early for errors, or when the buffer is half full
+    if (level >= Level::ERROR ||
+        writeIndex + 1 - buffer->readIndex.load(std::memory_order_relaxed) >= THREAD_BUFFER_CAPACITY / 2) {
+        m_asyncCondition.notify_one();
+    }
+}
+
+EngineLogger::ThreadBuffer* EngineLogger::getThreadBuffer() {
+    // the buffer is shared with the logger so it can still be emitted after the thread exits
+    static thread_local std::shared_ptr<ThreadBuffer> s_threadBuffer;
+
+    if (s_threadBuffer == nullptr) {
+        s_threadBuffer = std::make_shared<ThreadBuffer>();
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        m_threadBuffers.push_back(s_threadBuffer);
+    }
+
+    return s_threadBuffer.get();
+}
+
+EngineLogger::~EngineLogger() {
+    setAsync(false);
+}
+
+void EngineLogger::setAsync(bool async) {
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+
+    if (async && m_asyncRunning == false) {
+        m_asyncRunning = true;
+        m_async = true;
+        setSinksBuffered(true);
+        m_asyncThread = std::thread(&EngineLogger::asyncLoop, this);
+    } else if (async == false && m_asyncRunning) {
+        m_async = false;
+        m_asyncRunning = false;
+        m_asyncCondition.notify_all();
+        lock.unlock();
+        m_asyncThread.join();
+
+        // emit the entries that were buffered before the logger thread stopped
+        flush();
+        setSinksBuffered(false);
+    }
+}
+
+void EngineLogger::asyncLoop() {
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    size_t emitted = 0;
+
+    while (m_asyncRunning) {
+        m_asyncCondition.wait_for(lock, ASYNC_FLUSH_INTERVAL);
+
+        lock.unlock();
+
+        // each batch is only handed to the sinks, which flush on their own thresholds; the sinks are
+        // flushed once when logging goes idle, so the last entries of a burst are not held back
+        auto previous = emitted;
+        emitted = emitBuffered(false);
+        if (emitted == 0 && previous > 0) {
+            std::lock_guard<std::mutex> sinkLock(m_mutex);
+            for (auto& next : m_sinkMap) {
+                next.second->flush();
+            }
+        }
+
+        lock.lock();
+    }
+}
+
+void EngineLogger::flush() {
+    emitBuffered(true);
+}
+
+size_t EngineLogger::emitBuffered(bool flushSinks) {
+    std::lock_guard<std::mutex> flushLock(m_flushMutex);
+
+    // collect the buffered entries of each thread
+    std::vector<std::pair<ThreadBuffer*, size_t>> buffers;
+    std::vector<LogRecord*> records;
+    {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        for (auto& next : m_threadBuffers) {
+            auto readIndex = next->readIndex.load(std::memory_order_relaxed);
+            auto writeIndex = next->writeIndex.load(std::memory_order_acquire);
+            for (auto index = readIndex; index != writeIndex; index++) {
+                records.push_back(&next->records[index % THREAD_BUFFER_CAPACITY]);
+            }
+            buffers.emplace_back(next.get(), writeIndex);
+        }
+    }
+
+    // emit the entries of all threads in time order
+    std::stable_sort(records.begin(), records.end(), [](const LogRecord* a, const LogRecord* b) {
+        return a->time < b->time;
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (auto record : records) {
+            if (record->dropped > 0) {
+                LogEntry entry(TAG, "emitAsync");
+                entry.d("reason", "threadBufferFull").d("dropped", record->dropped);
+                for (auto& next : m_sinkMap) {
+                    next.second->emit(
+                        "AAC", entry.tag(), Level::WARN, record->time, record->threadMoniker.c_str(), entry.c_str());
+                }
+                for (auto& next : m_observers) {
+                    next->onLogEvent(Level::WARN, record->time, "AAC", entry.c_str());
+                }
+            }
+            for (auto& next : m_sinkMap) {
+                next.second->emit(
+                    record->source,
+                    record->tag,
+                    record->level,
+                    record->time,
+                    record->threadMoniker.c_str(),
+                    record->text.c_str());
+            }
+            for (auto& next : m_observers) {
+                next->onLogEvent(record->level, record->time, record->source.c_str(), record->text.c_str());
+            }
+        }
+
+        if (flushSinks) {
+            for (auto& next : m_sinkMap) {
+                next.second->flush();
+            }
+        }
+    }
+
+    // release the emitted entries to the writing threads
+    for (auto& next : buffers) {
+        next.first->readIndex.store(next.second, std::memory_order_release);
+    }
+
+    // remove the buffers of threads that have exited
+    {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        m_threadBuffers.erase(
+            std::remove_if(
+                m_threadBuffers.begin(),
+                m_threadBuffers.end(),
+                [](const std::shared_ptr<ThreadBuffer>& buffer) {
+                    return buffer.use_count() == 1 && buffer->readIndex == buffer->writeIndex;
+                }),
+            m_threadBuffers.end());
+    }
+
+    return records.size();
+}
+
+void EngineLogger::setSinksBuffered(bool buffered) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& next : m_sinkMap) {
+        next.second->setBuffered(buffered);
+    }
+}
+
 bool EngineLogger::addSink(std::shared_ptr<aace::engine::logger::sink::Sink> sink, bool replace) {
     std::lock_guard<std::mutex> lock(m_mutex);
     if (replace || m_sinkMap.find(sink->getId()) == m_sinkMap.end()) {
+        sink->setBuffered(m_async);
         m_sinkMap[sink->getId()] = sink;
         return true;
     } else {
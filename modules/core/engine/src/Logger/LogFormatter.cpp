@@ -13,7 +13,8 @@
  * permissions and limitations under the License.
  */
 
-#include <sstream>
+#include <cstdio>
+#include <ctime>
 
 #include "AACE/Engine/Logger/LogFormatter.h"
 
@@ -53,8 +54,17 @@ std::string LogFormatter::format(
     std::chrono::system_clock::time_point time,
     const char* threadMoniker,
     const char* text) {
-    std::stringstream stringToEmit;
+    std::string stringToEmit;
+    format(stringToEmit, level, time, threadMoniker, text);
+    return stringToEmit;
+}
 
+void LogFormatter::format(
+    std::string& output,
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
     char levelCh;
     switch (level) {
         case Level::CRITICAL:
@@ -85,9 +95,9 @@ std::string LogFormatter::format(
         bool millisecondFailure = false;
         char dateTimeString[DATE_AND_TIME_STRING_SIZE];
         auto timeAsTime_t = std::chrono::system_clock::to_time_t(time);
-        auto timeAsTmPtr = std::gmtime(&timeAsTime_t);
-        if (!timeAsTmPtr ||
-            0 == strftime(dateTimeString, sizeof(dateTimeString), STRFTIME_FORMAT_STRING, timeAsTmPtr)) {
+        std::tm timeAsTm;
+        if (!gmtime_r(&timeAsTime_t, &timeAsTm) ||
+            0 == strftime(dateTimeString, sizeof(dateTimeString), STRFTIME_FORMAT_STRING, &timeAsTm)) {
             dateTimeFailure = true;
         }
         auto timeMillisPart = static_cast<int>(
@@ -98,17 +108,16 @@ std::string LogFormatter::format(
             millisecondFailure = true;
         }
 
-        stringToEmit << (dateTimeFailure ? "ERROR: strftime() failed.  Date and time not logged." : dateTimeString)
-                     << TIME_AND_MILLIS_SEPARATOR
-                     << (millisecondFailure ? "ERROR: snprintf() failed.  Milliseconds not logged." : millisString)
-                     << MILLIS_AND_THREAD_SEPARATOR << threadMoniker << THREAD_AND_LEVEL_SEPARATOR << levelCh
-                     << LEVEL_AND_TEXT_SEPARATOR << text;
+        output.append(dateTimeFailure ? "ERROR: strftime() failed.  Date and time not logged." : dateTimeString);
+        output.append(1, TIME_AND_MILLIS_SEPARATOR);
+        output.append(millisecondFailure ? "ERROR: snprintf() failed.  Milliseconds not logged." : millisString);
+        output.append(MILLIS_AND_THREAD_SEPARATOR);
     } else {
-        stringToEmit << "[" << threadMoniker << THREAD_AND_LEVEL_SEPARATOR << levelCh << LEVEL_AND_TEXT_SEPARATOR
-                     << text;
+        output.append(1, '[');
     }
 
-    return stringToEmit.str();
+    output.append(threadMoniker).append(THREAD_AND_LEVEL_SEPARATOR);
+    output.append(1, levelCh).append(1, LEVEL_AND_TEXT_SEPARATOR).append(text);
 }
 
 }  // namespace logger
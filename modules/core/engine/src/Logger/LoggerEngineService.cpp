@@ -71,6 +71,10 @@ bool LoggerEngineService::configure(std::shared_ptr<std::istream> configuration)
 
         auto loggerConfigRoot = document->GetObject();
 
+        if (loggerConfigRoot.HasMember("async") && loggerConfigRoot["async"].IsBool()) {
+            EngineLogger::getInstance()->setAsync(loggerConfigRoot["async"].GetBool());
+        }
+
         if (loggerConfigRoot.HasMember("sinks") && loggerConfigRoot["sinks"].IsArray()) {
             auto sinks = loggerConfigRoot["sinks"].GetArray();
 
@@ -226,6 +230,9 @@ bool LoggerEngineService::registerPlatformInterfaceType(std::shared_ptr<aace::lo
 }
 
 bool LoggerEngineService::shutdown() {
+    // emit buffered log entries before the platform logger is removed
+    EngineLogger::getInstance()->flush();
+
     if (m_logger != nullptr) {
         m_logger->setEngineInterface(nullptr);
         m_logger.reset();
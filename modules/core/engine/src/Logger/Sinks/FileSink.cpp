@@ -33,6 +33,12 @@ namespace sink {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.logger.sink.FileSink");
 
+/// The number of bytes written before the log stream is flushed.
+static const size_t FLUSH_SIZE_THRESHOLD = 16384;
+
+/// The maximum time log entries are held in the stream buffer before it is flushed.
+static const std::chrono::milliseconds FLUSH_TIME_THRESHOLD = std::chrono::milliseconds(1000);
+
 FileSink::FileSink(const std::string& id) : Sink(id) {
 }
 
@@ -89,15 +95,25 @@ void FileSink::log(
     const char* text) {
     if (m_enabled) {
         try {
-            std::string log = aace::engine::logger::LogFormatter::format(level, time, threadMoniker, text);
+            m_buffer.clear();
+            aace::engine::logger::LogFormatter::format(m_buffer, level, time, threadMoniker, text);
+            m_buffer.append(1, '\n');
 
             // check if the log file needs to be rotated
-            if ((long)m_stream->tellp() + log.length() + 1 > m_maxSize) {
+            if ((long)m_stream->tellp() + m_buffer.length() > m_maxSize) {
                 ThrowIfNot(rotateLog(), "rotateLogFailed");
             }
 
             // log the event to file stream
-            *m_stream << log << std::endl;
+            m_stream->write(m_buffer.data(), m_buffer.length());
+            m_unflushedSize += m_buffer.length();
+
+            // flush every entry unless the asynchronous logger is batching entries, in which case
+            // the stream is flushed when enough data is buffered, or immediately for errors
+            if (m_buffered == false || level >= Level::ERROR || m_unflushedSize >= FLUSH_SIZE_THRESHOLD ||
+                std::chrono::steady_clock::now() - m_lastFlushTime >= FLUSH_TIME_THRESHOLD) {
+                flush();
+            }
         } catch (std::exception& ex) {
             // disable the sink so that the error message doesn't cause the logger to
             // get caught in an infinite loop.. ok if another sink handles the event!
@@ -110,7 +126,15 @@ void FileSink::log(
 }
 
 void FileSink::flush() {
-    m_stream->flush();
+    if (m_stream != nullptr) {
+        m_stream->flush();
+    }
+    m_unflushedSize = 0;
+    m_lastFlushTime = std::chrono::steady_clock::now();
+}
+
+void FileSink::setBuffered(bool buffered) {
+    m_buffered = buffered;
 }
 
 bool FileSink::rotateLog() {
@@ -79,6 +79,9 @@ void Sink::emit(
 void Sink::flush() {
 }
 
+void Sink::setBuffered(bool buffered) {
+}
+
 std::string Sink::getId() {
     return m_id;
 }
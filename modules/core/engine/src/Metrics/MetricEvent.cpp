@@ -14,16 +14,14 @@
  */
 
 #include "AACE/Engine/Metrics/MetricEvent.h"
-#include "AACE/Engine/Core/EngineMacros.h"
+#include "AACE/Engine/Metrics/MetricRecorder.h"
 
 namespace aace {
 namespace engine {
 namespace metrics {
 
-static const std::string TAG("MetricEvent");
-
 /// Default number of samples for metric.
-const std::string METRIC_NUM_SAMPLES_DEFAULT = "1";
+static const int METRIC_NUM_SAMPLES_DEFAULT = 1;
 
 MetricEvent::MetricEvent(const std::string& program, const std::string& source) :
         MetricEvent(program, source, MetricPriority::NR, MetricBufferType::NB, MetricIdentityType::NUNI) {
@@ -53,78 +51,49 @@ MetricEvent::MetricEvent(
     MetricIdentityType identityType) :
         m_program{program},
         m_source(source),
-        m_metricLog{""},
         m_priority{priority},
         m_bufferType{bufferType},
         m_identityType{identityType} {
-    m_metricLog.append(m_program).append(":").append(m_source);
 }
 
 void MetricEvent::addTimer(const std::string& name, double value) {
-    addDataToLog(name, std::to_string(value), MetricDataType::TI, METRIC_NUM_SAMPLES_DEFAULT);
+    m_datapoints.push_back({MetricDataType::TI, name, std::to_string(value), METRIC_NUM_SAMPLES_DEFAULT});
 }
 
 void MetricEvent::addString(const std::string& name, const std::string& value) {
-    addDataToLog(name, value, MetricDataType::DV, METRIC_NUM_SAMPLES_DEFAULT);
+    m_datapoints.push_back({MetricDataType::DV, name, value, METRIC_NUM_SAMPLES_DEFAULT});
 }
 
-void MetricEvent::addCounter(const std::string& name, int value) {
-    addDataToLog(name, std::to_string(value), MetricDataType::CT, METRIC_NUM_SAMPLES_DEFAULT);
+void MetricEvent::addCounter(const std::string& name, int value, int sampleCount) {
+    m_datapoints.push_back({MetricDataType::CT, name, std::to_string(value), sampleCount});
 }
 
 void MetricEvent::record() {
-    std::string priorityStr = priorityToString(m_priority);
-    m_metricLog.append(":").append(priorityStr);
-    m_metricLog.append(":").append(bufferTypeToString(m_bufferType));
-    m_metricLog.append(":").append(identityTypeToString(m_identityType));
-    AACE_METRIC(LX(TAG, m_metricLog));
+    MetricRecorder::getInstance()->record(*this);
+}
+
+const std::string& MetricEvent::getProgram() const {
+    return m_program;
 }
 
-void MetricEvent::addDataToLog(std::string name, std::string value, MetricDataType type, std::string sampleCount) {
-    m_metricLog.append(":").append(name).append("=").append(value).append(";");
-    m_metricLog.append(dataTypeToString(type)).append(";").append(sampleCount).append(",");
+const std::string& MetricEvent::getSource() const {
+    return m_source;
 }
 
-std::string MetricEvent::priorityToString(MetricPriority priority) {
-    switch (priority) {
-        case MetricPriority::NR:
-            return "NR";
-        case MetricPriority::HI:
-            return "HI";
-    }
-    return "";
+MetricEvent::MetricPriority MetricEvent::getPriority() const {
+    return m_priority;
 }
 
-std::string MetricEvent::dataTypeToString(MetricDataType type) {
-    switch (type) {
-        case MetricDataType::TI:
-            return "TI";
-        case MetricDataType::DV:
-            return "DV";
-        case MetricDataType::CT:
-            return "CT";
-    }
-    return "";
+MetricEvent::MetricBufferType MetricEvent::getBufferType() const {
+    return m_bufferType;
 }
 
-std::string MetricEvent::bufferTypeToString(MetricBufferType type) {
-    switch (type) {
-        case MetricBufferType::BF:
-            return "BF";
-        case MetricBufferType::NB:
-        default:
-            return "NB";
-    }
+MetricEvent::MetricIdentityType MetricEvent::getIdentityType() const {
+    return m_identityType;
 }
 
-std::string MetricEvent::identityTypeToString(MetricIdentityType type) {
-    switch (type) {
-        case MetricIdentityType::UNIQ:
-            return "UNIQ";
-        case MetricIdentityType::NUNI:
-        default:
-            return "NUNI";
-    }
+const std::vector<MetricEvent::Datapoint>& MetricEvent::getDatapoints() const {
+    return m_datapoints;
 }
 
 }  // namespace metrics
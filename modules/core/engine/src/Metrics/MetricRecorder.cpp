@@ -0,0 +1,252 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <tuple>
+
+#include "AACE/Engine/Metrics/MetricRecorder.h"
+
+namespace aace {
+namespace engine {
+namespace metrics {
+
+const MetricRecorder::CounterId MetricRecorder::INVALID_COUNTER = std::numeric_limits<MetricRecorder::CounterId>::max();
+
+/// Default interval for delivering aggregated counters.
+static const std::chrono::milliseconds DEFAULT_FLUSH_INTERVAL = std::chrono::seconds(30);
+
+std::shared_ptr<MetricRecorder> MetricRecorder::getInstance() {
+    static std::shared_ptr<MetricRecorder> s_instance(new MetricRecorder());
+    return s_instance;
+}
+
+MetricRecorder::MetricRecorder() :
+        m_releasedValues(MAX_COUNTERS, 0),
+        m_releasedSamples(MAX_COUNTERS, 0),
+        m_counterCount(0),
+        m_enabled(false),
+        m_flushInterval(DEFAULT_FLUSH_INTERVAL),
+        m_flushThreadRunning(false) {
+}
+
+MetricRecorder::~MetricRecorder() {
+    setSink(nullptr);
+}
+
+MetricRecorder::ThreadCounters::ThreadCounters() {
+    for (auto& slot : slots) {
+        slot.value = 0;
+        slot.samples = 0;
+    }
+}
+
+MetricRecorder::ThreadCountersOwner::~ThreadCountersOwner() {
+    if (counters != nullptr) {
+        recorder->releaseThreadCounters(counters.get());
+    }
+}
+
+void MetricRecorder::setSink(std::shared_ptr<MetricSinkInterface> sink) {
+    std::lock_guard<std::mutex> setSinkLock(m_setSinkMutex);
+
+    // stop aggregating counters and deliver the counters aggregated so far to the previous sink
+    m_enabled = false;
+    flush();
+
+    {
+        std::lock_guard<std::mutex> lock(m_sinkMutex);
+        m_sink = sink;
+        m_enabled = sink != nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(m_flushMutex);
+    if (sink != nullptr && m_flushThreadRunning == false) {
+        m_flushThreadRunning = true;
+        m_flushThread = std::thread(&MetricRecorder::flushLoop, this);
+    } else if (sink == nullptr && m_flushThreadRunning) {
+        m_flushThreadRunning = false;
+        m_flushCondition.notify_all();
+        lock.unlock();
+        m_flushThread.join();
+    }
+}
+
+bool MetricRecorder::isEnabled() const {
+    return m_enabled;
+}
+
+void MetricRecorder::setFlushInterval(std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(m_flushMutex);
+    m_flushInterval = interval;
+}
+
+std::shared_ptr<MetricSinkInterface> MetricRecorder::getSink() {
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    return m_sink;
+}
+
+void MetricRecorder::record(const MetricEvent& metricEvent) {
+    if (m_enabled == false) {
+        return;
+    }
+
+    auto sink = getSink();
+    if (sink != nullptr) {
+        sink->record(metricEvent);
+    }
+}
+
+MetricRecorder::CounterId MetricRecorder::registerCounter(
+    const std::string& program,
+    const std::string& source,
+    const std::string& name,
+    MetricEvent::MetricBufferType bufferType) {
+    std::string key;
+    key.append(program).append(1, ':').append(source).append(1, ':').append(name);
+    key.append(bufferType == MetricEvent::MetricBufferType::BF ? ":BF" : ":NB");
+
+    std::lock_guard<std::mutex> lock(m_counterMutex);
+
+    auto it = m_counterIds.find(key);
+    if (it != m_counterIds.end()) {
+        return it->second;
+    }
+
+    if (m_counters.size() >= MAX_COUNTERS) {
+        return INVALID_COUNTER;
+    }
+
+    CounterId id = m_counters.size();
+    m_counters.push_back({program, source, name, bufferType});
+    m_counterIds[key] = id;
+    m_counterCount = m_counters.size();
+
+    return id;
+}
+
+MetricRecorder::ThreadCounters* MetricRecorder::getThreadCounters() {
+    // the owner keeps the recorder alive until the counters of the thread are released
+    static thread_local ThreadCountersOwner s_owner;
+
+    if (s_owner.counters == nullptr) {
+        s_owner.recorder = getInstance();
+        s_owner.counters.reset(new ThreadCounters());
+        std::lock_guard<std::mutex> lock(m_counterMutex);
+        m_threadCounters.push_back(s_owner.counters.get());
+    }
+
+    return s_owner.counters.get();
+}
+
+void MetricRecorder::releaseThreadCounters(ThreadCounters* threadCounters) {
+    std::lock_guard<std::mutex> lock(m_counterMutex);
+
+    // keep the counts of the exiting thread until the next flush
+    for (CounterId id = 0; id < m_counters.size(); id++) {
+        auto& slot = threadCounters->slots[id];
+        m_releasedValues[id] += slot.value.load(std::memory_order_relaxed);
+        m_releasedSamples[id] += slot.samples.load(std::memory_order_relaxed);
+    }
+
+    m_threadCounters.erase(
+        std::remove(m_threadCounters.begin(), m_threadCounters.end(), threadCounters), m_threadCounters.end());
+}
+
+void MetricRecorder::incrementCounter(CounterId id, int value) {
+    if (m_enabled == false || id >= m_counterCount.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    auto& slot = getThreadCounters()->slots[id];
+    slot.value.fetch_add(value, std::memory_order_relaxed);
+    slot.samples.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MetricRecorder::flush() {
+    using EventKey = std::tuple<std::string, std::string, MetricEvent::MetricBufferType>;
+    std::map<EventKey, MetricEvent> metricEvents;
+
+    {
+        std::lock_guard<std::mutex> lock(m_counterMutex);
+
+        std::vector<int64_t> values(m_counters.size(), 0);
+        std::vector<int64_t> samples(m_counters.size(), 0);
+
+        for (CounterId id = 0; id < m_counters.size(); id++) {
+            std::swap(values[id], m_releasedValues[id]);
+            std::swap(samples[id], m_releasedSamples[id]);
+        }
+
+        for (auto threadCounters : m_threadCounters) {
+            for (CounterId id = 0; id < m_counters.size(); id++) {
+                auto& slot = threadCounters->slots[id];
+                if (slot.samples.load(std::memory_order_relaxed) > 0) {
+                    samples[id] += slot.samples.exchange(0);
+                    values[id] += slot.value.exchange(0);
+                }
+            }
+        }
+
+        // aggregate the counters into a metric event for each program and source
+        for (CounterId id = 0; id < m_counters.size(); id++) {
+            if (samples[id] == 0) {
+                continue;
+            }
+            auto& counter = m_counters[id];
+            auto key = std::make_tuple(counter.program, counter.source, counter.bufferType);
+            auto it = metricEvents.find(key);
+            if (it == metricEvents.end()) {
+                it = metricEvents.emplace(key, MetricEvent(counter.program, counter.source, counter.bufferType)).first;
+            }
+            const int64_t maxValue = std::numeric_limits<int>::max();
+            it->second.addCounter(
+                counter.name,
+                static_cast<int>(std::min(values[id], maxValue)),
+                static_cast<int>(std::min(samples[id], maxValue)));
+        }
+    }
+
+    if (metricEvents.empty()) {
+        return;
+    }
+
+    auto sink = getSink();
+    if (sink != nullptr) {
+        for (auto& next : metricEvents) {
+            sink->record(next.second);
+        }
+    }
+}
+
+void MetricRecorder::flushLoop() {
+    std::unique_lock<std::mutex> lock(m_flushMutex);
+
+    while (m_flushThreadRunning) {
+        m_flushCondition.wait_for(lock, m_flushInterval, [this]() { return m_flushThreadRunning == false; });
+        if (m_flushThreadRunning == false) {
+            break;
+        }
+
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+}  // namespace metrics
+}  // namespace engine
+}  // namespace aace
@@ -22,6 +22,7 @@
 #include <rapidjson/istreamwrapper.h>
 
 #include "AACE/Engine/Metrics/MetricsEngineService.h"
+#include "AACE/Engine/Metrics/MetricRecorder.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 
 namespace aace {
@@ -40,13 +41,9 @@ MetricsEngineService::MetricsEngineService(const aace::engine::core::ServiceDesc
 
 bool MetricsEngineService::shutdown() {
     if (m_metricsUploaderEngineImpl != nullptr) {
-        // get the logger service interface
-        auto loggerServiceInterface =
-            getContext()->getServiceInterface<aace::engine::logger::LoggerServiceInterface>("aace.logger");
-        ThrowIfNull(loggerServiceInterface, "invalidLoggerServiceInterface");
-
-        // remove the metrics uploader from the logger
-        loggerServiceInterface->removeSink(m_metricsUploaderEngineImpl->getId());
+        // flush the aggregated metrics and remove the metrics uploader from the recorder
+        MetricRecorder::getInstance()->setSink(nullptr);
+        m_metricsUploaderEngineImpl.reset();
     }
 
     return true;
@@ -67,17 +64,12 @@ bool MetricsEngineService::registerPlatformInterfaceType(
     try {
         ThrowIfNotNull(m_metricsUploaderEngineImpl, "platformInterfaceAlreadyRegistered");
 
-        // get the logger service interface
-        auto loggerServiceInterface =
-            getContext()->getServiceInterface<aace::engine::logger::LoggerServiceInterface>("aace.logger");
-        ThrowIfNull(loggerServiceInterface, "invalidLoggerServiceInterface");
-
         // create the metrics uploader engine implementation
         m_metricsUploaderEngineImpl = aace::engine::metrics::MetricsUploaderEngineImpl::create(metricsUploader);
         ThrowIfNull(m_metricsUploaderEngineImpl, "createMetricsUploaderEngineImplFailed");
 
-        // add the uploader service impl to the logger service
-        loggerServiceInterface->addSink(m_metricsUploaderEngineImpl);
+        // deliver recorded metrics to the uploader
+        MetricRecorder::getInstance()->setSink(m_metricsUploaderEngineImpl);
 
         return true;
     } catch (std::exception& ex) {
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <forward_list>
+#include <string>
+#include <unordered_map>
+
+#include "AACE/Engine/Core/ServiceDependencyGraph.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace core {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.core.ServiceDependencyGraph");
+
+std::shared_ptr<ServiceDependencyGraph> ServiceDependencyGraph::create(
+    const std::vector<ServiceDescription>& descriptions) {
+    try {
+        auto graph = std::shared_ptr<ServiceDependencyGraph>(new ServiceDependencyGraph());
+
+        // position in the start order of each service that has been ordered
+        std::unordered_map<std::string, std::size_t> positionMap;
+        std::forward_list<std::size_t> unresolvedDependencyList;
+
+        // returns true if every dependency of the service has been ordered
+        auto resolve = [&descriptions, &positionMap, &graph](std::size_t index) {
+            for (auto next : descriptions[index].getDependencies()) {
+                auto it = positionMap.find(next.getType());
+                if (it == positionMap.end()) {
+                    return false;
+                }
+
+                auto v1 = descriptions[graph->m_startOrder[it->second]].getVersion();
+                auto v2 = next.getVersion();
+
+                ThrowIf(v1 < v2, "invalidDependencyVersion");
+            }
+            return true;
+        };
+        auto add = [&descriptions, &positionMap, &graph](std::size_t index) {
+            positionMap[descriptions[index].getType()] = graph->m_startOrder.size();
+            graph->m_startOrder.push_back(index);
+        };
+
+        for (std::size_t j = 0; j < descriptions.size(); j++) {
+            if (resolve(j)) {
+                add(j);
+            } else {
+                unresolvedDependencyList.push_front(j);
+            }
+        }
+
+        while (unresolvedDependencyList.empty() == false) {
+            bool updated = false;
+            auto it = unresolvedDependencyList.begin();
+            auto prev = unresolvedDependencyList.before_begin();
+
+            while (it != unresolvedDependencyList.end()) {
+                if (resolve(*it)) {
+                    add(*it);
+
+                    // remove the item from the list
+                    it = unresolvedDependencyList.erase_after(prev);
+
+                    updated = true;
+                } else {
+                    prev = it++;
+                }
+            }
+
+            // fail if a dependency is missing or the remaining services depend on each other
+            ThrowIfNot(updated, "failedToResolveServiceDependencies");
+        }
+
+        // build the dependents of each service, used to run the lifecycle phases concurrently
+        graph->m_dependents.assign(descriptions.size(), {});
+        graph->m_dependencyCounts.assign(descriptions.size(), 0);
+
+        for (std::size_t j = 0; j < graph->m_startOrder.size(); j++) {
+            for (auto next : descriptions[graph->m_startOrder[j]].getDependencies()) {
+                graph->m_dependents[positionMap[next.getType()]].push_back(j);
+                graph->m_dependencyCounts[j]++;
+            }
+        }
+
+        return graph;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return nullptr;
+    }
+}
+
+const std::vector<std::size_t>& ServiceDependencyGraph::getStartOrder() const {
+    return m_startOrder;
+}
+
+std::vector<std::size_t> ServiceDependencyGraph::getStopOrder() const {
+    std::vector<std::size_t> stopOrder;
+    for (auto j = m_startOrder.size(); j > 0; j--) {
+        stopOrder.push_back(j - 1);
+    }
+    return stopOrder;
+}
+
+const std::vector<std::size_t>& ServiceDependencyGraph::getDependents(std::size_t position) const {
+    return m_dependents[position];
+}
+
+const std::vector<std::size_t>& ServiceDependencyGraph::getDependencyCounts() const {
+    return m_dependencyCounts;
+}
+
+}  // namespace core
+}  // namespace engine
+}  // namespace aace
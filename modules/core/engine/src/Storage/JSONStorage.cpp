@@ -13,14 +13,21 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
 #include <fstream>
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include "AACE/Engine/Storage/JSONStorage.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 
 #include <rapidjson/istreamwrapper.h>
-#include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <rapidjson/error/en.h>
 
 namespace aace {
@@ -30,10 +37,64 @@ namespace storage {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.storage.JSONStorage");
 
-JSONStorage::JSONStorage(const std::string& path) : m_path(path) {
+// time to wait for more changes before the pending records are written to the journal
+static const std::chrono::milliseconds JOURNAL_FLUSH_DELAY(50);
+
+// the journal is not compacted until it is at least this large, or larger than the snapshot
+static const size_t MIN_COMPACTION_JOURNAL_SIZE = 64 * 1024;
+
+// writes all of the data to a file descriptor, and syncs it to the storage device
+static bool writeFully(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        auto written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return ::fsync(fd) == 0;
+}
+
+// syncs the directory that contains a file, so a file renamed in the directory is persisted
+static bool syncDirectory(const std::string& path) {
+    auto separator = path.find_last_of('/');
+    auto directory = separator == std::string::npos ? std::string(".") : path.substr(0, std::max<size_t>(separator, 1));
+
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    bool synced = ::fsync(fd) == 0;
+    ::close(fd);
+
+    return synced;
+}
+
+JSONStorage::JSONStorage(const std::string& path) : m_path(path), m_journalPath(path + ".journal") {
 }
 
 JSONStorage::~JSONStorage() {
+    // stop the writer thread
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+        m_shutdown = true;
+    }
+    m_writerCondition.notify_all();
+
+    if (m_writerThread.joinable()) {
+        m_writerThread.join();
+    }
+
+    // write the changes that have not been written to the journal
+    if (m_journalFd >= 0) {
+        flush();
+        ::close(m_journalFd);
+    }
 }
 
 std::shared_ptr<JSONStorage> JSONStorage::create(const std::string& path) {
@@ -53,85 +114,346 @@ bool JSONStorage::initialize() {
     try {
         std::ifstream is(m_path);
 
-        if (is.good()) {
-            rapidjson::IStreamWrapper isw(is);
+        if (is.good() == false) {
+            // write the data file so that it is a valid empty json document
+            ThrowIfNot(writeSnapshot("{}", 2), "createDataFileFailed");
+        }
 
-            m_document.ParseStream(isw);
+        m_journalFd = ::open(m_journalPath.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0666);
+        ThrowIf(m_journalFd < 0, "openJournalFailed");
 
-            ThrowIf(m_document.HasParseError(), GetParseError_En(m_document.GetParseError()));
-            ThrowIfNot(m_document.IsObject(), "invalidDataFormat");
-        } else {
-            std::ofstream os(m_path);
+        // load the snapshot and replay the changes in the journal
+        ThrowIfNot(load(m_document), "loadStorageFailed");
 
-            // if the new data file is not open, then we weren't able to create it
-            ThrowIfNot(os.is_open(), "createDataFileFailed");
+        // compact the journal, which also discards a record that was partially written
+        if (m_journalSize > 0) {
+            ThrowIfNot(compact(), "compactJournalFailed");
+        }
 
-            // close the data file
-            os.close();
+        m_writerThread = std::thread(&JSONStorage::writerLoop, this);
 
-            // set the root document object
-            m_document.SetObject();
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "initialize").d("reason", ex.what()));
+        return false;
+    }
+}
 
-            // write the data file so that it is a valid empty json document
-            ThrowIfNot(write(), "writeStorageFailed");
+bool JSONStorage::load(rapidjson::Document& document) {
+    try {
+        std::ifstream is(m_path);
+        ThrowIfNot(is.good(), "openDataFileFailed");
+
+        rapidjson::IStreamWrapper isw(is);
+
+        document.ParseStream(isw);
+
+        ThrowIf(document.HasParseError(), GetParseError_En(document.GetParseError()));
+        ThrowIfNot(document.IsObject(), "invalidDataFormat");
+
+        m_snapshotSize = static_cast<size_t>(isw.Tell());
+
+        // each line of the journal is an array of records that were written together
+        std::ifstream journal(m_journalPath);
+        std::string line;
+
+        m_journalSize = 0;
+
+        while (std::getline(journal, line)) {
+            rapidjson::Document batch;
+            batch.Parse(line.c_str(), line.size());
+
+            // a record that was partially written is the end of the journal
+            if (journal.eof() || batch.HasParseError() || batch.IsArray() == false) {
+                AACE_WARN(LX(TAG, "load").d("reason", "invalidJournalRecord"));
+                m_journalSize += line.size();
+                break;
+            }
+
+            m_journalSize += line.size() + 1;
+
+            for (auto& item : batch.GetArray()) {
+                if (item.IsObject() == false || item.HasMember("op") == false || item["op"].IsString() == false ||
+                    item.HasMember("table") == false || item["table"].IsString() == false) {
+                    continue;
+                }
+
+                Record record;
+                std::string operation = item["op"].GetString();
+
+                if (operation == "put") {
+                    record.operation = Record::Operation::PUT;
+                } else if (operation == "removeKey") {
+                    record.operation = Record::Operation::REMOVE_KEY;
+                } else if (operation == "removeTable") {
+                    record.operation = Record::Operation::REMOVE_TABLE;
+                } else {
+                    continue;
+                }
+
+                record.table = item["table"].GetString();
+                record.key = item.HasMember("key") && item["key"].IsString() ? item["key"].GetString() : "";
+                record.value = item.HasMember("value") && item["value"].IsString() ? item["value"].GetString() : "";
+
+                apply(document, record);
+            }
         }
 
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "initialize").d("reason", ex.what()));
+        AACE_ERROR(LX(TAG, "load").d("reason", ex.what()));
         return false;
     }
 }
 
-bool JSONStorage::write() {
+void JSONStorage::apply(rapidjson::Document& document, const Record& record) {
+    auto root = document.GetObject();
+
+    switch (record.operation) {
+        case Record::Operation::PUT: {
+            // add new table node to the storage document if it doesn't alread exist
+            if (root.HasMember(record.table.c_str()) == false) {
+                root.AddMember(
+                    rapidjson::Value().SetString(record.table.c_str(), record.table.length(), document.GetAllocator()),
+                    rapidjson::Value(rapidjson::kObjectType),
+                    document.GetAllocator());
+            }
+
+            // get a reference to the table node
+            auto tableNode = root[record.table.c_str()].GetObject();
+
+            // Add the new attribute value in the table node
+            if (tableNode.HasMember(record.key.c_str())) {
+                tableNode[record.key.c_str()].SetString(
+                    record.value.c_str(), record.value.length(), document.GetAllocator());
+            } else {
+                tableNode.AddMember(
+                    rapidjson::Value().SetString(record.key.c_str(), record.key.length(), document.GetAllocator()),
+                    rapidjson::Value().SetString(record.value.c_str(), record.value.length(), document.GetAllocator()),
+                    document.GetAllocator());
+            }
+            break;
+        }
+        case Record::Operation::REMOVE_KEY:
+            if (root.HasMember(record.table.c_str()) && root[record.table.c_str()].IsObject()) {
+                root[record.table.c_str()].RemoveMember(record.key.c_str());
+            }
+            break;
+        case Record::Operation::REMOVE_TABLE:
+            root.RemoveMember(record.table.c_str());
+            break;
+    }
+}
+
+void JSONStorage::addRecordLocked(Record record) {
+    // changes made in a transaction are not written until the transaction is committed
+    if (m_transactionInProgress) {
+        m_transactionRecords.push_back(std::move(record));
+        return;
+    }
+
+    // coalesce repeated puts of the same key, since the pending records are written together
+    std::string id = record.table + '\0' + record.key;
+
+    switch (record.operation) {
+        case Record::Operation::PUT: {
+            auto it = m_pendingPuts.find(id);
+            if (it != m_pendingPuts.end()) {
+                m_pendingRecords[it->second].value = std::move(record.value);
+                return;
+            }
+            m_pendingPuts[id] = m_pendingRecords.size();
+            break;
+        }
+        case Record::Operation::REMOVE_KEY:
+            m_pendingPuts.erase(id);
+            break;
+        case Record::Operation::REMOVE_TABLE:
+            m_pendingPuts.clear();
+            break;
+    }
+
+    m_pendingRecords.push_back(std::move(record));
+    m_writerCondition.notify_all();
+}
+
+bool JSONStorage::flush() {
+    std::lock_guard<std::mutex> journalLock(m_journalMutex);
+
+    std::vector<Record> records;
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+        records.swap(m_pendingRecords);
+        m_pendingPuts.clear();
+    }
+
+    return records.empty() || appendJournal(records);
+}
+
+bool JSONStorage::compact() {
     try {
-        std::ofstream os(m_path);
-        rapidjson::OStreamWrapper osw(os);
-        rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer(osw);
+        std::lock_guard<std::mutex> journalLock(m_journalMutex);
 
-        ThrowIfNot(m_document.Accept(writer), "documentInvalid");
+        std::vector<Record> records;
+        rapidjson::StringBuffer buffer;
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
 
-        m_dirty = false;
+            // the document includes uncommitted changes while a transaction is in progress
+            ReturnIf(m_transactionInProgress, false);
+
+            records.swap(m_pendingRecords);
+            m_pendingPuts.clear();
+
+            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+            ThrowIfNot(m_document.Accept(writer), "documentInvalid");
+        }
+
+        // the journal must include every change in the snapshot in case it is replayed after a crash
+        if (records.empty() == false) {
+            appendJournal(records);
+        }
+
+        ThrowIfNot(writeSnapshot(buffer.GetString(), buffer.GetSize()), "writeSnapshotFailed");
+
+        // the changes in the journal are now in the snapshot
+        ThrowIf(::ftruncate(m_journalFd, 0) != 0, "truncateJournalFailed");
+
+        m_journalSize = 0;
+        m_journalDamaged = false;
+        m_compactionRequired = false;
 
         return true;
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "write").d("reason", ex.what()));
+        AACE_ERROR(LX(TAG, "compact").d("reason", ex.what()));
         return false;
     }
 }
 
-bool JSONStorage::put(const std::string& table, const std::string& key, const std::string& value) {
+bool JSONStorage::appendJournal(const std::vector<Record>& records) {
     try {
-        auto root = m_document.GetObject();
+        // records appended after a partially written record would be discarded when the journal is loaded
+        ThrowIf(m_journalDamaged, "journalDamaged");
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+        writer.StartArray();
+
+        for (auto& record : records) {
+            writer.StartObject();
+            writer.Key("op");
+            switch (record.operation) {
+                case Record::Operation::PUT:
+                    writer.String("put");
+                    break;
+                case Record::Operation::REMOVE_KEY:
+                    writer.String("removeKey");
+                    break;
+                case Record::Operation::REMOVE_TABLE:
+                    writer.String("removeTable");
+                    break;
+            }
+            writer.Key("table");
+            writer.String(record.table.c_str(), static_cast<rapidjson::SizeType>(record.table.length()));
+            if (record.operation != Record::Operation::REMOVE_TABLE) {
+                writer.Key("key");
+                writer.String(record.key.c_str(), static_cast<rapidjson::SizeType>(record.key.length()));
+            }
+            if (record.operation == Record::Operation::PUT) {
+                writer.Key("value");
+                writer.String(record.value.c_str(), static_cast<rapidjson::SizeType>(record.value.length()));
+            }
+            writer.EndObject();
+        }
+
+        writer.EndArray();
+
+        // the records are written on a single line, so a partially written batch is discarded when it is loaded
+        buffer.Put('\n');
+
+        if (writeFully(m_journalFd, buffer.GetString(), buffer.GetSize()) == false) {
+            // discard the part of the batch that was written, so the next batch follows the last complete batch
+            if (::ftruncate(m_journalFd, static_cast<off_t>(m_journalSize)) != 0) {
+                m_journalDamaged = true;
+            }
 
-        // add new table node to the storage document if it doesn't alread exist
-        if (root.HasMember(table.c_str()) == false) {
-            root.AddMember(
-                rapidjson::Value().SetString(table.c_str(), table.length(), m_document.GetAllocator()),
-                rapidjson::Value(rapidjson::kObjectType),
-                m_document.GetAllocator());
+            // the document still has the changes, so they are written with the next snapshot
+            m_compactionRequired = true;
+            Throw("writeJournalFailed");
         }
 
-        // get a reference to the table node
-        auto tableNode = root[table.c_str()].GetObject();
+        m_journalSize += buffer.GetSize();
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "appendJournal").d("reason", ex.what()));
+        return false;
+    }
+}
+
+bool JSONStorage::writeSnapshot(const char* data, size_t size) {
+    try {
+        auto tempPath = m_path + ".tmp";
+
+        int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+        ThrowIf(fd < 0, "createTempFileFailed");
+
+        bool written = writeFully(fd, data, size);
+        ::close(fd);
+
+        ThrowIfNot(written, "writeTempFileFailed");
+
+        // replace the snapshot with the complete temp file, and persist the rename before the journal is truncated
+        ThrowIf(std::rename(tempPath.c_str(), m_path.c_str()) != 0, "renameTempFileFailed");
+        ThrowIfNot(syncDirectory(m_path), "syncDirectoryFailed");
+
+        m_snapshotSize = size;
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG, "writeSnapshot").d("reason", ex.what()));
+        return false;
+    }
+}
+
+void JSONStorage::writerLoop() {
+    std::unique_lock<std::recursive_mutex> lock(m_documentMutex);
+
+    while (m_shutdown == false) {
+        m_writerCondition.wait(lock, [this]() { return m_shutdown || m_pendingRecords.empty() == false; });
+
+        // wait for more changes, so a burst of changes is written to the journal at once
+        m_writerCondition.wait_for(lock, JOURNAL_FLUSH_DELAY, [this]() { return m_shutdown; });
 
-        // Add the new attribute value in the table node
-        if (tableNode.HasMember(key.c_str())) {
-            tableNode[key.c_str()].SetString(value.c_str(), value.length(), m_document.GetAllocator());
-        } else {
-            tableNode.AddMember(
-                rapidjson::Value().SetString(key.c_str(), key.length(), m_document.GetAllocator()),
-                rapidjson::Value().SetString(value.c_str(), value.length(), m_document.GetAllocator()),
-                m_document.GetAllocator());
+        lock.unlock();
+
+        flush();
+
+        bool compactionRequired;
+        {
+            std::lock_guard<std::mutex> journalLock(m_journalMutex);
+            compactionRequired =
+                m_compactionRequired || m_journalSize > std::max(MIN_COMPACTION_JOURNAL_SIZE, m_snapshotSize);
         }
 
-        // write the storage file if we are not currently processing a transaction
-        if (m_transactionInProgress == false) {
-            ThrowIfNot(write(), "writeStorageFailed");
-        } else {
-            m_dirty = true;
+        if (compactionRequired) {
+            compact();
         }
 
+        lock.lock();
+    }
+}
+
+bool JSONStorage::put(const std::string& table, const std::string& key, const std::string& value) {
+    try {
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+
+        Record record = {Record::Operation::PUT, table, key, value};
+
+        apply(m_document, record);
+        addRecordLocked(std::move(record));
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "put").d("reason", ex.what()));
@@ -141,6 +463,8 @@ bool JSONStorage::put(const std::string& table, const std::string& key, const st
 
 std::string JSONStorage::get(const std::string& table, const std::string& key) {
     try {
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+
         ThrowIf(m_transactionInProgress, "attemptingToAccessStorageWhileInTransaction");
         ThrowIfNot(containsKey(table, key), "invalidKey");
 
@@ -156,6 +480,8 @@ std::string JSONStorage::get(const std::string& table, const std::string& key) {
 
 std::string JSONStorage::get(const std::string& table, const std::string& key, const std::string& defaultValue) {
     try {
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+
         ThrowIf(m_transactionInProgress, "attemptingToAccessStorageWhileInTransaction");
 
         auto root = m_document.GetObject();
@@ -177,17 +503,14 @@ std::string JSONStorage::get(const std::string& table, const std::string& key, c
 
 bool JSONStorage::removeKey(const std::string& table, const std::string& key) {
     try {
-        auto root = m_document.GetObject();
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
 
         ReturnIfNot(containsKey(table, key), true);
-        ThrowIfNot(root[table.c_str()].RemoveMember(key.c_str()), "removeValueFailed");
 
-        // write the storage file if we are not currently processing a transaction
-        if (m_transactionInProgress == false) {
-            ThrowIfNot(write(), "writeStorageFailed");
-        } else {
-            m_dirty = true;
-        }
+        Record record = {Record::Operation::REMOVE_KEY, table, key, ""};
+
+        apply(m_document, record);
+        addRecordLocked(std::move(record));
 
         return true;
     } catch (std::exception& ex) {
@@ -198,17 +521,14 @@ bool JSONStorage::removeKey(const std::string& table, const std::string& key) {
 
 bool JSONStorage::removeTable(const std::string& table) {
     try {
-        auto root = m_document.GetObject();
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
 
-        ReturnIfNot(root.HasMember(table.c_str()), true);
-        ThrowIfNot(root.RemoveMember(table.c_str()), "removeTableFailed");
+        ReturnIfNot(m_document.GetObject().HasMember(table.c_str()), true);
 
-        // write the storage file if we are not currently processing a transaction
-        if (m_transactionInProgress == false) {
-            ThrowIfNot(write(), "writeStorageFailed");
-        } else {
-            m_dirty = true;
-        }
+        Record record = {Record::Operation::REMOVE_TABLE, table, "", ""};
+
+        apply(m_document, record);
+        addRecordLocked(std::move(record));
 
         return true;
     } catch (std::exception& ex) {
@@ -219,6 +539,8 @@ bool JSONStorage::removeTable(const std::string& table) {
 
 bool JSONStorage::containsKey(const std::string& table, const std::string& key) {
     try {
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+
         ThrowIf(m_transactionInProgress, "attemptingToAccessStorageWhileInTransaction");
 
         auto root = m_document.GetObject();
@@ -236,6 +558,8 @@ bool JSONStorage::containsKey(const std::string& table, const std::string& key)
 
 bool JSONStorage::containsTable(const std::string& table) {
     try {
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+
         ThrowIf(m_transactionInProgress, "attemptingToAccessStorageWhileInTransaction");
 
         auto root = m_document.GetObject();
@@ -249,6 +573,8 @@ bool JSONStorage::containsTable(const std::string& table) {
 
 std::vector<std::string> JSONStorage::keys(const std::string& table) {
     try {
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+
         auto root = m_document.GetObject();
         std::vector<std::string> keys;
 
@@ -272,6 +598,8 @@ std::vector<std::string> JSONStorage::keys(const std::string& table) {
 
 std::vector<JSONStorage::KeyValuePair> JSONStorage::list(const std::string& table) {
     try {
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+
         auto root = m_document.GetObject();
         std::vector<LocalStorageInterface::KeyValuePair> keyValuePairList;
 
@@ -305,6 +633,7 @@ bool JSONStorage::begin() {
         ThrowIfNot(success, "beginTransactionFailed");
 
         // start the new transaction
+        std::lock_guard<std::recursive_mutex> documentLock(m_documentMutex);
         m_transactionInProgress = true;
 
         return true;
@@ -316,42 +645,55 @@ bool JSONStorage::begin() {
 
 bool JSONStorage::commit() {
     try {
-        ThrowIfNot(m_transactionInProgress, "invalidTransaction");
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+
+            ThrowIfNot(m_transactionInProgress, "invalidTransaction");
+
+            // mark the transaction complete and add the changes to the pending records
+            m_transactionInProgress = false;
 
-        // if the document is dirty then write it, otherwise just return
-        if (m_dirty) {
-            ThrowIfNot(write(), "commitTransactionFailed");
+            std::vector<Record> records;
+            records.swap(m_transactionRecords);
+
+            for (auto& record : records) {
+                addRecordLocked(std::move(record));
+            }
         }
 
-        // mark the transaction complete and notify the conditional locks
-        m_transactionInProgress = false;
+        // write the changes before the transaction is reported as committed
+        ThrowIfNot(flush(), "commitTransactionFailed");
+
+        // notify the conditional locks
         m_notifyTransactionComplete.notify_all();
 
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "commit").d("reason", ex.what()));
+        m_notifyTransactionComplete.notify_all();
         return false;
     }
 }
 
 bool JSONStorage::cancel() {
     try {
+        std::lock_guard<std::mutex> journalLock(m_journalMutex);
+        std::lock_guard<std::recursive_mutex> lock(m_documentMutex);
+
         ReturnIfNot(m_transactionInProgress, false);
 
-        // restore the document model by parsing the file again
-        std::ifstream is(m_path);
-        rapidjson::IStreamWrapper isw(is);
+        // restore the document model from the snapshot and journal, and the changes that have not been written yet
         rapidjson::Document document;
+        ThrowIfNot(load(document), "loadStorageFailed");
 
-        document.ParseStream(isw);
-
-        ThrowIf(document.HasParseError(), GetParseError_En(document.GetParseError()));
-        ThrowIfNot(document.IsObject(), "invalidDataFormat");
+        for (auto& record : m_pendingRecords) {
+            apply(document, record);
+        }
 
-        m_document.GetObject() = document.GetObject();
+        m_document.Swap(document);
 
         // mark the transaction complete and notify the conditional locks
-        m_dirty = false;
+        m_transactionRecords.clear();
         m_transactionInProgress = false;
         m_notifyTransactionComplete.notify_all();
 
@@ -18,11 +18,6 @@
 #include "AACE/Engine/Storage/SQLiteStorage.h"
 #include "AACE/Engine/Core/EngineMacros.h"
 
-#include <rapidjson/istreamwrapper.h>
-#include <rapidjson/ostreamwrapper.h>
-#include <rapidjson/prettywriter.h>
-#include <rapidjson/error/en.h>
-
 namespace aace {
 namespace engine {
 namespace storage {
@@ -30,15 +25,86 @@ namespace storage {
 // String to identify log entries originating from this file.
 static const std::string TAG("aace.storage.SQLiteStorage");
 
-SQLiteStorage::SQLiteStorage(const std::string& path) : m_path(path) {
+// maximum time a write made outside of an explicit transaction waits to be committed
+static const std::chrono::milliseconds IMPLICIT_TRANSACTION_DELAY(100);
+
+// maximum number of writes batched in an implicit transaction before it is committed
+static const int MAX_IMPLICIT_TRANSACTION_WRITES = 64;
+
+// maximum time a statement waits for another connection to release a lock on the database
+static const std::chrono::milliseconds BUSY_TIMEOUT(5000);
+
+// quotes a table name so it can be used as an identifier in a statement
+static std::string quoteIdentifier(const std::string& name) {
+    std::string quoted = "\"";
+    for (auto c : name) {
+        quoted += c;
+        if (c == '"') {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+// binds a string to a statement parameter, the string must remain valid until the statement is reset
+static bool bindText(sqlite3_stmt* stmt, int index, const std::string& value) {
+    return sqlite3_bind_text(stmt, index, value.c_str(), static_cast<int>(value.size()), SQLITE_STATIC) == SQLITE_OK;
+}
+
+// returns a text column of the current result row
+static std::string columnText(sqlite3_stmt* stmt, int index) {
+    auto text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, index));
+    return text != nullptr ? std::string(text, sqlite3_column_bytes(stmt, index)) : std::string();
+}
+
+// resets a cached statement when it goes out of scope, so it can be executed again
+class ScopedStatement {
+public:
+    ScopedStatement(sqlite3_stmt* stmt) : m_stmt(stmt) {
+    }
+
+    ~ScopedStatement() {
+        sqlite3_reset(m_stmt);
+        sqlite3_clear_bindings(m_stmt);
+    }
+
+    sqlite3_stmt* get() const {
+        return m_stmt;
+    }
+
+private:
+    sqlite3_stmt* m_stmt;
+};
+
+SQLiteStorage::SQLiteStorage(const std::string& path, bool readCache, size_t maxReadCacheEntries) :
+        m_path(path),
+        m_readCacheEnabled(readCache && maxReadCacheEntries > 0),
+        m_maxReadCacheEntries(maxReadCacheEntries) {
 }
 
 SQLiteStorage::~SQLiteStorage() {
-    // cancel a transaction if it is in progress
+    // stop the flush thread
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_flushCondition.notify_all();
+
+    if (m_flushThread.joinable()) {
+        m_flushThread.join();
+    }
+
+    // commit the pending writes, and cancel a transaction if it is in progress
+    commitImplicitTransactionLocked();
+
     if (m_transactionInProgress) {
         cancel();
     }
 
+    // the prepared statements must be finalized before the database is closed
+    m_tableStatements.clear();
+    m_checkTableStatement.reset();
+
     // close the database
     if (m_db != nullptr) {
         if (sqlite3_close(m_db) != SQLITE_OK) {
@@ -47,9 +113,12 @@ SQLiteStorage::~SQLiteStorage() {
     }
 }
 
-std::shared_ptr<SQLiteStorage> SQLiteStorage::create(const std::string& path) {
+std::shared_ptr<SQLiteStorage> SQLiteStorage::create(
+    const std::string& path,
+    bool readCache,
+    size_t maxReadCacheEntries) {
     try {
-        auto storage = std::shared_ptr<SQLiteStorage>(new SQLiteStorage(path));
+        auto storage = std::shared_ptr<SQLiteStorage>(new SQLiteStorage(path, readCache, maxReadCacheEntries));
 
         ThrowIfNot(storage->initialize(), "initializeFailed");
 
@@ -64,9 +133,10 @@ bool SQLiteStorage::initialize() {
     try {
         std::ifstream is(m_path);
 
+        // the connection is serialized by m_mutex, so sqlite does not need to lock it
         if (is.good()) {
             ThrowIf(
-                sqlite3_open_v2(m_path.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_FULLMUTEX, nullptr) !=
+                sqlite3_open_v2(m_path.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_NOMUTEX, nullptr) !=
                     SQLITE_OK,
                 "openDatabaseFailed");
         } else {
@@ -74,15 +144,32 @@ bool SQLiteStorage::initialize() {
                 sqlite3_open_v2(
                     m_path.c_str(),
                     &m_db,
-                    SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX,
+                    SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX,
                     nullptr) != SQLITE_OK,
                 "createDatabaseFailed");
         }
 
+        // wait for other connections to the database file instead of failing right away while they write
+        if (sqlite3_busy_timeout(m_db, static_cast<int>(BUSY_TIMEOUT.count())) != SQLITE_OK) {
+            AACE_WARN(LX(TAG, "initialize").d("reason", "setBusyTimeoutFailed"));
+        }
+
+        // write ahead logging does not sync the database on every commit, and readers do not block the writer
+        if (!query("PRAGMA journal_mode=WAL;") || !query("PRAGMA synchronous=NORMAL;")) {
+            AACE_WARN(LX(TAG, "initialize").d("reason", "configureJournalFailed"));
+        }
+
+        m_checkTableStatement = prepare("SELECT count(*) FROM sqlite_master WHERE type='table' AND name=?;");
+        ThrowIfNull(m_checkTableStatement, "prepareStatementFailed");
+
+        m_flushThread = std::thread(&SQLiteStorage::flushLoop, this);
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "initialize").d("reason", ex.what()));
 
+        m_checkTableStatement.reset();
+
         if (m_db != nullptr) {
             sqlite3_close(m_db);
             m_db = nullptr;
@@ -92,49 +179,71 @@ bool SQLiteStorage::initialize() {
     }
 }
 
-std::string SQLiteStorage::createStatement(const char* stmt, ...) {
-    try {
-        va_list args;
+SQLiteStorage::Statement SQLiteStorage::prepare(const std::string& sql) {
+    sqlite3_stmt* stmt = nullptr;
+
+    if (sqlite3_prepare_v2(m_db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        AACE_ERROR(LX(TAG, "prepare").d("reason", sqlite3_errmsg(m_db)).sensitive("q", sql));
+        sqlite3_finalize(stmt);
+        return nullptr;
+    }
+
+    return Statement(stmt);
+}
 
-        va_start(args, stmt);
-        auto size = std::vsnprintf(nullptr, 0, stmt, args);
+SQLiteStorage::TableStatements* SQLiteStorage::getTableStatementsLocked(const std::string& table) {
+    try {
+        auto it = m_tableStatements.find(table);
+        if (it != m_tableStatements.end()) {
+            return &it->second;
+        }
 
-        std::string output(size + 1, 0);
+        auto name = quoteIdentifier(table);
 
-        va_start(args, stmt);
-        std::vsprintf(&output[0], stmt, args);
+        TableStatements statements;
+        statements.select = prepare("SELECT value FROM " + name + " WHERE key=?;");
+        statements.upsert = prepare("INSERT OR REPLACE INTO " + name + " (key,value) VALUES (?,?);");
+        statements.remove = prepare("DELETE FROM " + name + " WHERE key=?;");
+        statements.keys = prepare("SELECT key FROM " + name + ";");
+        statements.list = prepare("SELECT key,value FROM " + name + ";");
 
-        va_end(args);
+        ThrowIf(
+            !statements.select || !statements.upsert || !statements.remove || !statements.keys || !statements.list,
+            "prepareStatementFailed");
 
-        return output;
+        return &(m_tableStatements[table] = std::move(statements));
     } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "createStatement").d("reason", ex.what()));
-        return "";
+        AACE_ERROR(LX(TAG, "getTableStatements").d("reason", ex.what()));
+        return nullptr;
     }
 }
 
-bool SQLiteStorage::checkTable(const std::string& table, bool create) {
+bool SQLiteStorage::checkTableLocked(const std::string& table, bool create) {
     try {
         ThrowIfNull(m_db, "invalidDatabase");
 
-        std::string sql =
-            createStatement("SELECT count(*) FROM sqlite_master WHERE type='table' AND name='%s';", table.c_str());
+        if (m_tables.find(table) != m_tables.end()) {
+            return true;
+        }
 
         bool exists = false;
-
-        query(
-            sql,
-            [](void* data, int argc, char** argv, char** azColName) {
-                *((bool*)data) = argc == 1 && std::atoi(*argv) == 1;
-                return SQLITE_OK;
-            },
-            &exists);
+        {
+            ScopedStatement stmt(m_checkTableStatement.get());
+            ThrowIfNot(bindText(stmt.get(), 1, table), "bindFailed");
+            exists = sqlite3_step(stmt.get()) == SQLITE_ROW && sqlite3_column_int(stmt.get(), 0) == 1;
+        }
 
         if (exists == false && create) {
-            sql = createStatement(
-                "CREATE TABLE '%s' (key STRING PRIMARY KEY NOT NULL,value STRING NOT NULL);", table.c_str());
-            ThrowIfNot(query(sql) && checkTable(table), "createTableFailed");
-            return true;
+            beginWriteLocked();
+            bool created = query(
+                "CREATE TABLE " + quoteIdentifier(table) + " (key STRING PRIMARY KEY NOT NULL,value STRING NOT NULL);");
+            endWriteLocked();
+            ThrowIfNot(created, "createTableFailed");
+            exists = true;
+        }
+
+        if (exists) {
+            m_tables.insert(table);
         }
 
         return exists;
@@ -144,35 +253,113 @@ bool SQLiteStorage::checkTable(const std::string& table, bool create) {
     }
 }
 
-bool SQLiteStorage::checkKey(const std::string& table, const std::string& key) {
-    try {
-        ThrowIfNull(m_db, "invalidDatabase");
-        ReturnIfNot(checkTable(table), false);
+bool SQLiteStorage::getLocked(const std::string& table, const std::string& key, std::string& value) {
+    if (getCachedLocked(table, key, value)) {
+        return true;
+    }
 
-        bool exists = false;
+    auto statements = getTableStatementsLocked(table);
+    ThrowIfNull(statements, "invalidTableStatements");
 
-        auto sql = createStatement("SELECT value FROM '%s' WHERE key='%s';", table.c_str(), key.c_str());
-        query(
-            sql,
-            [](void* data, int argc, char** argv, char** azColName) {
-                *((bool*)data) = argc == 1;
-                return SQLITE_OK;
-            },
-            &exists);
+    ScopedStatement stmt(statements->select.get());
+    ThrowIfNot(bindText(stmt.get(), 1, key), "bindFailed");
 
-        return exists;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "checkTable").d("reason", ex.what()));
+    auto result = sqlite3_step(stmt.get());
+    ThrowIf(result != SQLITE_ROW && result != SQLITE_DONE, sqlite3_errmsg(m_db));
+    ReturnIf(result == SQLITE_DONE, false);
+
+    value = columnText(stmt.get(), 0);
+    cacheLocked(table, key, value);
+
+    return true;
+}
+
+bool SQLiteStorage::getCachedLocked(const std::string& table, const std::string& key, std::string& value) {
+    if (!m_readCacheEnabled) {
+        return false;
+    }
+
+    auto tableIt = m_readCache.find(table);
+    if (tableIt == m_readCache.end()) {
+        return false;
+    }
+
+    auto it = tableIt->second.find(key);
+    if (it == tableIt->second.end()) {
         return false;
     }
+
+    // move the entry to the front, so it is evicted last
+    m_readCacheEntries.splice(m_readCacheEntries.begin(), m_readCacheEntries, it->second);
+    value = it->second->value;
+
+    return true;
+}
+
+void SQLiteStorage::cacheLocked(const std::string& table, const std::string& key, const std::string& value) {
+    if (!m_readCacheEnabled) {
+        return;
+    }
+
+    auto& tableEntries = m_readCache[table];
+    auto it = tableEntries.find(key);
+    if (it != tableEntries.end()) {
+        it->second->value = value;
+        m_readCacheEntries.splice(m_readCacheEntries.begin(), m_readCacheEntries, it->second);
+        return;
+    }
+
+    m_readCacheEntries.push_front({table, key, value});
+    tableEntries[key] = m_readCacheEntries.begin();
+
+    // evict the least recently used entry when the cache is full
+    if (m_readCacheEntries.size() > m_maxReadCacheEntries) {
+        auto& last = m_readCacheEntries.back();
+        auto lastTableIt = m_readCache.find(last.table);
+        lastTableIt->second.erase(last.key);
+        if (lastTableIt->second.empty()) {
+            m_readCache.erase(lastTableIt);
+        }
+        m_readCacheEntries.pop_back();
+    }
+}
+
+void SQLiteStorage::uncacheLocked(const std::string& table, const std::string& key) {
+    auto tableIt = m_readCache.find(table);
+    if (tableIt == m_readCache.end()) {
+        return;
+    }
+
+    auto it = tableIt->second.find(key);
+    if (it != tableIt->second.end()) {
+        m_readCacheEntries.erase(it->second);
+        tableIt->second.erase(it);
+    }
 }
 
-bool SQLiteStorage::query(const std::string& sql, int (*cb)(void*, int, char**, char**), void* data) {
+void SQLiteStorage::uncacheTableLocked(const std::string& table) {
+    auto tableIt = m_readCache.find(table);
+    if (tableIt == m_readCache.end()) {
+        return;
+    }
+
+    for (auto& next : tableIt->second) {
+        m_readCacheEntries.erase(next.second);
+    }
+    m_readCache.erase(tableIt);
+}
+
+void SQLiteStorage::clearCacheLocked() {
+    m_readCache.clear();
+    m_readCacheEntries.clear();
+}
+
+bool SQLiteStorage::query(const std::string& sql) {
     try {
         ThrowIfNull(m_db, "invalidDatabase");
 
         char* errmsg = nullptr;
-        bool success = sqlite3_exec(m_db, sql.c_str(), cb, data, &errmsg) == SQLITE_OK;
+        bool success = sqlite3_exec(m_db, sql.c_str(), nullptr, nullptr, &errmsg) == SQLITE_OK;
 
         if (errmsg != nullptr) {
             AACE_ERROR(LX(TAG, "query").d("reason", errmsg).sensitive("q", sql));
@@ -186,22 +373,96 @@ bool SQLiteStorage::query(const std::string& sql, int (*cb)(void*, int, char**,
     }
 }
 
+void SQLiteStorage::beginWriteLocked() {
+    if (m_transactionInProgress || m_implicitTransaction) {
+        return;
+    }
+
+    if (query("BEGIN TRANSACTION;")) {
+        m_implicitTransaction = true;
+        m_implicitTransactionWrites = 0;
+        m_implicitTransactionStart = std::chrono::steady_clock::now();
+        m_flushCondition.notify_all();
+    }
+}
+
+void SQLiteStorage::endWriteLocked() {
+    if (m_implicitTransaction && ++m_implicitTransactionWrites >= MAX_IMPLICIT_TRANSACTION_WRITES) {
+        commitImplicitTransactionLocked();
+    }
+}
+
+void SQLiteStorage::commitImplicitTransactionLocked() {
+    if (!m_implicitTransaction) {
+        return;
+    }
+
+    m_implicitTransaction = false;
+
+    if (!query("COMMIT TRANSACTION;")) {
+        AACE_ERROR(LX(TAG, "commitImplicitTransaction").d("reason", "commitTransactionFailed"));
+
+        // the cached values may include writes that were not committed
+        query("ROLLBACK TRANSACTION;");
+        clearCacheLocked();
+        m_tables.clear();
+        m_tableStatements.clear();
+
+        // the next write reports that the batched writes were lost
+        m_implicitCommitFailed = true;
+    }
+}
+
+bool SQLiteStorage::checkImplicitCommitLocked() {
+    if (m_implicitCommitFailed) {
+        m_implicitCommitFailed = false;
+        return false;
+    }
+    return true;
+}
+
+void SQLiteStorage::flushLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_shutdown) {
+        if (m_implicitTransaction) {
+            auto deadline = m_implicitTransactionStart + IMPLICIT_TRANSACTION_DELAY;
+            if (!m_flushCondition.wait_until(
+                    lock, deadline, [this]() { return m_shutdown || !m_implicitTransaction; })) {
+                commitImplicitTransactionLocked();
+            }
+        } else {
+            m_flushCondition.wait(lock, [this]() { return m_shutdown || m_implicitTransaction; });
+        }
+    }
+}
+
 bool SQLiteStorage::put(const std::string& table, const std::string& key, const std::string& value) {
     try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         ThrowIfNull(m_db, "invalidDatabase");
-        ThrowIfNot(checkTable(table, true), "invalidTable");
+        ThrowIfNot(checkImplicitCommitLocked(), "batchedWritesNotCommitted");
+        ThrowIfNot(checkTableLocked(table, true), "invalidTable");
 
-        std::string sql;
+        auto statements = getTableStatementsLocked(table);
+        ThrowIfNull(statements, "invalidTableStatements");
 
-        if (containsKey(table, key)) {
-            sql = createStatement(
-                "UPDATE '%s' SET value='%s' WHERE key='%s';", table.c_str(), value.c_str(), key.c_str());
-        } else {
-            sql = createStatement(
-                "INSERT INTO '%s' (key,value) VALUES ('%s','%s');", table.c_str(), key.c_str(), value.c_str());
+        beginWriteLocked();
+
+        int result;
+        {
+            ScopedStatement stmt(statements->upsert.get());
+            ThrowIfNot(bindText(stmt.get(), 1, key) && bindText(stmt.get(), 2, value), "bindFailed");
+            result = sqlite3_step(stmt.get());
         }
 
-        ThrowIfNot(query(sql), "executeSqlStatementFailed");
+        endWriteLocked();
+
+        ThrowIf(result != SQLITE_DONE, "executeSqlStatementFailed");
+        ThrowIfNot(checkImplicitCommitLocked(), "commitBatchedWritesFailed");
+
+        cacheLocked(table, key, value);
 
         return true;
     } catch (std::exception& ex) {
@@ -212,21 +473,13 @@ bool SQLiteStorage::put(const std::string& table, const std::string& key, const
 
 std::string SQLiteStorage::get(const std::string& table, const std::string& key) {
     try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         ThrowIfNull(m_db, "invalidDatabase");
-        ThrowIfNot(checkTable(table, false), "invalidTable");
+        ThrowIfNot(checkTableLocked(table, false), "invalidTable");
 
         std::string output;
-
-        auto sql = createStatement("SELECT value FROM '%s' WHERE key='%s';", table.c_str(), key.c_str());
-        query(
-            sql,
-            [](void* data, int argc, char** argv, char** azColName) {
-                if (argc == 1) {
-                    ((std::string*)data)->append(*argv);
-                }
-                return SQLITE_OK;
-            },
-            &output);
+        getLocked(table, key, output);
 
         return output;
     } catch (std::exception& ex) {
@@ -242,11 +495,31 @@ std::string SQLiteStorage::get(const std::string& table, const std::string& key,
 
 bool SQLiteStorage::removeKey(const std::string& table, const std::string& key) {
     try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         ThrowIfNull(m_db, "invalidDatabase");
-        ThrowIfNot(containsKey(table, key), "invalidKey");
+        ThrowIfNot(checkImplicitCommitLocked(), "batchedWritesNotCommitted");
+        ThrowIfNot(checkTableLocked(table), "invalidKey");
+
+        auto statements = getTableStatementsLocked(table);
+        ThrowIfNull(statements, "invalidTableStatements");
+
+        beginWriteLocked();
+
+        int result;
+        {
+            ScopedStatement stmt(statements->remove.get());
+            ThrowIfNot(bindText(stmt.get(), 1, key), "bindFailed");
+            result = sqlite3_step(stmt.get());
+        }
+
+        endWriteLocked();
+
+        ThrowIf(result != SQLITE_DONE, "removeKeyFailed");
+        ThrowIfNot(checkImplicitCommitLocked(), "commitBatchedWritesFailed");
+        ThrowIf(sqlite3_changes(m_db) == 0, "invalidKey");
 
-        auto sql = createStatement("DELETE FROM '%s' WHERE key='%s';", table.c_str(), key.c_str());
-        ThrowIfNot(query(sql), "removeKeyFailed");
+        uncacheLocked(table, key);
 
         return true;
     } catch (std::exception& ex) {
@@ -257,14 +530,23 @@ bool SQLiteStorage::removeKey(const std::string& table, const std::string& key)
 
 bool SQLiteStorage::removeTable(const std::string& table) {
     try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         ThrowIfNull(m_db, "invalidDatabase");
-        ThrowIfNot(containsTable(table), "invalidTable");
+        ThrowIfNot(checkImplicitCommitLocked(), "batchedWritesNotCommitted");
+        ThrowIfNot(checkTableLocked(table), "invalidTable");
+
+        // the statements for the table are finalized before it is dropped
+        m_tableStatements.erase(table);
+        m_tables.erase(table);
+        uncacheTableLocked(table);
 
-        auto sql = createStatement("DELETE FROM '%s';", table.c_str());
-        ThrowIfNot(query(sql), "deleteFromTableFailed");
+        beginWriteLocked();
+        bool dropped = query("DROP TABLE IF EXISTS " + quoteIdentifier(table) + ";");
+        endWriteLocked();
 
-        sql = createStatement("DROP TABLE IF EXISTS '%s';", table.c_str());
-        ThrowIfNot(query(sql), "dropTableFailed");
+        ThrowIfNot(dropped, "dropTableFailed");
+        ThrowIfNot(checkImplicitCommitLocked(), "commitBatchedWritesFailed");
 
         return true;
     } catch (std::exception& ex) {
@@ -275,8 +557,13 @@ bool SQLiteStorage::removeTable(const std::string& table) {
 
 bool SQLiteStorage::containsKey(const std::string& table, const std::string& key) {
     try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         ThrowIfNull(m_db, "invalidDatabase");
-        return checkKey(table, key);
+        ReturnIfNot(checkTableLocked(table), false);
+
+        std::string value;
+        return getLocked(table, key, value);
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "containsKey").d("reason", ex.what()));
         return false;
@@ -284,22 +571,26 @@ bool SQLiteStorage::containsKey(const std::string& table, const std::string& key
 }
 
 bool SQLiteStorage::containsTable(const std::string& table) {
-    return checkTable(table);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return checkTableLocked(table);
 }
 
 std::vector<std::string> SQLiteStorage::keys(const std::string& table) {
     try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         ThrowIfNull(m_db, "invalidDatabase");
+        ThrowIfNot(checkTableLocked(table), "invalidTable");
+
+        auto statements = getTableStatementsLocked(table);
+        ThrowIfNull(statements, "invalidTableStatements");
+
         std::vector<std::string> keys;
 
-        auto sql = createStatement("SELECT key FROM '%s';", table.c_str());
-        query(
-            sql,
-            [](void* data, int argc, char** argv, char** azColName) {
-                ((std::vector<std::string>*)data)->push_back(*argv);
-                return SQLITE_OK;
-            },
-            &keys);
+        ScopedStatement stmt(statements->keys.get());
+        while (sqlite3_step(stmt.get()) == SQLITE_ROW) {
+            keys.push_back(columnText(stmt.get(), 0));
+        }
 
         return keys;
     } catch (std::exception& ex) {
@@ -310,17 +601,20 @@ std::vector<std::string> SQLiteStorage::keys(const std::string& table) {
 
 std::vector<SQLiteStorage::KeyValuePair> SQLiteStorage::list(const std::string& table) {
     try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         ThrowIfNull(m_db, "invalidDatabase");
+        ThrowIfNot(checkTableLocked(table), "invalidTable");
+
+        auto statements = getTableStatementsLocked(table);
+        ThrowIfNull(statements, "invalidTableStatements");
+
         std::vector<LocalStorageInterface::KeyValuePair> keyValuePairList;
 
-        auto sql = createStatement("SELECT key,value FROM '%s';", table.c_str());
-        query(
-            sql,
-            [](void* data, int argc, char** argv, char** azColName) {
-                ((std::vector<LocalStorageInterface::KeyValuePair>*)data)->push_back({argv[0], argv[1]});
-                return SQLITE_OK;
-            },
-            &keyValuePairList);
+        ScopedStatement stmt(statements->list.get());
+        while (sqlite3_step(stmt.get()) == SQLITE_ROW) {
+            keyValuePairList.push_back({columnText(stmt.get(), 0), columnText(stmt.get(), 1)});
+        }
 
         return keyValuePairList;
     } catch (std::exception& ex) {
@@ -331,7 +625,14 @@ std::vector<SQLiteStorage::KeyValuePair> SQLiteStorage::list(const std::string&
 
 bool SQLiteStorage::begin() {
     try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         ThrowIfNull(m_db, "invalidDatabase");
+
+        // commit the batched writes so they are not part of the explicit transaction
+        commitImplicitTransactionLocked();
+        ThrowIfNot(checkImplicitCommitLocked(), "commitBatchedWritesFailed");
+
         ThrowIfNot(query("BEGIN TRANSACTION;"), "beginTransactionFailed");
 
         m_transactionInProgress = true;
@@ -345,6 +646,8 @@ bool SQLiteStorage::begin() {
 
 bool SQLiteStorage::commit() {
     try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         ThrowIfNull(m_db, "invalidDatabase");
         ThrowIfNot(m_transactionInProgress, "transactionNotInProgresss");
         ThrowIfNot(query("COMMIT TRANSACTION;"), "commitTransactionFailed");
@@ -360,12 +663,19 @@ bool SQLiteStorage::commit() {
 
 bool SQLiteStorage::cancel() {
     try {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
         ThrowIfNull(m_db, "invalidDatabase");
         ThrowIfNot(m_transactionInProgress, "transactionNotInProgresss");
         ThrowIfNot(query("ROLLBACK TRANSACTION;"), "cancelTransactionFailed");
 
         m_transactionInProgress = false;
 
+        // the cached values and tables may include changes that were rolled back
+        clearCacheLocked();
+        m_tables.clear();
+        m_tableStatements.clear();
+
         return true;
     } catch (std::exception& ex) {
         AACE_ERROR(LX(TAG, "cancel").d("reason", ex.what()));
@@ -54,7 +54,10 @@ bool StorageEngineService::configure(std::shared_ptr<std::istream> configuration
                                    : "sqlite";
 
             if (type == "sqlite") {
-                m_localStorage = SQLiteStorage::create(localStoragePath);
+                bool readCache = storageConfigRoot.HasMember("readCache") && storageConfigRoot["readCache"].IsBool()
+                                     ? storageConfigRoot["readCache"].GetBool()
+                                     : false;
+                m_localStorage = SQLiteStorage::create(localStoragePath, readCache);
             } else if (type == "json") {
 #ifdef DEBUG
                 m_localStorage = JSONStorage::create(localStoragePath);
@@ -17,6 +17,9 @@
 #include <AACE/Engine/Metrics/MetricEvent.h>
 #include <AACE/Engine/Utils/Metrics/Metrics.h>
 
+#include <functional>
+#include <unordered_map>
+
 namespace aace {
 namespace engine {
 namespace utils {
@@ -30,6 +33,60 @@ static const std::string METRIC_PROGRAM_NAME_PREFIX = "AlexaAuto";
 /// Delimiter
 static const std::string DELIMITER = "_";
 
+// A non-unique counter registered by the calling thread through the string based functions.
+struct CachedCounter {
+    std::string metricSuffix;
+    std::string methodName;
+    std::string key;
+    MetricEvent::MetricBufferType bufferType;
+    MetricRecorder::CounterId id;
+};
+
+// Gets the id of a non-unique counter, registering the counter the first time it is used on the calling thread.
+// The lookup hashes the names in place, so no key string is built or allocated for a counter already registered.
+static MetricRecorder::CounterId getCounter(
+    const std::string& metricSuffix,
+    const std::string& methodName,
+    const std::string& key,
+    MetricEvent::MetricBufferType bufferType) {
+    static thread_local std::unordered_multimap<std::size_t, CachedCounter> s_counters;
+
+    std::hash<std::string> hasher;
+    std::size_t hash = hasher(metricSuffix);
+    hash = hash * 31 + hasher(methodName);
+    hash = hash * 31 + hasher(key);
+    hash = hash * 31 + static_cast<std::size_t>(bufferType);
+
+    auto range = s_counters.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto& counter = it->second;
+        if (counter.bufferType == bufferType && counter.key == key && counter.methodName == methodName &&
+            counter.metricSuffix == metricSuffix) {
+            return counter.id;
+        }
+    }
+
+    auto id = registerCounterMetrics(metricSuffix, methodName, key, bufferType);
+    if (id != MetricRecorder::INVALID_COUNTER) {
+        s_counters.emplace(hash, CachedCounter{metricSuffix, methodName, key, bufferType, id});
+    }
+
+    return id;
+}
+
+MetricRecorder::CounterId registerCounterMetrics(
+    const std::string& metricSuffix,
+    const std::string& methodName,
+    const std::string& key,
+    MetricEvent::MetricBufferType bufferType) {
+    return MetricRecorder::getInstance()->registerCounter(
+        METRIC_PROGRAM_NAME_PREFIX + DELIMITER + metricSuffix, methodName, key, bufferType);
+}
+
+void emitCounterMetrics(MetricRecorder::CounterId counter, const int value) {
+    MetricRecorder::getInstance()->incrementCounter(counter, value);
+}
+
 void emitCounterMetrics(
     const std::string& metricSuffix,
     const std::string& methodName,
@@ -37,6 +94,20 @@ void emitCounterMetrics(
     const int value,
     MetricEvent::MetricBufferType bufferType,
     MetricEvent::MetricIdentityType identityType) {
+    auto recorder = MetricRecorder::getInstance();
+    if (recorder->isEnabled() == false) {
+        return;
+    }
+
+    // non-unique counters are aggregated by the recorder
+    if (identityType == MetricEvent::MetricIdentityType::NUNI) {
+        auto counter = getCounter(metricSuffix, methodName, key, bufferType);
+        if (counter != MetricRecorder::INVALID_COUNTER) {
+            recorder->incrementCounter(counter, value);
+            return;
+        }
+    }
+
     auto metricEvent = std::shared_ptr<MetricEvent>(
         new MetricEvent(METRIC_PROGRAM_NAME_PREFIX + DELIMITER + metricSuffix, methodName, bufferType, identityType));
     if (metricEvent) {
@@ -51,12 +122,30 @@ void emitCounterMetrics(
     const std::vector<std::string>& datapoints,
     MetricEvent::MetricBufferType bufferType,
     MetricEvent::MetricIdentityType identityType) {
-    auto metricEvent = std::shared_ptr<MetricEvent>(
-        new MetricEvent(METRIC_PROGRAM_NAME_PREFIX + DELIMITER + metricSuffix, methodName, bufferType, identityType));
-    if (metricEvent) {
-        for (auto& datapoint : datapoints) {
-            metricEvent->addCounter(datapoint, 1);
+    auto recorder = MetricRecorder::getInstance();
+    if (recorder->isEnabled() == false) {
+        return;
+    }
+
+    // non-unique counters are aggregated by the recorder, and only the datapoints that could not be registered
+    // as counters are recorded as a metric event
+    std::shared_ptr<MetricEvent> metricEvent;
+    for (auto& datapoint : datapoints) {
+        if (identityType == MetricEvent::MetricIdentityType::NUNI) {
+            auto counter = getCounter(metricSuffix, methodName, datapoint, bufferType);
+            if (counter != MetricRecorder::INVALID_COUNTER) {
+                recorder->incrementCounter(counter, 1);
+                continue;
+            }
+        }
+        if (metricEvent == nullptr) {
+            metricEvent = std::shared_ptr<MetricEvent>(new MetricEvent(
+                METRIC_PROGRAM_NAME_PREFIX + DELIMITER + metricSuffix, methodName, bufferType, identityType));
         }
+        metricEvent->addCounter(datapoint, 1);
+    }
+
+    if (metricEvent != nullptr) {
         metricEvent->record();
     }
 }
@@ -68,6 +157,10 @@ void emitTimerMetrics(
     const double value,
     MetricEvent::MetricBufferType bufferType,
     MetricEvent::MetricIdentityType identityType) {
+    if (MetricRecorder::getInstance()->isEnabled() == false) {
+        return;
+    }
+
     auto metricEvent = std::shared_ptr<MetricEvent>(
         new MetricEvent(METRIC_PROGRAM_NAME_PREFIX + DELIMITER + metricSuffix, methodName, bufferType, identityType));
     if (metricEvent) {
@@ -84,6 +177,10 @@ void emitMetrics(
     const std::vector<std::pair<std::string, double>>& timerDatapoints,
     MetricEvent::MetricBufferType bufferType,
     MetricEvent::MetricIdentityType identityType) {
+    if (MetricRecorder::getInstance()->isEnabled() == false) {
+        return;
+    }
+
     auto metricEvent = std::shared_ptr<MetricEvent>(
         new MetricEvent(METRIC_PROGRAM_NAME_PREFIX + DELIMITER + metricSuffix, methodName, bufferType, identityType));
     if (metricEvent) {
@@ -184,6 +281,26 @@ void emitBufferedMetrics(
         MetricEvent::MetricIdentityType::NUNI);
 }
 
+CounterMetric::CounterMetric(
+    const std::string& metricSuffix,
+    const std::string& methodName,
+    const std::string& key,
+    MetricEvent::MetricBufferType bufferType) :
+        m_metricSuffix(metricSuffix),
+        m_methodName(methodName),
+        m_key(key),
+        m_bufferType(bufferType),
+        m_counter(MetricRecorder::INVALID_COUNTER) {
+}
+
+void CounterMetric::emit(const int value) {
+    // the counter is registered on first use, so file scope counters do not depend on static initialization order
+    std::call_once(m_registered, [this]() {
+        m_counter = registerCounterMetrics(m_metricSuffix, m_methodName, m_key, m_bufferType);
+    });
+    emitCounterMetrics(m_counter, value);
+}
+
 double getCurrentTimeInMs() {
     auto now = std::chrono::system_clock::now();
     auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch());
@@ -14,128 +14,181 @@
  */
 
 #include <AACE/Engine/Utils/UUID/UUID.h>
-#include <AACE/Engine/Core/EngineMacros.h>
 
 #include <random>
 #include <chrono>
-#include <sstream>
-#include <iomanip>
-#include <mutex>
-#include <climits>
+#include <thread>
 #include <algorithm>
-#include <functional>
+#include <cctype>
 
 namespace aace {
 namespace engine {
 namespace utils {
 namespace uuid {
 
-/// The UUID version (Version 4), shifted into the correct position in the byte.
-static const uint8_t UUID_VERSION_VALUE = 4 << 4;
+/// The UUID version (Version 4), in the version field of the most significant 64 bits.
+static const uint64_t UUID_VERSION_VALUE = 0x4000ULL;
 
-/// The UUID variant (Variant 1), shifted into the correct position in the byte.
-static const size_t UUID_VARIANT_VALUE = 2 << 6;
+/// Mask of the version field in the most significant 64 bits.
+static const uint64_t UUID_VERSION_MASK = 0xf000ULL;
 
-/// Separator used between UUID fields.
-static const std::string SEPARATOR("-");
+/// The UUID variant (Variant 1), in the variant field of the least significant 64 bits.
+static const uint64_t UUID_VARIANT_VALUE = 0x8000000000000000ULL;
 
-/// Number of bits in the replacement value.
-static const size_t MAX_NUM_REPLACEMENT_BITS = CHAR_BIT;
+/// Mask of the variant field in the least significant 64 bits.
+static const uint64_t UUID_VARIANT_MASK = 0xc000000000000000ULL;
 
-/// Number of bits in a hex digit.
-static const size_t BITS_IN_HEX_DIGIT = 4;
+/// Lower case hex digits, indexed by nibble value.
+static const char HEX_DIGITS[] = "0123456789abcdef";
 
-// String to identify log entries originating from this file.
-static const std::string TAG("aace.engine.utils.uuid.UUID");
+constexpr size_t Uuid::STRING_LENGTH;
 
 /**
- * Randomly generate a string of hex digits. Before the conversion of hex to string,
- * the function allows replacement of the bits of the first two generated hex digits.
- * Replacement happens starting at the most significant, to the least significant bit.
- *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
- * @param replacementBits The replacement value for up to the first two digits generated.
- * @param numReplacementBits The number of bits of @c replacementBits to use.
- *
- * @return A hex string of length @c numDigits.
+ * A xoshiro256** pseudo random number generator. Each thread owns an instance, so UUIDs can be generated
+ * without locking.
+ * @see http://prng.di.unimi.it
  */
-static const std::string generateHexWithReplacement(
-    std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t>& ibe,
-    unsigned int numDigits,
-    uint8_t replacementBits,
-    unsigned short numReplacementBits) {
-    try {
-        ThrowIf(numReplacementBits > MAX_NUM_REPLACEMENT_BITS, "replacingMoreBitsThanProvided");
-        ThrowIf(numReplacementBits > (numDigits * BITS_IN_HEX_DIGIT), "replacingMoreBitsThanGenerated");
-
-        // Makes assumption that 1 digit = 4 bits.
-        std::vector<uint8_t> bytes(ceil(numDigits / 2.0));
-        std::generate(bytes.begin(), bytes.end(), std::ref(ibe));
-
-        // Replace the specified number of bits from the first byte.
-        bytes.at(0) &= (0xff >> numReplacementBits);
-        replacementBits &= (0xff << (MAX_NUM_REPLACEMENT_BITS - numReplacementBits));
-        bytes.at(0) |= replacementBits;
-
-        std::ostringstream oss;
-        for (const auto& byte : bytes) {
-            oss << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(byte);
+class RandomGenerator {
+public:
+    RandomGenerator() {
+        // seed from the random device, the clock and the thread, so threads started at the
+        // same time do not share a sequence even if the random device is deterministic
+        std::random_device rd;
+        uint64_t seed = (static_cast<uint64_t>(rd()) << 32) ^ rd();
+        seed ^= static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        seed ^= static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) << 16;
+        seed ^= static_cast<uint64_t>(reinterpret_cast<uintptr_t>(this));
+
+        // expand the seed with splitmix64, which never produces the all zero state
+        for (auto& word : m_state) {
+            seed += 0x9e3779b97f4a7c15ULL;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            word = z ^ (z >> 31);
         }
+    }
+
+    uint64_t next() {
+        const uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+        const uint64_t t = m_state[1] << 17;
 
-        std::string bytesText = oss.str();
-        // Remove the last digit for odd numDigits case.
-        bytesText.resize(numDigits);
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
 
-        return bytesText;
-    } catch (std::exception& ex) {
-        AACE_ERROR(LX(TAG, "generateHexWithReplacement").d("reason", ex.what()));
-        return std::string();
+        return result;
     }
+
+private:
+    static uint64_t rotl(uint64_t value, int shift) {
+        return (value << shift) | (value >> (64 - shift));
+    }
+
+private:
+    uint64_t m_state[4];
+};
+
+/**
+ * Writes @c count hex digits of @c value, starting at the most significant digit of the @c count digits.
+ */
+static char* writeHex(char* buffer, uint64_t value, int count) {
+    for (int shift = (count - 1) * 4; shift >= 0; shift -= 4) {
+        *buffer++ = HEX_DIGITS[(value >> shift) & 0xf];
+    }
+    return buffer;
 }
 
 /**
- * Randomly generate a string of hex digits.
- *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
+ * Converts a hex digit to its value.
  *
- * @return A hex string of length @c numDigits.
+ * @return The value of the digit, or -1 if @c c is not a hex digit.
  */
-static const std::string generateHex(
-    std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t>& ibe,
-    unsigned int numDigits) {
-    return generateHexWithReplacement(ibe, numDigits, 0, 0);
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
 }
 
-const std::string generateUUID() {
-    static bool seeded = false;
-    static std::independent_bits_engine<std::default_random_engine, CHAR_BIT, uint8_t> ibe;
-    static std::mutex mutex;
-    std::unique_lock<std::mutex> lock(mutex);
-    if (!seeded) {
-        std::random_device rd;
-        ibe.seed(
-            rd() +
-            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
-                .count());
-        seeded = true;
+Uuid Uuid::generate() {
+    static thread_local RandomGenerator generator;
+
+    uint64_t high = generator.next();
+    uint64_t low = generator.next();
+
+    high = (high & ~UUID_VERSION_MASK) | UUID_VERSION_VALUE;
+    low = (low & ~UUID_VARIANT_MASK) | UUID_VARIANT_VALUE;
+
+    return Uuid(high, low);
+}
+
+bool Uuid::fromString(const std::string& text, Uuid& uuid) {
+    if (text.size() != STRING_LENGTH) {
+        return false;
     }
 
-    std::ostringstream uuidText;
-    uuidText << generateHex(ibe, 8) << SEPARATOR << generateHex(ibe, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VERSION_VALUE, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VARIANT_VALUE, 2) << SEPARATOR << generateHex(ibe, 12);
+    uint64_t words[2] = {0, 0};
+    size_t digits = 0;
 
-    lock.unlock();
+    for (size_t j = 0; j < STRING_LENGTH; j++) {
+        if (j == 8 || j == 13 || j == 18 || j == 23) {
+            if (text[j] != '-') {
+                return false;
+            }
+            continue;
+        }
+        int value = hexValue(text[j]);
+        if (value < 0) {
+            return false;
+        }
+        auto& word = words[digits / 16];
+        word = (word << 4) | static_cast<uint64_t>(value);
+        digits++;
+    }
 
-    return uuidText.str();
+    uuid = Uuid(words[0], words[1]);
+
+    return true;
+}
+
+void Uuid::toString(char* buffer) const {
+    // xxxxxxxx-xxxx-Mxxx-Nxxx-xxxxxxxxxxxx
+    buffer = writeHex(buffer, m_high >> 32, 8);
+    *buffer++ = '-';
+    buffer = writeHex(buffer, m_high >> 16, 4);
+    *buffer++ = '-';
+    buffer = writeHex(buffer, m_high, 4);
+    *buffer++ = '-';
+    buffer = writeHex(buffer, m_low >> 48, 4);
+    *buffer++ = '-';
+    writeHex(buffer, m_low, 12);
+}
+
+std::string Uuid::toString() const {
+    char buffer[STRING_LENGTH];
+    toString(buffer);
+    return std::string(buffer, STRING_LENGTH);
+}
+
+const std::string generateUUID() {
+    return Uuid::generate().toString();
 }
 
 bool compare(const std::string& uuid1, const std::string& uuid2) {
-    return std::equal(uuid1.begin(), uuid1.end(), uuid2.begin(), [](unsigned char a, unsigned char b) -> bool {
-        return std::toupper(a) == std::toupper(b);
-    });
+    return uuid1.size() == uuid2.size() &&
+           std::equal(uuid1.begin(), uuid1.end(), uuid2.begin(), [](unsigned char a, unsigned char b) -> bool {
+               return std::toupper(a) == std::toupper(b);
+           });
 }
 
 }  // namespace uuid
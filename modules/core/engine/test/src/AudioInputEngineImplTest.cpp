@@ -0,0 +1,157 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <AACE/Audio/AudioInput.h>
+#include <AACE/Engine/Audio/AudioInputEngineImpl.h>
+
+namespace aace {
+namespace test {
+namespace audio {
+
+using aace::engine::audio::AudioInputChannelInterface;
+using aace::engine::audio::AudioInputEngineImpl;
+
+/// Copy of @c AudioInputChannelInterface::INVALID_CHANNEL that can be passed by reference
+static const AudioInputChannelInterface::ChannelId INVALID_CHANNEL = AudioInputChannelInterface::INVALID_CHANNEL;
+
+/// Platform audio input that accepts every start and stop request
+class TestAudioInput : public aace::audio::AudioInput {
+public:
+    bool startAudioInput() override {
+        return true;
+    }
+
+    bool stopAudioInput() override {
+        return true;
+    }
+};
+
+/// Test harness for @c AudioInputEngineImpl class
+class AudioInputEngineImplTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_platformAudioInput = std::make_shared<TestAudioInput>();
+        m_audioInputEngineImpl = AudioInputEngineImpl::create(m_platformAudioInput);
+        ASSERT_NE(nullptr, m_audioInputEngineImpl);
+    }
+
+    void TearDown() override {
+        m_audioInputEngineImpl->doShutdown();
+    }
+
+protected:
+    std::shared_ptr<TestAudioInput> m_platformAudioInput;
+    std::shared_ptr<AudioInputEngineImpl> m_audioInputEngineImpl;
+};
+
+/**
+ * Test that the audio written to the engine is delivered to every started channel.
+ */
+TEST_F(AudioInputEngineImplTest, writeDeliversToStartedChannels) {
+    std::atomic<size_t> first(0);
+    std::atomic<size_t> second(0);
+
+    auto firstId = m_audioInputEngineImpl->start([&first](const int16_t*, const size_t size) { first += size; });
+    auto secondId = m_audioInputEngineImpl->start([&second](const int16_t*, const size_t size) { second += size; });
+    ASSERT_NE(INVALID_CHANNEL, firstId);
+    ASSERT_NE(INVALID_CHANNEL, secondId);
+
+    int16_t samples[160] = {};
+    EXPECT_EQ(160, m_audioInputEngineImpl->write(samples, 160));
+    EXPECT_EQ(160u, first.load());
+    EXPECT_EQ(160u, second.load());
+
+    EXPECT_TRUE(m_audioInputEngineImpl->stop(firstId));
+    EXPECT_EQ(160, m_audioInputEngineImpl->write(samples, 160));
+    EXPECT_EQ(160u, first.load());
+    EXPECT_EQ(320u, second.load());
+
+    EXPECT_TRUE(m_audioInputEngineImpl->stop(secondId));
+    EXPECT_FALSE(m_audioInputEngineImpl->stop(secondId));
+}
+
+/**
+ * Test that the callback of a channel is not executed after stop() returns, while other threads
+ * keep writing audio.
+ */
+TEST_F(AudioInputEngineImplTest, noCallbackAfterStopReturns) {
+    std::atomic<bool> running(true);
+    std::vector<std::thread> writers;
+    for (int j = 0; j < 4; j++) {
+        writers.emplace_back([this, &running]() {
+            int16_t samples[160] = {};
+            while (running) {
+                m_audioInputEngineImpl->write(samples, 160);
+            }
+        });
+    }
+
+    for (int j = 0; j < 100; j++) {
+        std::atomic<bool> stopped(false);
+        std::atomic<int> lateCallbacks(0);
+
+        auto id = m_audioInputEngineImpl->start([&stopped, &lateCallbacks](const int16_t*, const size_t) {
+            if (stopped) {
+                lateCallbacks++;
+            }
+        });
+        ASSERT_NE(INVALID_CHANNEL, id);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ASSERT_TRUE(m_audioInputEngineImpl->stop(id));
+        stopped = true;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        EXPECT_EQ(0, lateCallbacks.load());
+    }
+
+    running = false;
+    for (auto& next : writers) {
+        next.join();
+    }
+}
+
+/**
+ * Test that a callback can stop its own channel from inside write() without waiting for itself.
+ */
+TEST_F(AudioInputEngineImplTest, stopFromCallback) {
+    AudioInputChannelInterface::ChannelId id = INVALID_CHANNEL;
+    int count = 0;
+
+    id = m_audioInputEngineImpl->start([this, &id, &count](const int16_t*, const size_t) {
+        count++;
+        EXPECT_TRUE(m_audioInputEngineImpl->stop(id));
+    });
+    ASSERT_NE(INVALID_CHANNEL, id);
+
+    int16_t samples[160] = {};
+    EXPECT_EQ(160, m_audioInputEngineImpl->write(samples, 160));
+    EXPECT_EQ(160, m_audioInputEngineImpl->write(samples, 160));
+    EXPECT_EQ(1, count);
+
+    // the snapshot released by the callback is reclaimed by the next update
+    auto otherId = m_audioInputEngineImpl->start([](const int16_t*, const size_t) {});
+    EXPECT_TRUE(m_audioInputEngineImpl->stop(otherId));
+}
+
+}  // namespace audio
+}  // namespace test
+}  // namespace aace
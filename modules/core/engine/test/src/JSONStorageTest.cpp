@@ -0,0 +1,291 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <sys/resource.h>
+#include <sys/stat.h>
+
+#include "AACE/Engine/Storage/JSONStorage.h"
+
+namespace aace {
+namespace engine {
+namespace test {
+namespace storage {
+
+using aace::engine::storage::JSONStorage;
+
+/// Limits the size of the files written by the process while it is in scope, so writes past the limit fail
+class FileSizeLimit {
+public:
+    FileSizeLimit(size_t size) {
+        m_handler = std::signal(SIGXFSZ, SIG_IGN);
+        getrlimit(RLIMIT_FSIZE, &m_limit);
+
+        struct rlimit limit = m_limit;
+        limit.rlim_cur = size;
+        setrlimit(RLIMIT_FSIZE, &limit);
+    }
+
+    ~FileSizeLimit() {
+        setrlimit(RLIMIT_FSIZE, &m_limit);
+        std::signal(SIGXFSZ, m_handler);
+    }
+
+private:
+    struct rlimit m_limit;
+    void (*m_handler)(int);
+};
+
+/// Test harness for @c JSONStorage class
+class JSONStorageTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_path = "JSONStorageTest.json";
+        m_journalPath = m_path + ".journal";
+        removeFiles();
+    }
+
+    void TearDown() override {
+        removeFiles();
+    }
+
+protected:
+    void removeFiles() {
+        std::remove(m_path.c_str());
+        std::remove(m_journalPath.c_str());
+        std::remove((m_path + ".tmp").c_str());
+    }
+
+    static std::string readFile(const std::string& path) {
+        std::ifstream is(path);
+        std::stringstream contents;
+        contents << is.rdbuf();
+        return contents.str();
+    }
+
+    static void writeFile(const std::string& path, const std::string& contents) {
+        std::ofstream os(path, std::ios::trunc);
+        os << contents;
+    }
+
+    std::string m_path;
+    std::string m_journalPath;
+};
+
+/**
+ * Test that the changes written to the journal are replayed when the storage is created again,
+ * and that the journal is compacted into the snapshot when it is loaded.
+ */
+TEST_F(JSONStorageTest, replayJournal) {
+    {
+        auto storage = JSONStorage::create(m_path);
+        ASSERT_NE(nullptr, storage);
+
+        EXPECT_TRUE(storage->put("table", "a", "1"));
+        EXPECT_TRUE(storage->put("table", "b", "2"));
+        EXPECT_TRUE(storage->put("table", "a", "3"));
+        EXPECT_TRUE(storage->removeKey("table", "b"));
+        EXPECT_TRUE(storage->put("removed", "key", "value"));
+        EXPECT_TRUE(storage->removeTable("removed"));
+    }
+
+    EXPECT_FALSE(readFile(m_journalPath).empty());
+
+    auto storage = JSONStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+
+    EXPECT_EQ("3", storage->get("table", "a"));
+    EXPECT_FALSE(storage->containsKey("table", "b"));
+    EXPECT_FALSE(storage->containsTable("removed"));
+
+    EXPECT_TRUE(readFile(m_journalPath).empty());
+    EXPECT_NE(std::string::npos, readFile(m_path).find("\"a\""));
+}
+
+/**
+ * Test that a partially written batch at the end of the journal is discarded, and that the
+ * batches before it are replayed.
+ */
+TEST_F(JSONStorageTest, discardPartialBatch) {
+    writeFile(m_path, "{}");
+    writeFile(
+        m_journalPath,
+        "[{\"op\":\"put\",\"table\":\"table\",\"key\":\"a\",\"value\":\"1\"}]\n"
+        "[{\"op\":\"put\",\"table\":\"table\",\"key\":\"b\",\"val");
+
+    {
+        auto storage = JSONStorage::create(m_path);
+        ASSERT_NE(nullptr, storage);
+
+        EXPECT_EQ("1", storage->get("table", "a"));
+        EXPECT_FALSE(storage->containsKey("table", "b"));
+
+        EXPECT_TRUE(storage->put("table", "c", "2"));
+    }
+
+    auto storage = JSONStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+
+    EXPECT_EQ("1", storage->get("table", "a"));
+    EXPECT_FALSE(storage->containsKey("table", "b"));
+    EXPECT_EQ("2", storage->get("table", "c"));
+}
+
+/**
+ * Test that the journal is compacted into the snapshot when it grows larger than the snapshot.
+ */
+TEST_F(JSONStorageTest, compactJournal) {
+    const std::string value(1024, 'x');
+
+    auto storage = JSONStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+
+    // the writer thread appends the changes to the journal, and then compacts it
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(storage->put("table", "key" + std::to_string(i), value));
+    }
+
+    // the journal is empty before the first batch is written, so also wait for the snapshot to have the changes
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while ((readFile(m_path).find("\"key99\"") == std::string::npos || readFile(m_journalPath).empty() == false) &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_TRUE(readFile(m_journalPath).empty());
+    EXPECT_NE(std::string::npos, readFile(m_path).find("\"key99\""));
+
+    storage.reset();
+
+    storage = JSONStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+    EXPECT_EQ(100u, storage->keys("table").size());
+    EXPECT_EQ(value, storage->get("table", "key0"));
+}
+
+/**
+ * Test that the changes made in a cancelled transaction are not written to the journal.
+ */
+TEST_F(JSONStorageTest, cancelTransaction) {
+    {
+        auto storage = JSONStorage::create(m_path);
+        ASSERT_NE(nullptr, storage);
+
+        EXPECT_TRUE(storage->put("table", "a", "1"));
+        ASSERT_TRUE(storage->begin());
+        EXPECT_TRUE(storage->put("table", "a", "2"));
+        EXPECT_TRUE(storage->put("table", "b", "2"));
+        ASSERT_TRUE(storage->cancel());
+
+        EXPECT_EQ("1", storage->get("table", "a"));
+        EXPECT_FALSE(storage->containsKey("table", "b"));
+    }
+
+    auto storage = JSONStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+
+    EXPECT_EQ("1", storage->get("table", "a"));
+    EXPECT_FALSE(storage->containsKey("table", "b"));
+}
+
+/**
+ * Test that a batch that is partially written to the journal is truncated, so the batches written after it
+ * are replayed, and that the changes in the failed batch are kept by the next snapshot.
+ */
+TEST_F(JSONStorageTest, truncateFailedAppend) {
+    {
+        auto storage = JSONStorage::create(m_path);
+        ASSERT_NE(nullptr, storage);
+
+        ASSERT_TRUE(storage->begin());
+        EXPECT_TRUE(storage->put("table", "a", "1"));
+        ASSERT_TRUE(storage->commit());
+
+        auto journal = readFile(m_journalPath);
+        ASSERT_FALSE(journal.empty());
+
+        {
+            // only the start of the next batch fits in the journal
+            FileSizeLimit limit(journal.size() + 16);
+
+            ASSERT_TRUE(storage->begin());
+            EXPECT_TRUE(storage->put("table", "b", std::string(1024, 'x')));
+            EXPECT_FALSE(storage->commit());
+
+            EXPECT_EQ(journal, readFile(m_journalPath));
+        }
+
+        ASSERT_TRUE(storage->begin());
+        EXPECT_TRUE(storage->put("table", "c", "3"));
+        EXPECT_TRUE(storage->commit());
+    }
+
+    auto storage = JSONStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+
+    EXPECT_EQ("1", storage->get("table", "a"));
+    EXPECT_EQ(std::string(1024, 'x'), storage->get("table", "b"));
+    EXPECT_EQ("3", storage->get("table", "c"));
+}
+
+/**
+ * Test that the journal is not truncated when the snapshot cannot be replaced, so the changes are
+ * replayed from the journal.
+ */
+TEST_F(JSONStorageTest, keepJournalWhenSnapshotNotReplaced) {
+    const std::string value(1024, 'x');
+
+    {
+        auto storage = JSONStorage::create(m_path);
+        ASSERT_NE(nullptr, storage);
+
+        // the temp file cannot be renamed over a directory
+        ASSERT_EQ(0, std::remove(m_path.c_str()));
+        ASSERT_EQ(0, mkdir(m_path.c_str(), 0777));
+
+        for (int i = 0; i < 100; i++) {
+            ASSERT_TRUE(storage->put("table", "key" + std::to_string(i), value));
+        }
+
+        // the journal is written before the temp file is created for the new snapshot
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (std::ifstream(m_path + ".tmp").good() == false && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    EXPECT_NE(std::string::npos, readFile(m_journalPath).find("\"key99\""));
+
+    ASSERT_EQ(0, std::remove(m_path.c_str()));
+    writeFile(m_path, "{}");
+
+    auto storage = JSONStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+    EXPECT_EQ(100u, storage->keys("table").size());
+    EXPECT_EQ(value, storage->get("table", "key99"));
+}
+
+}  // namespace storage
+}  // namespace test
+}  // namespace engine
+}  // namespace aace
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AACE/Engine/Metrics/MetricRecorder.h>
+#include <AACE/Engine/Utils/Metrics/Metrics.h>
+
+namespace aace {
+namespace test {
+namespace metrics {
+
+using aace::engine::metrics::MetricEvent;
+using aace::engine::metrics::MetricRecorder;
+using aace::engine::metrics::MetricSinkInterface;
+
+/// Metric sink that sums the counters it receives by name
+class TestMetricSink : public MetricSinkInterface {
+public:
+    void record(const MetricEvent& metricEvent) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& datapoint : metricEvent.getDatapoints()) {
+            if (datapoint.type == MetricEvent::MetricDataType::CT) {
+                m_counters[datapoint.name] += std::stoi(datapoint.value);
+                m_samples[datapoint.name] += datapoint.sampleCount;
+            }
+        }
+    }
+
+    int getCounter(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_counters[name];
+    }
+
+    int getSamples(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_samples[name];
+    }
+
+private:
+    std::mutex m_mutex;
+    std::map<std::string, int> m_counters;
+    std::map<std::string, int> m_samples;
+};
+
+/// Test harness for @c MetricRecorder class
+class MetricRecorderTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_sink = std::make_shared<TestMetricSink>();
+        MetricRecorder::getInstance()->setSink(m_sink);
+    }
+
+    void TearDown() override {
+        MetricRecorder::getInstance()->setSink(nullptr);
+    }
+
+protected:
+    std::shared_ptr<TestMetricSink> m_sink;
+};
+
+/**
+ * Test that the counters incremented by threads that already exited are delivered by the next flush.
+ */
+TEST_F(MetricRecorderTest, countersOfExitedThreadsAreFlushed) {
+    auto recorder = MetricRecorder::getInstance();
+    auto counter = recorder->registerCounter("MetricRecorderTest", "exitedThreads", "Exited");
+    ASSERT_NE(MetricRecorder::INVALID_COUNTER, counter);
+
+    std::vector<std::thread> threads;
+    for (int j = 0; j < 4; j++) {
+        threads.emplace_back([recorder, counter]() {
+            for (int k = 0; k < 100; k++) {
+                recorder->incrementCounter(counter, 2);
+            }
+        });
+    }
+    for (auto& next : threads) {
+        next.join();
+    }
+
+    recorder->flush();
+    EXPECT_EQ(800, m_sink->getCounter("Exited"));
+    EXPECT_EQ(400, m_sink->getSamples("Exited"));
+
+    // the counts are delivered only once
+    recorder->flush();
+    EXPECT_EQ(800, m_sink->getCounter("Exited"));
+}
+
+/**
+ * Test that the string based counter functions aggregate the datapoints of the same counter.
+ */
+TEST_F(MetricRecorderTest, stringCountersAreAggregated) {
+    using namespace aace::engine::utils::metrics;
+
+    for (int j = 0; j < 10; j++) {
+        emitCounterMetrics("MetricRecorderTest", "stringCounters", {"First", "Second"});
+        emitCounterMetrics("MetricRecorderTest", "stringCounters", "Second", 2);
+    }
+
+    MetricRecorder::getInstance()->flush();
+    EXPECT_EQ(10, m_sink->getCounter("First"));
+    EXPECT_EQ(30, m_sink->getCounter("Second"));
+    EXPECT_EQ(20, m_sink->getSamples("Second"));
+}
+
+}  // namespace metrics
+}  // namespace test
+}  // namespace aace
@@ -0,0 +1,228 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <sqlite3.h>
+
+#include "AACE/Engine/Storage/SQLiteStorage.h"
+
+namespace aace {
+namespace engine {
+namespace test {
+namespace storage {
+
+using aace::engine::storage::SQLiteStorage;
+
+/// Test harness for @c SQLiteStorage class
+class SQLiteStorageTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_path = "SQLiteStorageTest.db";
+        removeDatabase();
+    }
+
+    void TearDown() override {
+        if (m_connection != nullptr) {
+            sqlite3_close(m_connection);
+        }
+        removeDatabase();
+    }
+
+protected:
+    void removeDatabase() {
+        std::remove(m_path.c_str());
+        std::remove((m_path + "-wal").c_str());
+        std::remove((m_path + "-shm").c_str());
+    }
+
+    // reads a value with a second connection, which only sees committed writes
+    std::string readCommitted(const std::string& table, const std::string& key) {
+        if (m_connection == nullptr) {
+            EXPECT_EQ(SQLITE_OK, sqlite3_open(m_path.c_str(), &m_connection));
+        }
+
+        std::string value;
+        sqlite3_stmt* stmt = nullptr;
+        auto sql = "SELECT value FROM \"" + table + "\" WHERE key=?;";
+        if (sqlite3_prepare_v2(m_connection, sql.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+            sqlite3_bind_text(stmt, 1, key.c_str(), -1, SQLITE_TRANSIENT);
+            if (sqlite3_step(stmt) == SQLITE_ROW) {
+                value = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+            }
+        }
+        sqlite3_finalize(stmt);
+
+        return value;
+    }
+
+    // writes a value with a second connection, bypassing the read cache
+    void writeCommitted(const std::string& table, const std::string& key, const std::string& value) {
+        if (m_connection == nullptr) {
+            ASSERT_EQ(SQLITE_OK, sqlite3_open(m_path.c_str(), &m_connection));
+        }
+
+        auto sql = "UPDATE \"" + table + "\" SET value='" + value + "' WHERE key='" + key + "';";
+        ASSERT_EQ(SQLITE_OK, sqlite3_exec(m_connection, sql.c_str(), nullptr, nullptr, nullptr));
+    }
+
+    std::string m_path;
+    sqlite3* m_connection = nullptr;
+};
+
+/**
+ * Test that the cached statements of a table work for repeated operations, and are prepared
+ * again when the table is removed and created again.
+ */
+TEST_F(SQLiteStorageTest, cachedStatements) {
+    auto storage = SQLiteStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+
+    for (int j = 0; j < 3; j++) {
+        for (int i = 0; i < 10; i++) {
+            ASSERT_TRUE(storage->put("table", "key" + std::to_string(i), std::to_string(i + j)));
+        }
+        for (int i = 0; i < 10; i++) {
+            EXPECT_EQ(std::to_string(i + j), storage->get("table", "key" + std::to_string(i)));
+        }
+    }
+
+    EXPECT_TRUE(storage->removeKey("table", "key0"));
+    EXPECT_FALSE(storage->containsKey("table", "key0"));
+    EXPECT_EQ(9u, storage->keys("table").size());
+    EXPECT_EQ(9u, storage->list("table").size());
+
+    EXPECT_TRUE(storage->removeTable("table"));
+    EXPECT_FALSE(storage->containsTable("table"));
+
+    ASSERT_TRUE(storage->put("table", "key", "value"));
+    EXPECT_EQ("value", storage->get("table", "key"));
+    EXPECT_EQ(1u, storage->list("table").size());
+}
+
+/**
+ * Test that writes made outside of an explicit transaction are committed after the maximum
+ * number of batched writes.
+ */
+TEST_F(SQLiteStorageTest, implicitTransactionCommittedAfterMaxWrites) {
+    auto storage = SQLiteStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+
+    // creating the table is the first write of the batch
+    for (int i = 0; i < 63; i++) {
+        ASSERT_TRUE(storage->put("table", "key" + std::to_string(i), "value"));
+    }
+
+    EXPECT_EQ("value", readCommitted("table", "key62"));
+}
+
+/**
+ * Test that writes made outside of an explicit transaction are committed after a delay.
+ */
+TEST_F(SQLiteStorageTest, implicitTransactionCommittedAfterDelay) {
+    auto storage = SQLiteStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+
+    ASSERT_TRUE(storage->put("table", "key", "value"));
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (readCommitted("table", "key").empty() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ("value", readCommitted("table", "key"));
+}
+
+/**
+ * Test that the batched writes are committed when an explicit transaction begins, and that the
+ * read cache is reset when the transaction is cancelled.
+ */
+TEST_F(SQLiteStorageTest, readCacheResetOnCancel) {
+    auto storage = SQLiteStorage::create(m_path, true);
+    ASSERT_NE(nullptr, storage);
+
+    ASSERT_TRUE(storage->put("table", "key", "committed"));
+
+    ASSERT_TRUE(storage->begin());
+    EXPECT_EQ("committed", readCommitted("table", "key"));
+
+    ASSERT_TRUE(storage->put("table", "key", "cancelled"));
+    ASSERT_TRUE(storage->put("table", "other", "cancelled"));
+    EXPECT_EQ("cancelled", storage->get("table", "key"));
+    ASSERT_TRUE(storage->cancel());
+
+    EXPECT_EQ("committed", storage->get("table", "key"));
+    EXPECT_FALSE(storage->containsKey("table", "other"));
+}
+
+/**
+ * Test that the read cache serves repeated reads, and evicts the least recently used values
+ * when it is full.
+ */
+TEST_F(SQLiteStorageTest, readCacheEvictsLeastRecentlyUsed) {
+    auto storage = SQLiteStorage::create(m_path, true, 2);
+    ASSERT_NE(nullptr, storage);
+
+    ASSERT_TRUE(storage->put("table", "a", "1"));
+    ASSERT_TRUE(storage->put("table", "b", "1"));
+    ASSERT_TRUE(storage->begin());
+    ASSERT_TRUE(storage->commit());
+
+    // change the values behind the cache
+    writeCommitted("table", "a", "2");
+    writeCommitted("table", "b", "2");
+
+    EXPECT_EQ("1", storage->get("table", "a"));
+    EXPECT_EQ("1", storage->get("table", "b"));
+
+    // "a" is the least recently used value, so it is evicted when "c" is cached
+    ASSERT_TRUE(storage->put("table", "c", "1"));
+
+    EXPECT_EQ("2", storage->get("table", "a"));
+    EXPECT_EQ("1", storage->get("table", "c"));
+}
+
+/**
+ * Test that a write waits for another connection to release its lock on the database instead of
+ * failing right away.
+ */
+TEST_F(SQLiteStorageTest, writeWaitsForOtherConnection) {
+    auto storage = SQLiteStorage::create(m_path);
+    ASSERT_NE(nullptr, storage);
+
+    ASSERT_EQ(SQLITE_OK, sqlite3_open(m_path.c_str(), &m_connection));
+    ASSERT_EQ(SQLITE_OK, sqlite3_exec(m_connection, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr));
+
+    std::thread other([this]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        sqlite3_exec(m_connection, "COMMIT;", nullptr, nullptr, nullptr);
+    });
+
+    EXPECT_TRUE(storage->put("table", "key", "value"));
+    other.join();
+
+    ASSERT_TRUE(storage->begin());
+    ASSERT_TRUE(storage->commit());
+    EXPECT_EQ("value", readCommitted("table", "key"));
+}
+
+}  // namespace storage
+}  // namespace test
+}  // namespace engine
+}  // namespace aace
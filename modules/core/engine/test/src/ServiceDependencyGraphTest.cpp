@@ -0,0 +1,182 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <AACE/Engine/Core/ServiceDependencyGraph.h>
+
+namespace aace {
+namespace engine {
+namespace test {
+namespace core {
+
+using aace::engine::core::ServiceDependencyGraph;
+using aace::engine::core::ServiceDescription;
+using aace::engine::core::Version;
+
+/// Test harness for @c ServiceDependencyGraph class
+class ServiceDependencyGraphTest : public ::testing::Test {
+protected:
+    static ServiceDescription describe(
+        const std::string& type,
+        std::initializer_list<ServiceDescription> dependencies = {}) {
+        return ServiceDescription(type, Version(1, 0, 0), dependencies);
+    }
+
+    /// Returns the types of the services in the start order of the graph.
+    static std::vector<std::string> getStartTypes(
+        const ServiceDependencyGraph& graph,
+        const std::vector<ServiceDescription>& descriptions) {
+        std::vector<std::string> types;
+        for (auto index : graph.getStartOrder()) {
+            types.push_back(descriptions[index].getType());
+        }
+        return types;
+    }
+
+    /// Returns the types of the services in the stop order of the graph.
+    static std::vector<std::string> getStopTypes(
+        const ServiceDependencyGraph& graph,
+        const std::vector<ServiceDescription>& descriptions) {
+        auto startTypes = getStartTypes(graph, descriptions);
+        std::vector<std::string> types;
+        for (auto position : graph.getStopOrder()) {
+            types.push_back(startTypes[position]);
+        }
+        return types;
+    }
+
+    /// Returns the position of @c type in @c types.
+    static std::ptrdiff_t positionOf(const std::vector<std::string>& types, const std::string& type) {
+        return std::find(types.begin(), types.end(), type) - types.begin();
+    }
+
+    /// A, D and E before B and C: C depends on B, B depends on A, and E depends on A and D
+    std::vector<ServiceDescription> createServices() {
+        auto a = describe("A");
+        auto b = describe("B", {a});
+        auto d = describe("D");
+        return {describe("C", {b}), b, a, d, describe("E", {a, d})};
+    }
+};
+
+/**
+ * Test that each service is started after the services it depends on, and that services whose dependencies
+ * are already started keep their registration order.
+ */
+TEST_F(ServiceDependencyGraphTest, startOrderFollowsDependencies) {
+    auto descriptions = createServices();
+    auto graph = ServiceDependencyGraph::create(descriptions);
+    ASSERT_NE(nullptr, graph);
+
+    auto types = getStartTypes(*graph, descriptions);
+    ASSERT_EQ(descriptions.size(), types.size());
+    EXPECT_EQ(std::vector<std::string>({"A", "D", "E", "B", "C"}), types);
+
+    for (const auto& description : descriptions) {
+        for (const auto& dependency : description.getDependencies()) {
+            EXPECT_LT(positionOf(types, dependency.getType()), positionOf(types, description.getType()))
+                << description.getType() << " starts before " << dependency.getType();
+        }
+    }
+}
+
+/**
+ * Test that the services are stopped in the reverse of the start order, so each service is stopped before the
+ * services it depends on.
+ */
+TEST_F(ServiceDependencyGraphTest, stopOrderIsReversed) {
+    auto descriptions = createServices();
+    auto graph = ServiceDependencyGraph::create(descriptions);
+    ASSERT_NE(nullptr, graph);
+
+    auto types = getStopTypes(*graph, descriptions);
+    EXPECT_EQ(std::vector<std::string>({"C", "B", "E", "D", "A"}), types);
+
+    for (const auto& description : descriptions) {
+        for (const auto& dependency : description.getDependencies()) {
+            EXPECT_LT(positionOf(types, description.getType()), positionOf(types, dependency.getType()))
+                << description.getType() << " stops after " << dependency.getType();
+        }
+    }
+}
+
+/**
+ * Test that the dependents and dependency counts used to run a lifecycle phase concurrently refer to positions
+ * in the start order.
+ */
+TEST_F(ServiceDependencyGraphTest, dependentsReferToStartPositions) {
+    auto descriptions = createServices();
+    auto graph = ServiceDependencyGraph::create(descriptions);
+    ASSERT_NE(nullptr, graph);
+
+    // start order is A, D, E, B, C
+    EXPECT_EQ(std::vector<std::size_t>({0, 0, 2, 1, 1}), graph->getDependencyCounts());
+    EXPECT_EQ(std::vector<std::size_t>({2, 3}), graph->getDependents(0));
+    EXPECT_EQ(std::vector<std::size_t>({2}), graph->getDependents(1));
+    EXPECT_TRUE(graph->getDependents(2).empty());
+    EXPECT_EQ(std::vector<std::size_t>({4}), graph->getDependents(3));
+    EXPECT_TRUE(graph->getDependents(4).empty());
+}
+
+/**
+ * Test that services that depend on each other, directly or through other services, are rejected.
+ */
+TEST_F(ServiceDependencyGraphTest, cyclesAreRejected) {
+    // A and B depend on each other
+    EXPECT_EQ(
+        nullptr, ServiceDependencyGraph::create({describe("A", {describe("B")}), describe("B", {describe("A")})}));
+
+    // A depends on itself
+    EXPECT_EQ(nullptr, ServiceDependencyGraph::create({describe("C"), describe("A", {describe("A")})}));
+
+    // A, B and C form a cycle that D depends on
+    EXPECT_EQ(
+        nullptr,
+        ServiceDependencyGraph::create({describe("A", {describe("C")}),
+                                        describe("B", {describe("A")}),
+                                        describe("C", {describe("B")}),
+                                        describe("D", {describe("A")}),
+                                        describe("E")}));
+}
+
+/**
+ * Test that a service with a missing dependency, or a dependency with a lower version than required, is rejected.
+ */
+TEST_F(ServiceDependencyGraphTest, unresolvedDependenciesAreRejected) {
+    EXPECT_EQ(nullptr, ServiceDependencyGraph::create({describe("A"), describe("B", {describe("Missing")})}));
+
+    auto required = ServiceDescription("A", Version(2, 0, 0));
+    EXPECT_EQ(nullptr, ServiceDependencyGraph::create({describe("A"), describe("B", {required})}));
+    EXPECT_NE(nullptr, ServiceDependencyGraph::create({describe("A"), describe("B", {describe("A")})}));
+}
+
+/**
+ * Test that an empty set of services has empty start and stop orders.
+ */
+TEST_F(ServiceDependencyGraphTest, noServices) {
+    auto graph = ServiceDependencyGraph::create({});
+    ASSERT_NE(nullptr, graph);
+    EXPECT_TRUE(graph->getStartOrder().empty());
+    EXPECT_TRUE(graph->getStopOrder().empty());
+}
+
+}  // namespace core
+}  // namespace test
+}  // namespace engine
+}  // namespace aace
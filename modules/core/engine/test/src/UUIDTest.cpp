@@ -0,0 +1,211 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cctype>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <AACE/Engine/Utils/UUID/UUID.h>
+
+namespace aace {
+namespace engine {
+namespace test {
+namespace uuid {
+
+using aace::engine::utils::uuid::Uuid;
+
+/// The number of UUIDs generated by the tests that check for duplicates
+static const int UUID_COUNT = 100000;
+
+/// The number of threads generating UUIDs concurrently
+static const int THREAD_COUNT = 8;
+
+/// Returns @c true if the string is a lower case variant 1, version 4 UUID.
+static bool isVersion4(const std::string& text) {
+    if (text.size() != Uuid::STRING_LENGTH) {
+        return false;
+    }
+    for (size_t j = 0; j < text.size(); j++) {
+        if (j == 8 || j == 13 || j == 18 || j == 23) {
+            if (text[j] != '-') {
+                return false;
+            }
+        } else if (!((text[j] >= '0' && text[j] <= '9') || (text[j] >= 'a' && text[j] <= 'f'))) {
+            return false;
+        }
+    }
+    return text[14] == '4' && std::string("89ab").find(text[19]) != std::string::npos;
+}
+
+/**
+ * Test that generated UUIDs have the version 4 and variant 1 bits set, and that the other bits vary.
+ */
+TEST(UUIDTest, versionAndVariantBits) {
+    std::set<char> variantDigits;
+    std::set<char> versionNeighbours;
+    for (int j = 0; j < 1000; j++) {
+        auto text = Uuid::generate().toString();
+        ASSERT_TRUE(isVersion4(text)) << text;
+        variantDigits.insert(text[19]);
+        versionNeighbours.insert(text[15]);
+    }
+
+    // the two low bits of the variant digit and the digit after the version are random
+    EXPECT_EQ(4u, variantDigits.size());
+    EXPECT_EQ(16u, versionNeighbours.size());
+
+    EXPECT_TRUE(isVersion4(aace::engine::utils::uuid::generateUUID()));
+}
+
+/**
+ * Test that a UUID formatted as a string is parsed back to the same value, in either case.
+ */
+TEST(UUIDTest, stringRoundTrip) {
+    for (int j = 0; j < 100; j++) {
+        auto uuid = Uuid::generate();
+        auto text = uuid.toString();
+
+        Uuid parsed;
+        ASSERT_TRUE(Uuid::fromString(text, parsed)) << text;
+        EXPECT_EQ(uuid, parsed);
+        EXPECT_EQ(text, parsed.toString());
+
+        std::string upper = text;
+        for (auto& c : upper) {
+            c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        }
+        Uuid parsedUpper;
+        ASSERT_TRUE(Uuid::fromString(upper, parsedUpper)) << upper;
+        EXPECT_EQ(uuid, parsedUpper);
+        EXPECT_TRUE(aace::engine::utils::uuid::compare(text, upper));
+    }
+
+    // the digits are ordered from the most significant bits
+    Uuid uuid;
+    ASSERT_TRUE(Uuid::fromString("00112233-4455-6677-8899-AABBCCDDEEFF", uuid));
+    EXPECT_EQ("00112233-4455-6677-8899-aabbccddeeff", uuid.toString());
+
+    char buffer[Uuid::STRING_LENGTH + 1];
+    buffer[Uuid::STRING_LENGTH] = '#';
+    uuid.toString(buffer);
+    EXPECT_EQ("00112233-4455-6677-8899-aabbccddeeff", std::string(buffer, Uuid::STRING_LENGTH));
+    EXPECT_EQ('#', buffer[Uuid::STRING_LENGTH]);
+
+    Uuid nil;
+    EXPECT_TRUE(nil.isNil());
+    EXPECT_EQ("00000000-0000-0000-0000-000000000000", nil.toString());
+    ASSERT_TRUE(Uuid::fromString(nil.toString(), uuid));
+    EXPECT_TRUE(uuid.isNil());
+}
+
+/**
+ * Test that malformed UUID strings are rejected, and do not modify the output UUID.
+ */
+TEST(UUIDTest, malformedStringsAreRejected) {
+    const std::vector<std::string> malformed = {
+        "",
+        "00112233-4455-6677-8899-aabbccddeef",
+        "00112233-4455-6677-8899-aabbccddeeff0",
+        "001122334-455-6677-8899-aabbccddeeff",
+        "00112233-4455-6677-8899_aabbccddeeff",
+        "00112233-4455-6677-8899-aabbccddeefg",
+        "0011223 -4455-6677-8899-aabbccddeeff",
+        "{0112233-4455-6677-8899-aabbccddeef}",
+        "00112233445566778899aabbccddeeff"};
+
+    auto expected = Uuid::generate();
+    for (const auto& text : malformed) {
+        auto uuid = expected;
+        EXPECT_FALSE(Uuid::fromString(text, uuid)) << text;
+        EXPECT_EQ(expected, uuid) << text;
+    }
+
+    EXPECT_FALSE(aace::engine::utils::uuid::compare(
+        "00112233-4455-6677-8899-aabbccddeeff", "00112233-4455-6677-8899-aabbccddee"));
+}
+
+/**
+ * Test that UUIDs generated by concurrent threads, each with its own generator, are unique.
+ */
+TEST(UUIDTest, uniqueAcrossThreads) {
+    std::mutex mutex;
+    std::unordered_set<Uuid> uuids;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([&mutex, &uuids]() {
+            std::vector<Uuid> generated;
+            generated.reserve(UUID_COUNT / THREAD_COUNT);
+            for (int j = 0; j < UUID_COUNT / THREAD_COUNT; j++) {
+                generated.push_back(Uuid::generate());
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            uuids.insert(generated.begin(), generated.end());
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(static_cast<size_t>(UUID_COUNT / THREAD_COUNT * THREAD_COUNT), uuids.size());
+}
+
+/**
+ * Test that each random bit of the generated UUIDs is set about half of the time, so a generator that leaves bits
+ * fixed is caught.
+ */
+TEST(UUIDTest, randomBitsAreBalanced) {
+    const int count = 10000;
+    std::vector<int> ones(128, 0);
+
+    for (int j = 0; j < count; j++) {
+        Uuid uuid;
+        ASSERT_TRUE(Uuid::fromString(Uuid::generate().toString(), uuid));
+        auto text = uuid.toString();
+        int bit = 0;
+        for (auto c : text) {
+            if (c == '-') {
+                continue;
+            }
+            int value = c <= '9' ? c - '0' : c - 'a' + 10;
+            for (int shift = 3; shift >= 0; shift--) {
+                ones[bit++] += (value >> shift) & 1;
+            }
+        }
+    }
+
+    for (int bit = 0; bit < 128; bit++) {
+        // bits 48-51 hold the version 0100, and bits 64-65 hold the variant 10
+        if (bit >= 48 && bit < 52) {
+            EXPECT_EQ(bit == 49 ? count : 0, ones[bit]) << bit;
+        } else if (bit == 64 || bit == 65) {
+            EXPECT_EQ(bit == 64 ? count : 0, ones[bit]) << bit;
+        } else {
+            // about 12 standard deviations from the mean of 5000
+            EXPECT_GT(ones[bit], count / 2 - 600) << bit;
+            EXPECT_LT(ones[bit], count / 2 + 600) << bit;
+        }
+    }
+}
+
+}  // namespace uuid
+}  // namespace test
+}  // namespace engine
+}  // namespace aace
@@ -40,6 +40,9 @@ public:
      * @li 16kHz sample rate
      * @li Single channel
      * @li Little endian byte order
+     *
+     * If the platform captures audio in larger periods, several consecutive chunks can be written
+     * in a single call, which reduces the per-chunk overhead in the Engine.
      * 
      * @param [in] data The audio sample buffer to write
      * @param [in] size The number of samples in the buffer
@@ -45,7 +45,8 @@ public:
         INFO,
 
         /**
-         * Log of a metric, enabled only for builds with metrics enabled
+         * Log of a metric. The Engine delivers its metrics to the metrics uploader directly, and does
+         * not log them with this level.
          */
         METRIC,
 
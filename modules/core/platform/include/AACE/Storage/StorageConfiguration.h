@@ -45,6 +45,14 @@ public:
      * @param [in] localStoragePath The file path to the local storage data file
      * 
      * The database will be created on initialization if it does not already exist.
+     *
+     * The optional @c "readCache" boolean value can be added to the @c "aace.storage" configuration
+     * to keep the values read from the local storage in memory. It is disabled by default. The cache
+     * keeps up to 1024 values, and evicts the least recently used values first.
+     *
+     * Writes to the local storage made outside of an explicit transaction are committed in batches,
+     * after 64 writes or 100 milliseconds, whichever comes first. The writes made in the last 100
+     * milliseconds before a crash or power loss can be lost.
      */
     static std::shared_ptr<aace::core::config::EngineConfiguration> createLocalStorageConfig(
         const std::string& localStoragePath);
@@ -28,6 +28,7 @@
 #include <AVSCommon/SDKInterfaces/MessageSenderInterface.h>
 
 #include "NavigationHandlerInterface.h"
+#include "NavigationState.h"
 
 namespace aace {
 namespace engine {
@@ -87,6 +88,15 @@ public:
         aace::navigation::NavigationEngineInterface::ErrorCode code,
         const std::string& description);
 
+    /**
+     * Update the NavigationState context with state pushed by the platform. After the first update,
+     * the navigation state is no longer requested from the platform for each context request.
+     *
+     * @param [in] navigationState The NavigationState JSON update. Each of the @c state, @c waypoints,
+     *        and @c shapes members present replaces the current value.
+     */
+    void navigationStateChanged(const std::string& navigationState);
+
 private:
     NavigationCapabilityAgent(
         std::shared_ptr<aace::engine::navigation::NavigationHandlerInterface> navigationHandler,
@@ -169,6 +179,16 @@ private:
         const alexaClientSDK::avsCommon::avs::NamespaceAndName& stateProviderName,
         const unsigned int stateRequestToken);
 
+    /**
+     * Executor function for navigationStateChanged
+     */
+    void executeNavigationStateChanged(const std::string& navigationState);
+
+    /**
+     * Returns the NavigationState payload pushed by the platform, or requests it from the platform
+     */
+    std::string getCurrentNavigationState();
+
     // Executor functions for navigation event handling
     void executeNavigationEvent(aace::navigation::NavigationEngineInterface::EventName event);
     void executeNavigationError(
@@ -190,11 +210,6 @@ private:
     void showPreviousWaypointsError(std::string code, std::string description);
     void navigateToPreviousWaypointError(std::string code, std::string description);
 
-    /**
-     * Check Navigation State for validity
-     */
-    bool isNavigationStateValid(std::string navigationState);
-
     /**
      * @name Executor Thread Variables
      *
@@ -218,8 +233,21 @@ private:
 
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::MessageSenderInterface> m_messageSender;
 
-    /// The last known NavigationState payload
-    std::string m_navigationStatePayload;
+    /// The NavigationState context model
+    NavigationState m_navigationState;
+
+    /// Whether the platform pushes the navigation state instead of providing it on request
+    bool m_navigationStatePushed = false;
+
+    /// Whether a navigation state payload has been requested from the platform, whether the last payload
+    /// was valid, and its hash
+    bool m_platformNavigationStateReceived = false;
+    bool m_platformNavigationStateValid = false;
+    size_t m_platformNavigationStateHash = 0;
+
+    /// Whether the NavigationState context has been reported, and the change hash of the reported state
+    bool m_navigationStateReported = false;
+    uint64_t m_reportedNavigationStateHash = 0;
 };
 
 }  // namespace navigation
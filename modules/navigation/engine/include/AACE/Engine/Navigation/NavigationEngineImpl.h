@@ -75,6 +75,7 @@ public:
         aace::navigation::NavigationEngineInterface::ErrorCode code,
         const std::string& description) override;
     void onShowAlternativeRoutesSucceeded(const std::string& payload) override;
+    void onNavigationStateChanged(const std::string& navigationState) override;
 
 protected:
     void doShutdown() override;
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_H
+#define AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aace {
+namespace engine {
+namespace navigation {
+
+/**
+ * The NavigationState context model. The state, waypoints, and route shapes are kept separately so the
+ * platform can replace one of them without resending the others, and a change hash is maintained so
+ * an unchanged state can be detected without comparing or parsing the payload.
+ *
+ * Route shapes that exceed the maximum allowed in context are reduced with Douglas-Peucker polyline
+ * simplification rather than truncated, so the reported shape still spans the whole route.
+ */
+class NavigationState {
+public:
+    /// A route shape coordinate as a latitude, longitude pair in degrees
+    using Coordinate = std::pair<double, double>;
+
+    /// The maximum number of route shapes reported in context
+    static const size_t MAXIMUM_SHAPES_IN_CONTEXT = 3000;
+
+    NavigationState();
+
+    /**
+     * Replaces the navigation state with a complete NavigationState payload, as returned by
+     * @c Navigation::getNavigationState().
+     *
+     * @param [in] payload The NavigationState JSON payload. An empty payload resets the state to
+     *        @c NOT_NAVIGATING with no waypoints or shapes.
+     * @return @c true if the payload is valid; the navigation state is unchanged otherwise
+     */
+    bool setPayload(const std::string& payload);
+
+    /**
+     * Applies a partial NavigationState update. Each of the @c state, @c waypoints, and @c shapes members
+     * present in the update replaces the corresponding member of the navigation state; absent members
+     * are unchanged.
+     *
+     * @param [in] update The NavigationState JSON update
+     * @return @c true if the update is valid; the navigation state is unchanged otherwise
+     */
+    bool update(const std::string& update);
+
+    /**
+     * Returns a hash of the navigation state, which changes whenever the reported payload changes.
+     */
+    uint64_t getChangeHash() const;
+
+    /**
+     * Returns the NavigationState context payload. The payload is serialized when it is first
+     * requested after a change.
+     */
+    const std::string& getPayload();
+
+    /**
+     * Reduces a polyline to at most @c maximumShapes coordinates with Douglas-Peucker simplification,
+     * using the smallest tolerance that satisfies the limit. The first and last coordinates are
+     * always kept.
+     *
+     * @param [in] shapes The polyline coordinates
+     * @param [in] maximumShapes The maximum number of coordinates to keep, which must be at least 2
+     * @return The simplified polyline, or @c shapes if it is within the limit
+     */
+    static std::vector<Coordinate> simplifyShapes(const std::vector<Coordinate>& shapes, size_t maximumShapes);
+
+private:
+    bool apply(const std::string& json, bool complete);
+    void updateChangeHash();
+
+    /// The navigation state: NAVIGATING, NOT_NAVIGATING, or UNKNOWN
+    std::string m_state;
+    /// The serialized waypoints array
+    std::string m_waypoints;
+    /// The route shapes, simplified to at most @c MAXIMUM_SHAPES_IN_CONTEXT coordinates
+    std::vector<Coordinate> m_shapes;
+
+    /// Hashes of each member, so an update only rehashes the members it replaces
+    uint64_t m_stateHash;
+    uint64_t m_waypointsHash;
+    uint64_t m_shapesHash;
+    uint64_t m_changeHash;
+
+    /// The serialized payload, valid while @c m_payloadChanged is @c false
+    std::string m_payload;
+    bool m_payloadChanged;
+};
+
+}  // namespace navigation
+}  // namespace engine
+}  // namespace aace
+
+#endif  // AACE_ENGINE_NAVIGATION_NAVIGATION_STATE_H
@@ -12,6 +12,7 @@
  * express or implied. See the License for the specific language governing
  * permissions and limitations under the License.
  */
+#include <functional>
 #include <iostream>
 
 #include <string>
@@ -61,27 +62,7 @@ static const std::string NAVIGATION_CAPABILITY_INTERFACE_VERSION = "2.0";
 /// Navigation interface provider name key
 static const std::string CAPABILITY_INTERFACE_NAVIGATION_PROVIDER_NAME_KEY = "provider";
 
-/// NavigationState state accepted values
-static const std::string NAVIGATION_STATE_NAVIGATING = "NAVIGATING";
-static const std::string NAVIGATION_STATE_NOT_NAVIGATING = "NOT_NAVIGATING";
-static const std::string NAVIGATION_STATE_UNKNOWN = "UNKNOWN";
-
-// Waypoint Type accepted values
-static const std::string WAYPOINT_TYPE_SOURCE = "SOURCE";
-static const std::string WAYPOINT_TYPE_INTERIM = "INTERIM";
-static const std::string WAYPOINT_TYPE_DESTINATION = "DESTINATION";
-
-/// Default when provided NavigationState is empty
 // clang-format off
-static const std::string DEFAULT_NAVIGATION_STATE_PAYLOAD = R"({
-	"state": ")" + NAVIGATION_STATE_NOT_NAVIGATING + R"(",
-	"waypoints": [],
-	"shapes": []
-})";
-
-//// max number of shapes allowable in context
-static const int MAXIMUM_SHAPES_IN_CONTEXT = 3000;
-
 // Navigation Event Strings
 static const std::string START_NAVIGATION_SUCCESS = "StartNavigationSuccess";
 static const std::string SHOW_PREVIOUS_WAYPOINTS_SUCCESS = "ShowPreviousWaypointsSuccess";
@@ -320,28 +301,39 @@ void NavigationCapabilityAgent::navigationError( aace::navigation::NavigationEng
     });
 }
 
+void NavigationCapabilityAgent::navigationStateChanged( const std::string& navigationState )
+{
+    m_executor.submit( [this, navigationState] {
+        executeNavigationStateChanged( navigationState );
+    });
+}
+
 void NavigationCapabilityAgent::executeProvideState( const alexaClientSDK::avsCommon::avs::NamespaceAndName& stateProviderName, const unsigned int stateRequestToken )
 {
     try
     {
         ThrowIfNull( m_contextManager, "contextManagerIsNull" );
-        bool payloadChanged = false; 
-        std::string payload;
 
-        payload = m_navigationHandler->getNavigationState();
-
-        if( payload.empty() && m_navigationStatePayload.compare(DEFAULT_NAVIGATION_STATE_PAYLOAD) != 0 ) {
-            payload = DEFAULT_NAVIGATION_STATE_PAYLOAD;
-            payloadChanged = true;
-        } else if ( !payload.empty() && payload.compare( m_navigationStatePayload ) != 0 ){
-            payloadChanged = true;
+        if( !m_navigationStatePushed ) {
+            // only parse the platform navigation state when the payload changes
+            std::string payload = m_navigationHandler->getNavigationState();
+            auto payloadHash = std::hash<std::string>()( payload );
+            if( !m_platformNavigationStateReceived || payloadHash != m_platformNavigationStateHash ) {
+                m_platformNavigationStateReceived = true;
+                m_platformNavigationStateHash = payloadHash;
+                m_platformNavigationStateValid = m_navigationState.setPayload( payload );
+            }
+            if( !m_platformNavigationStateValid ) {
+                return;
+            }
         }
 
-        if( payloadChanged ) {
-            if ( isNavigationStateValid( payload )  ) {
-                // set the context NavigationState
-                ThrowIf( m_contextManager->setState( NAVIGATION_STATE, m_navigationStatePayload, alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateFailed" );
-            }
+        auto changeHash = m_navigationState.getChangeHash();
+        if( !m_navigationStateReported || changeHash != m_reportedNavigationStateHash ) {
+            // set the context NavigationState
+            ThrowIf( m_contextManager->setState( NAVIGATION_STATE, m_navigationState.getPayload(), alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateFailed" );
+            m_navigationStateReported = true;
+            m_reportedNavigationStateHash = changeHash;
         } else {
             // send empty if no change
             ThrowIf( m_contextManager->setState( NAVIGATION_STATE, "", alexaClientSDK::avsCommon::avs::StateRefreshPolicy::SOMETIMES, stateRequestToken ) != alexaClientSDK::avsCommon::sdkInterfaces::SetStateResult::SUCCESS, "contextManagerSetStateEmptyPayloadFailed" );
@@ -352,6 +344,19 @@ void NavigationCapabilityAgent::executeProvideState( const alexaClientSDK::avsCo
     }
 }
 
+void NavigationCapabilityAgent::executeNavigationStateChanged( const std::string& navigationState )
+{
+    m_navigationStatePushed = true;
+    if( !m_navigationState.update( navigationState ) ) {
+        AACE_ERROR(LX(TAG).d("reason", "invalidNavigationState"));
+    }
+}
+
+std::string NavigationCapabilityAgent::getCurrentNavigationState()
+{
+    return m_navigationStatePushed ? m_navigationState.getPayload() : m_navigationHandler->getNavigationState();
+}
+
 void NavigationCapabilityAgent::executeNavigationEvent( aace::navigation::NavigationEngineInterface::EventName event )
 {
     switch( event ){
@@ -423,8 +428,7 @@ std::string NavigationCapabilityAgent::getWaypointErrorCode( aace::navigation::N
 //
     
 void NavigationCapabilityAgent::startNavigationSuccess() {
-    std::string navigationState;
-    navigationState = m_navigationHandler->getNavigationState();
+    std::string navigationState = getCurrentNavigationState();
     rapidjson::Document context( rapidjson::kObjectType );
     rapidjson::Document payload( rapidjson::kObjectType );
     rapidjson::Document::AllocatorType& allocator = payload.GetAllocator();
@@ -469,8 +473,7 @@ void NavigationCapabilityAgent::showPreviousWaypointsSuccess()
 
 void NavigationCapabilityAgent::navigateToPreviousWaypointSuccess()
 {
-    std::string navigationState;
-    navigationState = m_navigationHandler->getNavigationState();
+    std::string navigationState = getCurrentNavigationState();
     rapidjson::Document context( rapidjson::kObjectType );
     rapidjson::Document payload( rapidjson::kObjectType );
     rapidjson::Document::AllocatorType& allocator = payload.GetAllocator();
@@ -550,122 +553,6 @@ void NavigationCapabilityAgent::showPreviousWaypointsError( std::string code, st
     m_messageSender->sendMessage( request );
 }
 
-bool NavigationCapabilityAgent::isNavigationStateValid( std::string navigationState )
-{
-    AACE_VERBOSE(LX(TAG).d("navigationState",navigationState));
-    try
-    {
-        rapidjson::Document document;
-        document.Parse<0>( navigationState.c_str() );
-        
-        if( document.HasParseError() ) {
-            rapidjson::ParseErrorCode ok = document.GetParseError();
-            AACE_ERROR(LX(TAG).d( "HasParseError", GetParseError_En(ok) ) );
-            Throw( "parseError" );
-        }
-        
-        ThrowIfNot( document.HasMember("state"), "stateKeyMissing");
-        
-        if( document[ "state" ].IsNull() || !document[ "state" ].IsString() ) {
-            Throw( "stateNotValid" );
-        }
-        std::string state = document[ "state" ].GetString();
-        if( ( state.compare(NAVIGATION_STATE_NAVIGATING) != 0 )
-           && ( state.compare(NAVIGATION_STATE_NOT_NAVIGATING) != 0 )
-           && ( state.compare(NAVIGATION_STATE_UNKNOWN) != 0 ) ) {
-            Throw( "stateValueNotValid" );
-        }
-        if ( document.HasMember("waypoints") ) {
-            if( !document[ "waypoints" ].IsArray() ) {
-                Throw( "waypointsArrayNotValid" );
-            }
-            
-            auto waypoints = document["waypoints"].GetArray();
-            for ( int i = 0; i < waypoints.Size() ; i++ ) {
-                auto waypoint  = waypoints[i].GetObject();
-                ThrowIfNot( waypoint.HasMember("type"), "waypointTypeMissing");
-                
-                std::string waypointType = waypoint["type"].GetString();
-                if( waypoint[ "type" ].IsNull() || !waypoint[ "type" ].IsString() ) {
-                    Throw( "waypointTypeNotValid" );
-                }
-                if( ( waypointType.compare(WAYPOINT_TYPE_SOURCE) != 0 ) &&
-                    ( waypointType.compare(WAYPOINT_TYPE_INTERIM) != 0 ) &&
-                    ( waypointType.compare(WAYPOINT_TYPE_DESTINATION) != 0 ) ) {
-                    Throw( "waypointTypeValueNotValid" );
-                }
-                if ( waypoint.HasMember("estimatedTimeOfArrival") ) {
-                    auto estimatedTimeOfArrival = waypoint["estimatedTimeOfArrival"].GetObject();
-                    ThrowIfNot( estimatedTimeOfArrival.HasMember("predicted"), "predictedTimeOfArrivalMissing");
-                    if ( ( estimatedTimeOfArrival.HasMember("ideal") && !estimatedTimeOfArrival["ideal"].IsString() ) ||
-                         ( estimatedTimeOfArrival.HasMember("predicted") && !estimatedTimeOfArrival["predicted"].IsString() ) ) {
-                        
-                        Throw( "estimatedTimeOfArrivalNotString" );
-                    }
-                }
-                if ( waypoint.HasMember("address") ) {
-                    auto address = waypoint["address"].GetObject();
-                    if ( ( address.HasMember("addressLine1") && !address["addressLine1"].IsString() ) ||
-                         ( address.HasMember("addressLine2") && !address["addressLine2"].IsString() ) ||
-                         ( address.HasMember("addressLine3") && !address["addressLine3"].IsString() ) ||
-                         ( address.HasMember("city") && !address["city"].IsString() ) ||
-                         ( address.HasMember("stateOrRegion") && !address["stateOrRegion"].IsString() ) ||
-                         ( address.HasMember("countryCode") && !address["countryCode"].IsString() ) ||
-                         ( address.HasMember("districtOrCounty") && !address["districtOrCounty"].IsString() ) ||
-                         ( address.HasMember("postalCode") && !address["postalCode"].IsString() )
-                    ) {
-                        Throw( "AddressNotString" );
-                    }
-                }
-                if ( waypoint.HasMember("name") ) {
-                    if ( waypoint[ "name" ].IsNull() || !waypoint[ "name" ].IsString() ) {
-                        Throw( "waypointNameNotValid" );
-                    }
-                }
-                
-                ThrowIfNot( waypoint.HasMember("coordinate"), "waypointcoordinateMissing");
-                auto coordinate = waypoint["coordinate"].GetArray();
-                if ( coordinate[0].IsNull() ) {
-                    Throw( "LatitudeNotValid" );
-                }
-                if ( coordinate[1].IsNull() ) {
-                    Throw( "LongitudeNotValid" );
-                }
-                if ( waypoint.HasMember("pointOfInterest") ) {
-                    auto poi = waypoint["pointOfInterest"].GetObject();
-                    if ( !poi.HasMember("id") && !poi.HasMember("name") && !poi.HasMember("phoneNumber") ) {
-                        waypoint.EraseMember("pointOfInterest");
-                    }
-                }
-            }
-        }
-        ThrowIfNot( document.HasMember("shapes"), "shapesKeyMissing" );
-
-        if( !document[ "shapes" ].IsArray() ) {
-            Throw( "shapesArrayNotValid" );
-        }
-        if ( document[ "waypoints" ].Size() != 0 && document[ "shapes" ].Size() < 2 ) {
-            AACE_WARN(LX(TAG).d("shapes","Shapes should not be less than 2 for local POI"));
-        }
-
-        if( document[ "shapes" ].Size() > MAXIMUM_SHAPES_IN_CONTEXT ) {
-            AACE_WARN(LX(TAG, "isNavigationStateValid").d("shapes", "Too many shapes in payload. Only using first 3000."));
-            ThrowIfNot( document[ "shapes" ].Erase(document[ "shapes" ].Begin() + MAXIMUM_SHAPES_IN_CONTEXT, document[ "shapes" ].End()), "unable to operate on shapes Array" );
-        }
-        rapidjson::StringBuffer buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer( buffer );
-        document.Accept( writer );
-        navigationState = buffer.GetString();
-        
-        // set current navigation state payload
-        m_navigationStatePayload = navigationState;
-        return true;
-    } catch( std::exception& ex ) {
-        AACE_ERROR(LX(TAG).d("reason",ex.what() ));
-        return false;
-    }
-}
-
 std::unordered_set<std::shared_ptr<alexaClientSDK::avsCommon::avs::CapabilityConfiguration>> NavigationCapabilityAgent::getCapabilityConfigurations() {
     return m_capabilityConfigurations;
 }
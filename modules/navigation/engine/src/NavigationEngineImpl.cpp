@@ -47,6 +47,37 @@ static const std::string METRIC_NAVIGATION_ANNOUNCE_ROADREGULATION = "AnnounceRo
 static const std::string METRIC_NAVIGATION_NAVIGATION_EVENT = "NavigationEvent";
 static const std::string METRIC_NAVIGATION_NAVIGATION_ERROR = "NavigationError";
 static const std::string METRIC_NAVIGATION_SHOW_ALTERNATIVE_ROUTES_SUCCEEDED = "ShowAlternativeRoutesSucceeded";
+static const std::string METRIC_NAVIGATION_NAVIGATION_STATE_CHANGED = "NavigationStateChanged";
+
+/// Counter metrics for Navigation Platform APIs
+static CounterMetric s_showPreviousWaypointsCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "showPreviousWaypoints", METRIC_NAVIGATION_SHOW_PREVIOUS_WAYPOINTS);
+static CounterMetric s_navigateToPreviousWaypointCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "navigateToPreviousWaypoint", METRIC_NAVIGATION_NAVIGATE_TO_PREVIOUS_WAYPOINT);
+static CounterMetric s_showAlternativeRoutesCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "showAlternativeRoutes", METRIC_NAVIGATION_SHOW_ALTERNATIVE_ROUTES);
+static CounterMetric s_controlDisplayCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "controlDisplay", METRIC_NAVIGATION_CONTROL_DISPLAY);
+static CounterMetric s_startNavigationCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "startNavigation", METRIC_NAVIGATION_START_NAVIGATION);
+static CounterMetric s_announceManeuverCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "announceManeuver", METRIC_NAVIGATION_ANNOUNCE_MANEUVER);
+static CounterMetric s_announceRoadRegulationCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "announceRoadRegulation", METRIC_NAVIGATION_ANNOUNCE_ROADREGULATION);
+static CounterMetric s_cancelNavigationCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "cancelNavigation", METRIC_NAVIGATION_CANCEL_NAVIGATION);
+static CounterMetric s_getNavigationStateCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "getNavigationState", METRIC_NAVIGATION_GET_NAVIGATION_STATE);
+static CounterMetric s_onNavigationEventCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "onNavigationEvent", METRIC_NAVIGATION_NAVIGATION_EVENT);
+static CounterMetric s_onNavigationErrorCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "onNavigationError", METRIC_NAVIGATION_NAVIGATION_ERROR);
+static CounterMetric s_onShowAlternativeRoutesSucceededCounter(
+    METRIC_PROGRAM_NAME_SUFFIX,
+    "onShowAlternativeRoutesSucceeded",
+    METRIC_NAVIGATION_SHOW_ALTERNATIVE_ROUTES_SUCCEEDED);
+static CounterMetric s_onNavigationStateChangedCounter(
+    METRIC_PROGRAM_NAME_SUFFIX, "onNavigationStateChanged", METRIC_NAVIGATION_NAVIGATION_STATE_CHANGED);
 
 NavigationEngineImpl::NavigationEngineImpl(
     std::shared_ptr<aace::navigation::Navigation> navigationPlatformInterface,
@@ -141,64 +172,64 @@ void NavigationEngineImpl::doShutdown() {
 }
 
 void NavigationEngineImpl::showPreviousWaypoints() {
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "showPreviousWaypoints", {METRIC_NAVIGATION_SHOW_PREVIOUS_WAYPOINTS});
+    s_showPreviousWaypointsCounter.emit();
     m_navigationPlatformInterface->showPreviousWaypoints();
 }
 
 void NavigationEngineImpl::navigateToPreviousWaypoint() {
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "navigateToPreviousWaypoint", {METRIC_NAVIGATION_NAVIGATE_TO_PREVIOUS_WAYPOINT});
+    s_navigateToPreviousWaypointCounter.emit();
     m_navigationPlatformInterface->navigateToPreviousWaypoint();
 }
 
 void NavigationEngineImpl::showAlternativeRoutes(aace::navigation::Navigation::AlternateRouteType alternateRouteType) {
     std::stringstream ss;
     ss << alternateRouteType;
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "showAlternativeRoutes", {METRIC_NAVIGATION_SHOW_ALTERNATIVE_ROUTES, ss.str()});
+    s_showAlternativeRoutesCounter.emit();
+    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "showAlternativeRoutes", ss.str(), 1);
     m_navigationPlatformInterface->showAlternativeRoutes(alternateRouteType);
 }
 
 void NavigationEngineImpl::controlDisplay(aace::navigation::Navigation::ControlDisplay controlDisplay) {
     std::stringstream ss;
     ss << controlDisplay;
-    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "controlDisplay", {METRIC_NAVIGATION_CONTROL_DISPLAY, ss.str()});
+    s_controlDisplayCounter.emit();
+    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "controlDisplay", ss.str(), 1);
     m_navigationPlatformInterface->controlDisplay(controlDisplay);
 }
 
 void NavigationEngineImpl::startNavigation(const std::string& payload) {
-    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "startNavigation", {METRIC_NAVIGATION_START_NAVIGATION});
+    s_startNavigationCounter.emit();
     m_navigationPlatformInterface->startNavigation(payload);
 }
 
 void NavigationEngineImpl::announceManeuver(const std::string& payload) {
-    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "announceManeuver", {METRIC_NAVIGATION_ANNOUNCE_MANEUVER});
+    s_announceManeuverCounter.emit();
     m_navigationPlatformInterface->announceManeuver(payload);
 }
 
 void NavigationEngineImpl::announceRoadRegulation(aace::navigation::Navigation::RoadRegulation roadRegulation) {
     std::stringstream ss;
     ss << roadRegulation;
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX, "announceRoadRegulation", {METRIC_NAVIGATION_ANNOUNCE_ROADREGULATION, ss.str()});
+    s_announceRoadRegulationCounter.emit();
+    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "announceRoadRegulation", ss.str(), 1);
     m_navigationPlatformInterface->announceRoadRegulation(roadRegulation);
 }
 
 void NavigationEngineImpl::cancelNavigation() {
-    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "cancelNavigation", {METRIC_NAVIGATION_CANCEL_NAVIGATION});
+    s_cancelNavigationCounter.emit();
     m_navigationPlatformInterface->cancelNavigation();
 }
 
 std::string NavigationEngineImpl::getNavigationState() {
-    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "getNavigationState", {METRIC_NAVIGATION_GET_NAVIGATION_STATE});
+    s_getNavigationStateCounter.emit();
     return m_navigationPlatformInterface->getNavigationState();
 }
 
 void NavigationEngineImpl::onNavigationEvent(EventName event) {
     std::stringstream ss;
     ss << event;
-    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "onNavigationEvent", {METRIC_NAVIGATION_NAVIGATION_EVENT, ss.str()});
+    s_onNavigationEventCounter.emit();
+    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "onNavigationEvent", ss.str(), 1);
     switch (event) {
         case aace::navigation::NavigationEngineInterface::EventName::NAVIGATION_STARTED:
         case aace::navigation::NavigationEngineInterface::EventName::PREVIOUS_WAYPOINTS_SHOWN:
@@ -246,10 +277,8 @@ void NavigationEngineImpl::onNavigationError(
     std::stringstream errorCode;
     errorType << type;
     errorCode << code;
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX,
-        "onNavigationError",
-        {METRIC_NAVIGATION_NAVIGATION_ERROR, errorType.str(), errorCode.str()});
+    s_onNavigationErrorCounter.emit();
+    emitCounterMetrics(METRIC_PROGRAM_NAME_SUFFIX, "onNavigationError", {errorType.str(), errorCode.str()});
     switch (type) {
         case aace::navigation::NavigationEngineInterface::ErrorType::NAVIGATION_START_FAILED:
         case aace::navigation::NavigationEngineInterface::ErrorType::SHOW_PREVIOUS_WAYPOINTS_FAILED:
@@ -293,13 +322,15 @@ void NavigationEngineImpl::onNavigationError(
 }
 
 void NavigationEngineImpl::onShowAlternativeRoutesSucceeded(const std::string& payload) {
-    emitCounterMetrics(
-        METRIC_PROGRAM_NAME_SUFFIX,
-        "onShowAlternativeRoutesSucceeded",
-        {METRIC_NAVIGATION_SHOW_ALTERNATIVE_ROUTES_SUCCEEDED});
+    s_onShowAlternativeRoutesSucceededCounter.emit();
     m_displayManagerCapabilityAgent->showAlternativeRoutesSucceeded(payload);
 }
 
+void NavigationEngineImpl::onNavigationStateChanged(const std::string& navigationState) {
+    s_onNavigationStateChangedCounter.emit();
+    m_navigationCapabilityAgent->navigationStateChanged(navigationState);
+}
+
 }  // namespace navigation
 }  // namespace engine
 }  // namespace aace
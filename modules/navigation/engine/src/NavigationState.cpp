@@ -0,0 +1,390 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "AACE/Engine/Navigation/NavigationState.h"
+#include "AACE/Engine/Core/EngineMacros.h"
+
+namespace aace {
+namespace engine {
+namespace navigation {
+
+// String to identify log entries originating from this file.
+static const std::string TAG("aace.navigation.NavigationState");
+
+/// NavigationState state accepted values
+static const std::string NAVIGATION_STATE_NAVIGATING = "NAVIGATING";
+static const std::string NAVIGATION_STATE_NOT_NAVIGATING = "NOT_NAVIGATING";
+static const std::string NAVIGATION_STATE_UNKNOWN = "UNKNOWN";
+
+// Waypoint Type accepted values
+static const std::string WAYPOINT_TYPE_SOURCE = "SOURCE";
+static const std::string WAYPOINT_TYPE_INTERIM = "INTERIM";
+static const std::string WAYPOINT_TYPE_DESTINATION = "DESTINATION";
+
+/// The serialized empty waypoints array
+static const std::string EMPTY_WAYPOINTS = "[]";
+
+/// FNV-1a 64-bit hash parameters
+static const uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+static const uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+static const double DEGREES_TO_RADIANS = 3.14159265358979323846 / 180.0;
+
+const size_t NavigationState::MAXIMUM_SHAPES_IN_CONTEXT;
+
+static uint64_t computeHash(const void* data, size_t size, uint64_t hash = FNV_OFFSET_BASIS) {
+    auto bytes = static_cast<const unsigned char*>(data);
+    for (size_t j = 0; j < size; j++) {
+        hash ^= bytes[j];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint64_t computeHash(const std::string& value) {
+    return computeHash(value.data(), value.size());
+}
+
+static uint64_t computeHash(const std::vector<NavigationState::Coordinate>& shapes) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (auto& coordinate : shapes) {
+        hash = computeHash(&coordinate.first, sizeof(coordinate.first), hash);
+        hash = computeHash(&coordinate.second, sizeof(coordinate.second), hash);
+    }
+    return hash;
+}
+
+static bool isStringMember(const rapidjson::Value& object, const char* name) {
+    return !object.HasMember(name) || object[name].IsString();
+}
+
+/**
+ * Gets a route shape latitude or longitude, which may be a number or a string containing a number.
+ */
+static bool getCoordinateValue(const rapidjson::Value& value, double& result) {
+    if (value.IsNumber()) {
+        result = value.GetDouble();
+        return true;
+    }
+    if (value.IsString()) {
+        const char* text = value.GetString();
+        char* end = nullptr;
+        result = std::strtod(text, &end);
+        return end != text && *end == '\0' && std::isfinite(result);
+    }
+    return false;
+}
+
+static void validateWaypoint(rapidjson::Value& waypoint) {
+    ThrowIfNot(waypoint.IsObject(), "waypointNotValid");
+    ThrowIfNot(waypoint.HasMember("type"), "waypointTypeMissing");
+    ThrowIfNot(waypoint["type"].IsString(), "waypointTypeNotValid");
+
+    std::string waypointType = waypoint["type"].GetString();
+    if ((waypointType.compare(WAYPOINT_TYPE_SOURCE) != 0) && (waypointType.compare(WAYPOINT_TYPE_INTERIM) != 0) &&
+        (waypointType.compare(WAYPOINT_TYPE_DESTINATION) != 0)) {
+        Throw("waypointTypeValueNotValid");
+    }
+    if (waypoint.HasMember("estimatedTimeOfArrival")) {
+        auto& estimatedTimeOfArrival = waypoint["estimatedTimeOfArrival"];
+        ThrowIfNot(estimatedTimeOfArrival.IsObject(), "estimatedTimeOfArrivalNotValid");
+        ThrowIfNot(estimatedTimeOfArrival.HasMember("predicted"), "predictedTimeOfArrivalMissing");
+        if (!isStringMember(estimatedTimeOfArrival, "ideal") || !isStringMember(estimatedTimeOfArrival, "predicted")) {
+            Throw("estimatedTimeOfArrivalNotString");
+        }
+    }
+    if (waypoint.HasMember("address")) {
+        auto& address = waypoint["address"];
+        ThrowIfNot(address.IsObject(), "AddressNotValid");
+        if (!isStringMember(address, "addressLine1") || !isStringMember(address, "addressLine2") ||
+            !isStringMember(address, "addressLine3") || !isStringMember(address, "city") ||
+            !isStringMember(address, "stateOrRegion") || !isStringMember(address, "countryCode") ||
+            !isStringMember(address, "districtOrCounty") || !isStringMember(address, "postalCode")) {
+            Throw("AddressNotString");
+        }
+    }
+    ThrowIfNot(isStringMember(waypoint, "name"), "waypointNameNotValid");
+
+    ThrowIfNot(waypoint.HasMember("coordinate"), "waypointcoordinateMissing");
+    auto& coordinate = waypoint["coordinate"];
+    ThrowIfNot(coordinate.IsArray() && coordinate.Size() >= 2, "coordinateNotValid");
+    ThrowIf(coordinate[0].IsNull(), "LatitudeNotValid");
+    ThrowIf(coordinate[1].IsNull(), "LongitudeNotValid");
+
+    if (waypoint.HasMember("pointOfInterest")) {
+        auto& poi = waypoint["pointOfInterest"];
+        if (!poi.IsObject() || (!poi.HasMember("id") && !poi.HasMember("name") && !poi.HasMember("phoneNumber"))) {
+            waypoint.EraseMember("pointOfInterest");
+        }
+    }
+}
+
+/**
+ * Returns the distance in degrees of latitude from @c point to the segment between @c start and @c end.
+ * The coordinates are projected to a plane with longitude scaled by the cosine of the segment latitude,
+ * which is accurate for the short segments of a route shape.
+ */
+static double getDistanceToSegment(
+    const NavigationState::Coordinate& point,
+    const NavigationState::Coordinate& start,
+    const NavigationState::Coordinate& end) {
+    double scale = std::cos((start.first + end.first) * 0.5 * DEGREES_TO_RADIANS);
+    double px = (point.second - start.second) * scale;
+    double py = point.first - start.first;
+    double dx = (end.second - start.second) * scale;
+    double dy = end.first - start.first;
+    double lengthSquared = dx * dx + dy * dy;
+    double t = lengthSquared > 0 ? std::max(0.0, std::min(1.0, (px * dx + py * dy) / lengthSquared)) : 0;
+    double ex = px - t * dx;
+    double ey = py - t * dy;
+    return std::sqrt(ex * ex + ey * ey);
+}
+
+NavigationState::NavigationState() :
+        m_state(NAVIGATION_STATE_NOT_NAVIGATING),
+        m_waypoints(EMPTY_WAYPOINTS),
+        m_stateHash(computeHash(m_state)),
+        m_waypointsHash(computeHash(m_waypoints)),
+        m_shapesHash(computeHash(m_shapes)),
+        m_changeHash(0),
+        m_payloadChanged(true) {
+    updateChangeHash();
+}
+
+bool NavigationState::setPayload(const std::string& payload) {
+    if (payload.empty()) {
+        *this = NavigationState();
+        return true;
+    }
+    return apply(payload, true);
+}
+
+bool NavigationState::update(const std::string& update) {
+    return apply(update, false);
+}
+
+bool NavigationState::apply(const std::string& json, bool complete) {
+    AACE_VERBOSE(LX(TAG).d("navigationState", json).d("complete", complete));
+    try {
+        rapidjson::Document document;
+        document.Parse<0>(json.c_str());
+
+        if (document.HasParseError()) {
+            rapidjson::ParseErrorCode ok = document.GetParseError();
+            AACE_ERROR(LX(TAG).d("HasParseError", GetParseError_En(ok)));
+            Throw("parseError");
+        }
+        ThrowIfNot(document.IsObject(), "navigationStateNotObject");
+
+        // validate every member of the update before changing the navigation state
+        bool hasState = document.HasMember("state");
+        ThrowIf(complete && !hasState, "stateKeyMissing");
+        std::string state;
+        if (hasState) {
+            ThrowIfNot(document["state"].IsString(), "stateNotValid");
+            state = document["state"].GetString();
+            if ((state.compare(NAVIGATION_STATE_NAVIGATING) != 0) &&
+                (state.compare(NAVIGATION_STATE_NOT_NAVIGATING) != 0) &&
+                (state.compare(NAVIGATION_STATE_UNKNOWN) != 0)) {
+                Throw("stateValueNotValid");
+            }
+        }
+
+        bool hasWaypoints = document.HasMember("waypoints");
+        std::string waypoints = EMPTY_WAYPOINTS;
+        if (hasWaypoints) {
+            auto& waypointsArray = document["waypoints"];
+            ThrowIfNot(waypointsArray.IsArray(), "waypointsArrayNotValid");
+            for (auto waypoint = waypointsArray.Begin(); waypoint != waypointsArray.End(); ++waypoint) {
+                validateWaypoint(*waypoint);
+            }
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            ThrowIfNot(waypointsArray.Accept(writer), "failedToWriteWaypoints");
+            waypoints = buffer.GetString();
+        }
+
+        bool hasShapes = document.HasMember("shapes");
+        ThrowIf(complete && !hasShapes, "shapesKeyMissing");
+        std::vector<Coordinate> shapes;
+        if (hasShapes) {
+            auto& shapesArray = document["shapes"];
+            ThrowIfNot(shapesArray.IsArray(), "shapesArrayNotValid");
+            shapes.reserve(shapesArray.Size());
+            for (auto shape = shapesArray.Begin(); shape != shapesArray.End(); ++shape) {
+                Coordinate coordinate;
+                ThrowIfNot(
+                    shape->IsArray() && shape->Size() >= 2 && getCoordinateValue((*shape)[0], coordinate.first) &&
+                        getCoordinateValue((*shape)[1], coordinate.second),
+                    "shapeNotValid");
+                shapes.push_back(coordinate);
+            }
+            if (shapes.size() > MAXIMUM_SHAPES_IN_CONTEXT) {
+                AACE_WARN(LX(TAG)
+                              .d("shapes", "Too many shapes in payload. Simplifying the route shape.")
+                              .d("count", shapes.size()));
+                shapes = simplifyShapes(shapes, MAXIMUM_SHAPES_IN_CONTEXT);
+            }
+        }
+
+        // replace the members present in the update
+        if (complete || hasState) {
+            m_state = std::move(state);
+            m_stateHash = computeHash(m_state);
+        }
+        if (complete || hasWaypoints) {
+            m_waypoints = std::move(waypoints);
+            m_waypointsHash = computeHash(m_waypoints);
+        }
+        if (complete || hasShapes) {
+            m_shapes = std::move(shapes);
+            m_shapesHash = computeHash(m_shapes);
+        }
+        updateChangeHash();
+
+        if (m_waypoints != EMPTY_WAYPOINTS && m_shapes.size() < 2) {
+            AACE_WARN(LX(TAG).d("shapes", "Shapes should not be less than 2 for local POI"));
+        }
+
+        return true;
+    } catch (std::exception& ex) {
+        AACE_ERROR(LX(TAG).d("reason", ex.what()));
+        return false;
+    }
+}
+
+void NavigationState::updateChangeHash() {
+    uint64_t hashes[] = {m_stateHash, m_waypointsHash, m_shapesHash};
+    uint64_t changeHash = computeHash(hashes, sizeof(hashes));
+    if (changeHash != m_changeHash) {
+        m_changeHash = changeHash;
+        m_payloadChanged = true;
+    }
+}
+
+uint64_t NavigationState::getChangeHash() const {
+    return m_changeHash;
+}
+
+const std::string& NavigationState::getPayload() {
+    if (m_payloadChanged) {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        writer.StartObject();
+        writer.Key("state");
+        writer.String(m_state.c_str(), static_cast<rapidjson::SizeType>(m_state.size()));
+        writer.Key("waypoints");
+        writer.RawValue(m_waypoints.c_str(), m_waypoints.size(), rapidjson::kArrayType);
+        writer.Key("shapes");
+        writer.StartArray();
+        for (auto& coordinate : m_shapes) {
+            writer.StartArray();
+            writer.Double(coordinate.first);
+            writer.Double(coordinate.second);
+            writer.EndArray();
+        }
+        writer.EndArray();
+        writer.EndObject();
+        m_payload = buffer.GetString();
+        m_payloadChanged = false;
+    }
+    return m_payload;
+}
+
+std::vector<NavigationState::Coordinate> NavigationState::simplifyShapes(
+    const std::vector<Coordinate>& shapes,
+    size_t maximumShapes) {
+    size_t count = shapes.size();
+    if (count <= maximumShapes || maximumShapes < 2) {
+        return shapes;
+    }
+
+    // Compute the tolerance at which Douglas-Peucker would keep each coordinate. A coordinate split
+    // within a segment is kept only if the coordinate that created the segment is kept, so its
+    // significance is limited to the significance of that coordinate.
+    const double infinity = std::numeric_limits<double>::infinity();
+    std::vector<double> significance(count, 0.0);
+
+    struct Segment {
+        size_t first;
+        size_t last;
+        double limit;
+    };
+    std::vector<Segment> segments{{0, count - 1, infinity}};
+    while (!segments.empty()) {
+        Segment segment = segments.back();
+        segments.pop_back();
+        if (segment.last - segment.first < 2) {
+            continue;
+        }
+        size_t farthest = segment.first + 1;
+        double maximumDistance = -1;
+        for (size_t j = segment.first + 1; j < segment.last; j++) {
+            double distance = getDistanceToSegment(shapes[j], shapes[segment.first], shapes[segment.last]);
+            if (distance > maximumDistance) {
+                maximumDistance = distance;
+                farthest = j;
+            }
+        }
+        significance[farthest] = std::min(maximumDistance, segment.limit);
+        segments.push_back({segment.first, farthest, significance[farthest]});
+        segments.push_back({farthest, segment.last, significance[farthest]});
+    }
+
+    // The tolerance is the significance of the last interior coordinate that fits within the limit
+    size_t interiorLimit = maximumShapes - 2;
+    std::vector<double> interior(significance.begin() + 1, significance.end() - 1);
+    double tolerance = infinity;
+    if (interiorLimit > 0) {
+        auto nth = interior.begin() + (interiorLimit - 1);
+        std::nth_element(interior.begin(), nth, interior.end(), std::greater<double>());
+        tolerance = *nth;
+    }
+    size_t aboveTolerance = 0;
+    for (size_t j = 1; j < count - 1; j++) {
+        if (significance[j] > tolerance) {
+            aboveTolerance++;
+        }
+    }
+
+    // Keep the end coordinates, the coordinates above the tolerance, and as many at the tolerance as fit
+    size_t atToleranceAllowed = interiorLimit - aboveTolerance;
+    std::vector<Coordinate> simplified;
+    simplified.reserve(maximumShapes);
+    for (size_t j = 0; j < count; j++) {
+        if (j == 0 || j == count - 1 || significance[j] > tolerance) {
+            simplified.push_back(shapes[j]);
+        } else if (significance[j] == tolerance && atToleranceAllowed > 0) {
+            simplified.push_back(shapes[j]);
+            atToleranceAllowed--;
+        }
+    }
+    return simplified;
+}
+
+}  // namespace navigation
+}  // namespace engine
+}  // namespace aace
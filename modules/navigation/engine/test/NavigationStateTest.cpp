@@ -0,0 +1,165 @@
+/*
+ * Copyright 2017-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "AACE/Engine/Navigation/NavigationState.h"
+
+namespace aace {
+namespace test {
+namespace unit {
+
+using NavigationState = aace::engine::navigation::NavigationState;
+
+static const std::string NOT_NAVIGATING_PAYLOAD = R"({"state":"NOT_NAVIGATING","waypoints":[],"shapes":[]})";
+
+static const std::string WAYPOINTS =
+    R"([{"type":"SOURCE","coordinate":[10.5,20.5]},{"type":"DESTINATION","coordinate":[11.5,21.5]}])";
+
+static std::string generatePayload(const std::string& state, const std::string& waypoints, size_t shapeCount) {
+    std::stringstream shapes;
+    shapes.precision(10);
+    for (size_t j = 0; j < shapeCount; j++) {
+        shapes << (j > 0 ? "," : "") << "[" << 47.00005 + j * 0.0001 << ",-122.5]";
+    }
+    return R"({"state":")" + state + R"(","waypoints":)" + waypoints + R"(,"shapes":[)" + shapes.str() + "]}";
+}
+
+TEST(NavigationStateTest, defaultState) {
+    NavigationState navigationState;
+    EXPECT_EQ(NOT_NAVIGATING_PAYLOAD, navigationState.getPayload());
+}
+
+TEST(NavigationStateTest, emptyPayloadResetsState) {
+    NavigationState navigationState;
+    auto defaultHash = navigationState.getChangeHash();
+    ASSERT_TRUE(navigationState.setPayload(generatePayload("NAVIGATING", WAYPOINTS, 2)));
+    EXPECT_NE(defaultHash, navigationState.getChangeHash());
+    ASSERT_TRUE(navigationState.setPayload(""));
+    EXPECT_EQ(defaultHash, navigationState.getChangeHash());
+    EXPECT_EQ(NOT_NAVIGATING_PAYLOAD, navigationState.getPayload());
+}
+
+TEST(NavigationStateTest, invalidPayloadIsRejected) {
+    NavigationState navigationState;
+    auto hash = navigationState.getChangeHash();
+    EXPECT_FALSE(navigationState.setPayload("{"));
+    EXPECT_FALSE(navigationState.setPayload(R"({"state":"DRIVING","waypoints":[],"shapes":[]})"));
+    EXPECT_FALSE(navigationState.setPayload(R"({"state":"NAVIGATING","waypoints":[]})"));
+    EXPECT_FALSE(
+        navigationState.setPayload(generatePayload("NAVIGATING", R"([{"type":"STOP","coordinate":[1,2]}])", 2)));
+    EXPECT_FALSE(navigationState.setPayload(generatePayload("NAVIGATING", R"([{"type":"SOURCE"}])", 2)));
+    EXPECT_EQ(hash, navigationState.getChangeHash());
+    EXPECT_EQ(NOT_NAVIGATING_PAYLOAD, navigationState.getPayload());
+}
+
+TEST(NavigationStateTest, changeHashIgnoresFormatting) {
+    NavigationState navigationState;
+    ASSERT_TRUE(navigationState.setPayload(R"({"state":"NAVIGATING","waypoints":[],"shapes":[[1.5,2.5]]})"));
+    auto hash = navigationState.getChangeHash();
+    ASSERT_TRUE(navigationState.setPayload("{ \"shapes\": [ [1.5, 2.5] ],\n \"state\": \"NAVIGATING\" }"));
+    EXPECT_EQ(hash, navigationState.getChangeHash());
+}
+
+TEST(NavigationStateTest, shapeCoordinatesMayBeStrings) {
+    NavigationState navigationState;
+    ASSERT_TRUE(navigationState.setPayload(R"({"state":"NAVIGATING","shapes":[["37.5","-121.25"],[37.75,-121.5]]})"));
+    EXPECT_EQ(
+        R"({"state":"NAVIGATING","waypoints":[],"shapes":[[37.5,-121.25],[37.75,-121.5]]})",
+        navigationState.getPayload());
+    EXPECT_FALSE(navigationState.setPayload(R"({"state":"NAVIGATING","shapes":[["north","-121.25"]]})"));
+}
+
+TEST(NavigationStateTest, updateReplacesOnlyPresentMembers) {
+    NavigationState navigationState;
+    ASSERT_TRUE(navigationState.setPayload(generatePayload("NAVIGATING", "[]", 3)));
+    auto hash = navigationState.getChangeHash();
+
+    ASSERT_TRUE(navigationState.update(R"({"waypoints":)" + WAYPOINTS + "}"));
+    EXPECT_NE(hash, navigationState.getChangeHash());
+    EXPECT_EQ(generatePayload("NAVIGATING", WAYPOINTS, 3), navigationState.getPayload());
+
+    ASSERT_TRUE(navigationState.update(R"({"state":"NOT_NAVIGATING","shapes":[]})"));
+    EXPECT_EQ(generatePayload("NOT_NAVIGATING", WAYPOINTS, 0), navigationState.getPayload());
+
+    EXPECT_FALSE(navigationState.update(R"({"state":"NAVIGATING","shapes":[[1]]})"));
+    EXPECT_EQ(generatePayload("NOT_NAVIGATING", WAYPOINTS, 0), navigationState.getPayload());
+}
+
+TEST(NavigationStateTest, emptyPointOfInterestIsRemoved) {
+    NavigationState navigationState;
+    std::string waypoints = R"([{"type":"DESTINATION","coordinate":[1,2],"pointOfInterest":{}}])";
+    ASSERT_TRUE(navigationState.setPayload(R"({"state":"NAVIGATING","waypoints":)" + waypoints + R"(,"shapes":[]})"));
+    EXPECT_EQ(
+        R"({"state":"NAVIGATING","waypoints":[{"type":"DESTINATION","coordinate":[1,2]}],"shapes":[]})",
+        navigationState.getPayload());
+}
+
+TEST(NavigationStateTest, simplifyShapesWithinLimit) {
+    std::vector<NavigationState::Coordinate> shapes{{0, 0}, {0, 1}, {0, 2}};
+    EXPECT_EQ(shapes, NavigationState::simplifyShapes(shapes, 3));
+}
+
+TEST(NavigationStateTest, simplifyShapesKeepsCorners) {
+    // an L shaped route with many collinear points on each leg
+    std::vector<NavigationState::Coordinate> shapes;
+    for (int j = 0; j <= 100; j++) {
+        shapes.push_back({0, j * 0.001});
+    }
+    for (int j = 1; j <= 100; j++) {
+        shapes.push_back({j * 0.001, 0.1});
+    }
+    auto simplified = NavigationState::simplifyShapes(shapes, 3);
+    ASSERT_EQ(3u, simplified.size());
+    EXPECT_EQ(shapes.front(), simplified[0]);
+    EXPECT_EQ(NavigationState::Coordinate(0, 0.1), simplified[1]);
+    EXPECT_EQ(shapes.back(), simplified[2]);
+}
+
+TEST(NavigationStateTest, simplifyShapesKeepsOrder) {
+    std::vector<NavigationState::Coordinate> shapes;
+    for (int j = 0; j < 10000; j++) {
+        shapes.push_back({j * 0.0001, (j % 7) * 0.00001 + (j / 1000) * 0.01});
+    }
+    auto simplified = NavigationState::simplifyShapes(shapes, 500);
+    ASSERT_EQ(500u, simplified.size());
+    EXPECT_EQ(shapes.front(), simplified.front());
+    EXPECT_EQ(shapes.back(), simplified.back());
+    for (size_t j = 1; j < simplified.size(); j++) {
+        EXPECT_LT(simplified[j - 1].first, simplified[j].first);
+    }
+}
+
+TEST(NavigationStateTest, tooManyShapesAreSimplified) {
+    NavigationState navigationState;
+    ASSERT_TRUE(navigationState.setPayload(
+        generatePayload("NAVIGATING", WAYPOINTS, NavigationState::MAXIMUM_SHAPES_IN_CONTEXT + 500)));
+    const auto& payload = navigationState.getPayload();
+    size_t shapes = 0;
+    auto position = payload.find("[47");
+    while (position != std::string::npos) {
+        shapes++;
+        position = payload.find("[47", position + 1);
+    }
+    EXPECT_EQ(NavigationState::MAXIMUM_SHAPES_IN_CONTEXT, shapes);
+}
+
+}  // namespace unit
+}  // namespace test
+}  // namespace aace
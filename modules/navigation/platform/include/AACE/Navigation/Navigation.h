@@ -193,7 +193,10 @@ public:
      * @endcode
      * @li state (required) : current navigation state
      * @li waypoints (required) : list of waypoints, which can be empty
-     * @li shapes (required) : list of route shapes, which can be empty or limited to 3000 entries
+     * @li shapes (required) : list of route shapes, which can be empty. A route shape with more than 3000
+     *     entries is simplified to 3000 entries that follow the route as closely as possible.
+     *
+     * @note This method is not called after the platform implementation has called @c navigationStateChanged().
      */
 
     virtual std::string getNavigationState() = 0;
@@ -397,6 +400,25 @@ public:
      */
     void showAlternativeRoutesSucceeded(const std::string& payload);
 
+    /**
+     * Notifies the Engine of a change to the navigation state. Once this method has been called, the Engine
+     * reports the navigation state from these updates and no longer calls @c getNavigationState() for every
+     * context request, so the platform implementation must call this method whenever the state changes.
+     *
+     * @param [in] navigationState JSON data in the @c getNavigationState() format. Each of the @c state,
+     * @c waypoints, and @c shapes members that is present replaces the current value, and absent members are
+     * unchanged, so the route shapes do not need to be sent again when only the waypoints change. The
+     * navigation state is @c NOT_NAVIGATING with no waypoints or shapes until it is first updated.
+     * @code{.json})
+     * {
+     *     "waypoints": [
+     *         ...
+     *     ]
+     * }
+     * @endcode
+     */
+    void navigationStateChanged(const std::string& navigationState);
+
     void setEngineInterface(std::shared_ptr<NavigationEngineInterface> navigationEngineInterface);
 
 private: